@@ -0,0 +1,2 @@
+g++ -std=c++17 -O2 lexer.cpp literal.cpp bench_lexer.cpp -o bench_lexer.out
+./bench_lexer.out
\ No newline at end of file
@@ -0,0 +1,242 @@
+// Microbenchmarks for the lexical analyzer's classification helpers.
+//
+// "old" is a frozen copy of the baseline implementation kept in this file,
+// "new" is whatever lexer.cpp currently provides (see bench.sh). The
+// speedup column is the measured justification for each change to these
+// helpers. The relex rows compare re-lexing a whole document after a
+// one-character edit with IncrementalLexer::applyEdit(), and the literal
+// rows the atoi/atof calls ast.l used with decode_literal(). Before timing
+// anything, checkRelex() applies random edits to random documents and
+// compares every result with a fresh lex of the same text; a mismatch
+// fails the run.
+#include <bits/stdc++.h>
+
+#include "lexer.h"
+#include "literal.h"
+
+using std::string;
+using std::unordered_set;
+using std::vector;
+
+namespace legacy {
+
+int isKeyword(const char buffer[]) {
+    const char* keywords[32] = {
+        "auto", "break", "case", "char", "const", "continue", "default",
+        "do", "double", "else", "enum", "extern", "float", "for", "goto",
+        "if", "int", "long", "register", "return", "short", "signed",
+        "sizeof", "static", "struct", "switch", "typedef", "union",
+        "unsigned", "void", "volatile", "while"
+    };
+    for (int i = 0; i < 32; ++i) {
+        if (strcmp(keywords[i], buffer) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+bool isLogicalOperator(const string& s) {
+    static const unordered_set<string> logicalOps = {
+        "&&", "||", "!", "<", ">", "<=", ">=", "==", "!="
+    };
+    return logicalOps.count(s);
+}
+
+bool isMathOperator(const string& s) {
+    static const unordered_set<string> mathOps = {
+        "+", "-", "*", "/", "=", "+=", "-=", "*=", "/=", "%"
+    };
+    return mathOps.count(s);
+}
+
+}  // namespace legacy
+
+static const int kRepeats = 5;
+static const int kRounds = 2000;
+
+static volatile long sink;
+
+template <typename F>
+static double bestNs(F body) {
+    double best = 1e300;
+    for (int rep = 0; rep < kRepeats; ++rep) {
+        auto t0 = std::chrono::steady_clock::now();
+        body();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+    }
+    return best;
+}
+
+static void report(const char* name, size_t size, double oldNs, double newNs, size_t ops) {
+    printf("%-28s %8zu %12.1f %12.1f %8.2fx\n",
+           name, size, oldNs / ops, newNs / ops, oldNs / newNs);
+}
+
+template <typename Old, typename New, typename T>
+static void compare(const char* name, const vector<T>& inputs, Old oldFn, New newFn) {
+    double oldNs = bestNs([&] {
+        long hits = 0;
+        for (int r = 0; r < kRounds; ++r)
+            for (const auto& in : inputs) hits += oldFn(in);
+        sink = hits;
+    });
+    double newNs = bestNs([&] {
+        long hits = 0;
+        for (int r = 0; r < kRounds; ++r)
+            for (const auto& in : inputs) hits += newFn(in);
+        sink = hits;
+    });
+    report(name, inputs.size(), oldNs, newNs, inputs.size() * kRounds);
+}
+
+// Type and then delete a character in the middle of a document of n
+// copies of a small function, re-analyzing after each keystroke.
+static void benchRelex(int copies) {
+    const string unit =
+        "int f(int x) {\n"
+        "    // running total\n"
+        "    int total = 0;\n"
+        "    for (int i = 0; i < x; i++) total += i * 2;\n"
+        "    return total >= 10 ? total : -1;\n"
+        "}\n";
+    string text;
+    for (int i = 0; i < copies; ++i) text += unit;
+    const size_t at = text.size() / 2 + unit.find("total +=");
+    const int edits = 20;
+
+    double oldNs = bestNs([&] {
+        string doc = text;
+        long tokens = 0;
+        for (int e = 0; e < edits; ++e) {
+            if (e % 2 == 0) doc.insert(at, "a");
+            else doc.erase(at, 1);
+            tokens += IncrementalLexer(doc).tokenCount();
+        }
+        sink = tokens;
+    });
+    IncrementalLexer lexer(text);
+    double newNs = bestNs([&] {
+        long tokens = 0;
+        for (int e = 0; e < edits; ++e) {
+            if (e % 2 == 0) lexer.applyEdit(at, 0, "a");
+            else lexer.applyEdit(at, 1, "");
+            tokens += lexer.tokenCount();
+        }
+        sink = tokens;
+    });
+    report("relex after 1-char edit", text.size(), oldNs, newNs, edits);
+}
+
+// Random documents built from fragments that open and close comments and
+// strings, split numbers and join words, each edited many times; after
+// every edit the incremental state must equal a lex of the text from scratch.
+static bool checkRelex() {
+    static const char* const fragments[] = {
+        "int ", "x", "\n", "0x1F", "1'000", "//c\n", "/*", "*/", "\"s\"", "+=",
+        "==", " ", "while", "1e-5", ";", "{", "}", "\n\n", "a_b"
+    };
+    const size_t nfragments = sizeof(fragments) / sizeof(fragments[0]);
+    std::mt19937 rng(7);
+    auto pieces = [&](unsigned most) {
+        string out;
+        for (unsigned i = rng() % most; i > 0; --i) out += fragments[rng() % nfragments];
+        return out;
+    };
+
+    for (int doc = 0; doc < 300; ++doc) {
+        string text = pieces(60);
+        IncrementalLexer lexer(text);
+        for (int e = 0; e < 80; ++e) {
+            size_t offset = rng() % (text.size() + 1);
+            size_t deleted = rng() % 4 == 0 ? 0 : std::min<size_t>(rng() % 6, text.size() - offset);
+            string inserted = pieces(3);
+            text.replace(offset, deleted, inserted);
+            lexer.applyEdit(offset, deleted, inserted);
+
+            IncrementalLexer fresh(text);
+            const char* differs = nullptr;
+            vector<Token> a = lexer.tokens(), b = fresh.tokens();
+            if (lexer.text() != text)
+                differs = "text differs";
+            else if (a.size() != b.size())
+                differs = "token count differs";
+            for (size_t i = 0; !differs && i < a.size(); ++i) {
+                if (a[i].offset != b[i].offset || a[i].length != b[i].length || a[i].kind != b[i].kind)
+                    differs = "tokens differ";
+                else if ((a[i].spelling == kNoSpelling) != (b[i].spelling == kNoSpelling))
+                    differs = "counted tokens differ";
+                else if (a[i].spelling != kNoSpelling &&
+                         (lexer.spelling(a[i].spelling) != fresh.spelling(b[i].spelling) ||
+                          lexer.count(a[i].spelling) != fresh.count(b[i].spelling)))
+                    differs = "spelling counts differ";
+            }
+            for (int k = 0; !differs && k < kTokenKinds; ++k)
+                if (lexer.distinct(TokenKind(k)) != fresh.distinct(TokenKind(k)))
+                    differs = "distinct sets differ";
+            if (!differs && lexer.lines().lineCount() != fresh.lines().lineCount())
+                differs = "line count differs";
+            uint32_t line = 1, column = 1;
+            for (size_t o = 0; !differs && o <= text.size(); ++o) {
+                LineIndex::Location at = lexer.lines().locate(o);
+                if (at.line != line || at.column != column)
+                    differs = "line index differs";
+                if (o < text.size() && text[o] == '\n') { ++line; column = 1; }
+                else ++column;
+            }
+            if (differs) {
+                printf("relex check: %s after edit %d of document %d\n", differs, e, doc);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    if (!checkRelex())
+        return 1;
+
+    // a mix resembling real source: keywords, short and long identifiers
+    vector<string> words = {
+        "int", "main", "x", "for", "i", "return", "while", "counter",
+        "float", "printf", "total_sum", "if", "else", "volatile", "j", "value"
+    };
+    vector<const char*> cwords;
+    for (const auto& w : words) cwords.push_back(w.c_str());
+
+    vector<string> ops = {
+        "+", "=", "<=", "&&", "(", ";", "==", "+=", "!", "x", "*", "!=", "{", "-", "||", ">"
+    };
+
+    printf("%-28s %8s %12s %12s %9s\n", "benchmark", "size", "old ns/op", "new ns/op", "speedup");
+    compare("isKeyword", cwords,
+            [](const char* w) { return legacy::isKeyword(w); },
+            [](const char* w) { return isKeyword(w); });
+    compare("isLogicalOperator", ops,
+            [](const string& s) { return legacy::isLogicalOperator(s); },
+            [](const string& s) { return isLogicalOperator(s); });
+    compare("isMathOperator", ops,
+            [](const string& s) { return legacy::isMathOperator(s); },
+            [](const string& s) { return isMathOperator(s); });
+    // number-heavy input: the decimal literals atoi/atof understand
+    vector<string> ints = {"0", "1", "10", "255", "1024", "65535", "100000", "2147483647"};
+    vector<string> floats = {"0.5", "3.14159", "2.718281828", "1.0", "100.25", "6.02e23", "1e-9", "123.456"};
+    compare("decode int literal", ints,
+            [](const string& s) { return atoi(s.c_str()); },
+            [](const string& s) {
+                literal lit;
+                decode_literal(s.data(), s.size(), &lit);
+                return static_cast<int>(lit.value.i);
+            });
+    compare("decode float literal", floats,
+            [](const string& s) { return atof(s.c_str()) > 1.0; },
+            [](const string& s) {
+                literal lit;
+                decode_literal(s.data(), s.size(), &lit);
+                return lit.value.f > 1.0;
+            });
+    for (int copies : {10, 100, 1000})
+        benchRelex(copies);
+    return 0;
+}
@@ -0,0 +1,436 @@
+#include <bits/stdc++.h>
+
+#include "lexer.h"
+
+using std::string;
+using std::array;
+using std::vector;
+
+
+// Character classes, one table load per character instead of the
+// locale-aware isalnum/isdigit calls and the otherSymbols.find scan.
+enum CharClass : unsigned char {
+    CC_DIGIT = 1,           // 0-9
+    CC_IDENT = 2,           // letters, digits and '_'
+    CC_OTHER = 4,           // ,;(){}[]'":\&|
+};
+
+constexpr array<unsigned char, 256> makeCharClasses() {
+    array<unsigned char, 256> table{};
+    for (int c = '0'; c <= '9'; ++c) table[c] |= CC_DIGIT | CC_IDENT;
+    for (int c = 'a'; c <= 'z'; ++c) table[c] |= CC_IDENT;
+    for (int c = 'A'; c <= 'Z'; ++c) table[c] |= CC_IDENT;
+    table['_'] |= CC_IDENT;
+    for (const char* p = ",;(){}[]'\":\\&|"; *p; ++p)
+        table[static_cast<unsigned char>(*p)] |= CC_OTHER;
+    return table;
+}
+
+constexpr array<unsigned char, 256> charClasses = makeCharClasses();
+
+
+// Operator trie for the 1- and 2-character operators. The root row gives
+// the kind of every 1-character operator and the row holding the second
+// characters that extend it; a row gives the kind of each 2-character
+// operator. Logical operators are inserted first and so win, as before.
+enum OpKind : unsigned char { OP_NONE = 0, OP_LOGICAL = 1, OP_MATH = 2 };
+
+constexpr const char* logicalOperatorList[] = {
+    "&&", "||", "!", "<", ">", "<=", ">=", "==", "!="
+};
+constexpr const char* mathOperatorList[] = {
+    "+", "-", "*", "/", "=", "+=", "-=", "*=", "/=", "%"
+};
+
+constexpr int kOpRows = 11;  // root plus one row per first character of a 2-char operator
+
+struct OpTrie {
+    array<array<unsigned char, 256>, kOpRows> kind{};   // [row][char]
+    array<array<unsigned char, 256>, kOpRows> child{};  // [row][char] -> row, 0 if none
+    int rows = 1;
+
+    constexpr void insert(const char* op, unsigned char k) {
+        unsigned char c0 = static_cast<unsigned char>(op[0]);
+        if (op[1] == '\0') {
+            if (kind[0][c0] == OP_NONE) kind[0][c0] = k;
+            return;
+        }
+        if (child[0][c0] == 0) child[0][c0] = static_cast<unsigned char>(rows++);
+        unsigned char c1 = static_cast<unsigned char>(op[1]);
+        unsigned char row = child[0][c0];
+        if (kind[row][c1] == OP_NONE) kind[row][c1] = k;
+    }
+};
+
+constexpr OpTrie makeOpTrie() {
+    OpTrie trie{};
+    for (const char* op : logicalOperatorList) trie.insert(op, OP_LOGICAL);
+    for (const char* op : mathOperatorList) trie.insert(op, OP_MATH);
+    return trie;
+}
+
+constexpr OpTrie opTrie = makeOpTrie();
+static_assert(opTrie.rows <= kOpRows, "kOpRows too small for the operator lists");
+
+inline unsigned char opKind1(unsigned char c0) {
+    return opTrie.kind[0][c0];
+}
+
+inline unsigned char opKind2(unsigned char c0, unsigned char c1) {
+    unsigned char row = opTrie.child[0][c0];
+    if (row == 0) return OP_NONE;
+    return opTrie.kind[row][c1];
+}
+
+inline unsigned char opKind(const string& s) {
+    if (s.size() == 1) return opKind1(static_cast<unsigned char>(s[0]));
+    if (s.size() == 2)
+        return opKind2(static_cast<unsigned char>(s[0]), static_cast<unsigned char>(s[1]));
+    return OP_NONE;
+}
+
+
+constexpr size_t kMaxKeywordLength = 8;  // "continue", "register", ...
+
+int isKeyword(const char buffer[]) {
+    const char* keywords[32] = {
+        "auto", "break", "case", "char", "const", "continue", "default",
+        "do", "double", "else", "enum", "extern", "float", "for", "goto",
+        "if", "int", "long", "register", "return", "short", "signed",
+        "sizeof", "static", "struct", "switch", "typedef", "union",
+        "unsigned", "void", "volatile", "while"
+    };
+    for (int i = 0; i < 32; ++i) {
+        if (strcmp(keywords[i], buffer) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+// isKeyword for a token that is not NUL-terminated
+bool isKeywordToken(const char* token, size_t len) {
+    if (len > kMaxKeywordLength) return false;
+    char word[kMaxKeywordLength + 1];
+    memcpy(word, token, len);
+    word[len] = '\0';
+    return isKeyword(word);
+}
+
+bool isLogicalOperator(const string& s) {
+    return opKind(s) == OP_LOGICAL;
+}
+
+bool isMathOperator(const string& s) {
+    return opKind(s) == OP_MATH;
+}
+
+
+TextBuffer::TextBuffer(const string& text)
+    : data_(text.begin(), text.end()), gapStart_(text.size()), gapLength_(0) {}
+
+
+void TextBuffer::moveGap(size_t offset) {
+    char* d = data_.data();
+    if (offset < gapStart_)
+        memmove(d + offset + gapLength_, d + offset, gapStart_ - offset);
+    else if (offset > gapStart_)
+        memmove(d + gapStart_, d + gapStart_ + gapLength_, offset - gapStart_);
+    gapStart_ = offset;
+}
+
+
+void TextBuffer::replace(size_t offset, size_t deleted, const string& inserted) {
+    moveGap(offset);
+    gapLength_ += deleted;
+    if (inserted.size() > gapLength_) {
+        // grow by at least the text's size, so growing costs O(1) a byte
+        const size_t tail = data_.size() - gapStart_ - gapLength_;
+        const size_t gap = inserted.size() + std::max<size_t>(size(), 64);
+        data_.resize(gapStart_ + gap + tail);
+        memmove(data_.data() + gapStart_ + gap, data_.data() + gapStart_ + gapLength_, tail);
+        gapLength_ = gap;
+    }
+    std::copy(inserted.begin(), inserted.end(), data_.begin() + gapStart_);
+    gapStart_ += inserted.size();
+    gapLength_ -= inserted.size();
+}
+
+
+string TextBuffer::substr(size_t offset, size_t length) const {
+    const size_t before = offset < gapStart_ ? std::min(length, gapStart_ - offset) : 0;
+    string out(data_.data() + offset, before);
+    out.append(data_.data() + offset + before + gapLength_, length - before);
+    return out;
+}
+
+
+LineIndex::LineIndex(const string& text) : size_(text.size()) {
+    before_.push_back(0);
+    const char* s = text.data();
+    const char* end = s + text.size();
+    for (const char* p = s; (p = static_cast<const char*>(memchr(p, '\n', end - p))); ++p)
+        before_.push_back(static_cast<uint32_t>(p - s + 1));
+}
+
+
+// Move the gap so that before_ holds exactly the starts at or before offset.
+void LineIndex::moveGap(size_t offset) {
+    while (!after_.empty() && size_ - after_.back() <= offset) {
+        before_.push_back(static_cast<uint32_t>(size_ - after_.back()));
+        after_.pop_back();
+    }
+    while (before_.back() > offset) {
+        after_.push_back(static_cast<uint32_t>(size_ - before_.back()));
+        before_.pop_back();
+    }
+}
+
+
+void LineIndex::applyEdit(size_t offset, size_t deleted, const string& inserted) {
+    // lines starting inside the replaced text go; later ones keep their
+    // distance to the end, so nothing past the edit is touched
+    moveGap(offset);
+    while (!after_.empty() && size_ - after_.back() <= offset + deleted) after_.pop_back();
+    for (size_t i = 0; i < inserted.size(); ++i)
+        if (inserted[i] == '\n') before_.push_back(static_cast<uint32_t>(offset + i + 1));
+    size_ = size_ - deleted + inserted.size();
+}
+
+
+uint32_t LineIndex::start(size_t line) const {
+    if (line < before_.size()) return before_[line];
+    return static_cast<uint32_t>(size_ - after_[after_.size() - 1 - (line - before_.size())]);
+}
+
+
+LineIndex::Location LineIndex::locate(uint32_t offset) const {
+    // the line is the number of starts at or before offset
+    size_t line = std::upper_bound(before_.begin(), before_.end(), offset) - before_.begin();
+    if (line == before_.size()) {
+        const uint32_t fromEnd = static_cast<uint32_t>(size_ - std::min<size_t>(offset, size_));
+        line += after_.end() - std::lower_bound(after_.begin(), after_.end(), fromEnd);
+    }
+    return {static_cast<uint32_t>(line), offset - start(line - 1) + 1};
+}
+
+
+IncrementalLexer::IncrementalLexer(string text) : text_(text), lines_(text) {
+    size_t pos = 0;
+    Token t;
+    while ((pos = scan(pos, t)) != string::npos) {
+        add(t);
+        before_.push_back(t);
+    }
+}
+
+
+// Scan the token at or after pos into out and return the offset just past
+// it, or npos at the end of the text. Only text from pos onward is read,
+// so every token start is a safe place to restart.
+size_t IncrementalLexer::scan(size_t pos, Token& out) const {
+    const TextBuffer& s = text_;
+    const size_t len = text_.size();
+
+    for (; pos < len; ++pos) {
+        unsigned char c0 = static_cast<unsigned char>(s[pos]);
+        size_t start = pos;
+        TokenKind kind;
+
+        if (c0 == '/' && pos + 1 < len && (s[pos + 1] == '/' || s[pos + 1] == '*')) {
+            if (s[pos + 1] == '/') {
+                pos += 2;
+                while (pos < len && s[pos] != '\n') ++pos;
+            } else {
+                pos += 2;
+                while (pos + 1 < len && !(s[pos] == '*' && s[pos + 1] == '/')) ++pos;
+                pos = std::min(pos + 2, len);
+            }
+            kind = TokenKind::Comment;
+        } else if (c0 == '"') {
+            ++pos;
+            while (pos < len && s[pos] != '"') {
+                if (s[pos] == '\\') ++pos;  // skip escaped character
+                ++pos;
+            }
+            pos = std::min(pos + 1, len);
+            kind = TokenKind::String;
+        } else if (charClasses[c0] & CC_DIGIT) {
+            // a whole preprocessing number (3.14, 1e-5, 0x1F, 1'000u), decoded
+            // and checked later by decode_literal()
+            ++pos;
+            while (pos < len) {
+                unsigned char c = static_cast<unsigned char>(s[pos]);
+                if ((charClasses[c] & CC_IDENT) || c == '.') {
+                    ++pos;
+                } else if ((c == '+' || c == '-') && strchr("eEpP", s[pos - 1])) {
+                    ++pos;
+                } else if (c == '\'' && pos + 1 < len &&
+                           (charClasses[static_cast<unsigned char>(s[pos + 1])] & CC_IDENT)) {
+                    pos += 2;
+                } else {
+                    break;
+                }
+            }
+            kind = TokenKind::Number;
+        } else if (charClasses[c0] & CC_IDENT) {
+            while (pos < len && (charClasses[static_cast<unsigned char>(s[pos])] & CC_IDENT)) ++pos;
+            // keywords are short: copy at most that much out of the buffer
+            char word[kMaxKeywordLength];
+            const size_t n = pos - start;
+            for (size_t i = 0; i < n && i < kMaxKeywordLength; ++i) word[i] = s[start + i];
+            if (isKeywordToken(word, n))
+                kind = TokenKind::Keyword;
+            else
+                kind = TokenKind::Identifier;
+        } else {
+            // 2-character operators first
+            unsigned char op = OP_NONE;
+            if (pos + 1 < len) op = opKind2(c0, static_cast<unsigned char>(s[pos + 1]));
+            if (op != OP_NONE) {
+                pos += 2;
+            } else {
+                op = opKind1(c0);
+                if (op == OP_NONE && !(charClasses[c0] & CC_OTHER)) continue;  // not a token
+                pos += 1;
+            }
+            if (op == OP_LOGICAL)
+                kind = TokenKind::LogicalOperator;
+            else if (op == OP_MATH)
+                kind = TokenKind::MathOperator;
+            else
+                kind = TokenKind::Other;
+        }
+
+        out.offset = static_cast<uint32_t>(start);
+        out.length = static_cast<uint32_t>(pos - start);
+        out.kind = kind;
+        out.spelling = kNoSpelling;
+        return pos;
+    }
+    return string::npos;
+}
+
+
+uint32_t IncrementalLexer::intern(size_t offset, size_t length) {
+    string key = text_.substr(offset, length);
+    auto it = spellingIds_.find(key);
+    if (it != spellingIds_.end()) return it->second;
+
+    uint32_t id = static_cast<uint32_t>(spellings_.size());
+    spellings_.push_back(key);
+    counts_.push_back(0);
+    spellingIds_.emplace(std::move(key), id);
+    return id;
+}
+
+
+void IncrementalLexer::add(Token& t) {
+    if (t.kind == TokenKind::Comment || t.kind == TokenKind::String) return;
+    t.spelling = intern(t.offset, t.length);
+    if (counts_[t.spelling]++ == 0)
+        distinct_[static_cast<int>(t.kind)].insert(spellings_[t.spelling]);
+}
+
+
+void IncrementalLexer::remove(const Token& t) {
+    if (t.spelling == kNoSpelling) return;
+    if (--counts_[t.spelling] == 0)
+        distinct_[static_cast<int>(t.kind)].erase(spellings_[t.spelling]);
+}
+
+
+// Move the gap so that before_ holds exactly the tokens ending before offset.
+void IncrementalLexer::moveGap(size_t offset) {
+    const size_t len = text_.size();
+
+    while (!after_.empty()) {
+        Token t = after_.back();
+        t.offset = static_cast<uint32_t>(len - t.offset);
+        if (t.offset + t.length >= offset) break;
+        before_.push_back(t);
+        after_.pop_back();
+    }
+    while (!before_.empty() && before_.back().offset + before_.back().length >= offset) {
+        Token t = before_.back();
+        t.offset = static_cast<uint32_t>(len - t.offset);
+        after_.push_back(t);
+        before_.pop_back();
+    }
+}
+
+
+RelexStats IncrementalLexer::applyEdit(size_t offset, size_t deleted, const string& inserted) {
+    offset = std::min(offset, text_.size());
+    deleted = std::min(deleted, text_.size() - offset);
+
+    // A token's scan reads at most two characters past its end (a digit
+    // separator needs the character after it), so the first token that can
+    // change is the first one ending at or after the character before the edit.
+    moveGap(offset > 0 ? offset - 1 : 0);
+    size_t restart = offset;
+    if (!after_.empty())
+        restart = std::min(restart, text_.size() - after_.back().offset);
+
+    const size_t oldEditEnd = offset + deleted;
+    const size_t oldLen = text_.size();
+    text_.replace(offset, deleted, inserted);
+    lines_.applyEdit(offset, deleted, inserted);
+    const size_t newLen = text_.size();
+    const size_t newEditEnd = offset + inserted.size();
+
+    RelexStats stats{restart, 0, 0, 0};
+    size_t pos = restart;
+    Token t;
+    bool synced = false;
+
+    while ((pos = scan(pos, t)) != string::npos) {
+        // drop old tokens inside the edit or overtaken by the new stream
+        while (!after_.empty()) {
+            const Token& old = after_.back();
+            size_t oldStart = oldLen - old.offset;
+            size_t newStart = newLen - old.offset;
+            if (oldStart >= oldEditEnd && newStart >= t.offset) break;
+            remove(old);
+            after_.pop_back();
+            ++stats.tokensRemoved;
+        }
+        // same start past the edit: identical text from here on, so the
+        // rest of the old tokens are still right
+        if (t.offset >= newEditEnd && !after_.empty() && newLen - after_.back().offset == t.offset) {
+            synced = true;
+            break;
+        }
+        add(t);
+        before_.push_back(t);
+        ++stats.tokensAdded;
+        stats.bytesScanned = pos - restart;
+    }
+
+    if (!synced) {
+        stats.bytesScanned = newLen - restart;
+        while (!after_.empty()) {
+            remove(after_.back());
+            after_.pop_back();
+            ++stats.tokensRemoved;
+        }
+    } else {
+        stats.bytesScanned = t.offset - restart;
+    }
+    return stats;
+}
+
+
+Token IncrementalLexer::token(size_t index) const {
+    if (index < before_.size()) return before_[index];
+    Token t = after_[after_.size() - 1 - (index - before_.size())];
+    t.offset = static_cast<uint32_t>(text_.size() - t.offset);
+    return t;
+}
+
+
+vector<Token> IncrementalLexer::tokens() const {
+    vector<Token> all;
+    all.reserve(tokenCount());
+    for (size_t i = 0; i < tokenCount(); ++i) all.push_back(token(i));
+    return all;
+}
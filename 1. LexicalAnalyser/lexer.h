@@ -0,0 +1,153 @@
+#ifndef LEXER_H
+#define LEXER_H
+
+// Scanner library behind lexicalanalyzer.cpp.
+//
+// IncrementalLexer keeps a document, its token array and the aggregate
+// sets the analyzer prints (keywords, identifiers, numbers, operators,
+// other symbols). applyEdit() re-lexes only from the token the edit can
+// affect until the new token stream lines up with the old one again, and
+// updates the sets by removing the old tokens' counts and adding the new
+// ones, so an editor can re-analyze on every keystroke.
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class TokenKind : uint8_t {
+    Keyword,
+    Identifier,
+    Number,
+    LogicalOperator,
+    MathOperator,
+    Other,          // ,;(){}[]'":\&|
+    Comment,
+    String,
+};
+
+constexpr int kTokenKinds = 8;
+
+struct Token {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t spelling;  // index into IncrementalLexer::spelling(), kNoSpelling if not counted
+    TokenKind kind;
+};
+
+constexpr uint32_t kNoSpelling = UINT32_MAX;
+
+struct RelexStats {
+    size_t restartOffset;   // where scanning resumed
+    size_t bytesScanned;
+    size_t tokensRemoved;
+    size_t tokensAdded;
+};
+
+// The document text as a gap buffer: the bytes before a movable gap, then
+// the bytes after it. The gap sits at the last edit, so an edit moves only
+// the text between it and the previous edit, not everything after it.
+class TextBuffer {
+public:
+    explicit TextBuffer(const std::string& text = "");
+
+    size_t size() const { return data_.size() - gapLength_; }
+    char operator[](size_t i) const { return data_[i < gapStart_ ? i : i + gapLength_]; }
+
+    void replace(size_t offset, size_t deleted, const std::string& inserted);
+    std::string substr(size_t offset, size_t length) const;
+    std::string str() const { return substr(0, size()); }
+
+private:
+    void moveGap(size_t offset);
+
+    std::vector<char> data_;
+    size_t gapStart_;
+    size_t gapLength_;
+};
+
+// Offsets of line starts, so a token offset resolves to line and column
+// with a binary search instead of a per-token line counter.
+class LineIndex {
+public:
+    explicit LineIndex(const std::string& text = "");
+
+    // keep the index in step with IncrementalLexer::applyEdit
+    void applyEdit(size_t offset, size_t deleted, const std::string& inserted);
+
+    size_t lineCount() const { return before_.size() + after_.size(); }
+
+    struct Location {
+        uint32_t line;      // 1-based
+        uint32_t column;    // 1-based, in bytes
+    };
+    Location locate(uint32_t offset) const;
+
+private:
+    void moveGap(size_t offset);
+    uint32_t start(size_t line) const;
+
+    // Split at the last edit like IncrementalLexer's tokens: before_ holds
+    // the starts up to it in order, before_[0] == 0, and after_ the rest in
+    // reverse order, measured back from the end of the text.
+    std::vector<uint32_t> before_;
+    std::vector<uint32_t> after_;
+    size_t size_;
+};
+
+class IncrementalLexer {
+public:
+    explicit IncrementalLexer(std::string text = "");
+
+    // Replace `deleted` bytes at `offset` with `inserted`.
+    RelexStats applyEdit(size_t offset, size_t deleted, const std::string& inserted);
+
+    std::string text() const { return text_.str(); }
+    const LineIndex& lines() const { return lines_; }
+
+    size_t tokenCount() const { return before_.size() + after_.size(); }
+    Token token(size_t index) const;
+    std::vector<Token> tokens() const;
+
+    const std::string& spelling(uint32_t id) const { return spellings_[id]; }
+
+    // distinct spellings of a kind currently in the document, sorted
+    const std::set<std::string>& distinct(TokenKind kind) const {
+        return distinct_[static_cast<int>(kind)];
+    }
+    // occurrences of a spelling in the document
+    int count(uint32_t spelling) const { return counts_[spelling]; }
+
+private:
+    size_t scan(size_t pos, Token& out) const;
+    uint32_t intern(size_t offset, size_t length);
+    void add(Token& t);
+    void remove(const Token& t);
+    void moveGap(size_t offset);
+
+    TextBuffer text_;
+    LineIndex lines_;
+
+    // The token array is split at a movable gap: before_ holds tokens in
+    // order with absolute offsets, after_ holds the rest in reverse order
+    // with offsets measured back from the end of the text. An edit never
+    // changes the distance to the end of a token after it, so nothing past
+    // the edit is touched and the cost of applyEdit is the cost of the
+    // re-lexed region plus moving the gap from the previous edit.
+    std::vector<Token> before_;
+    std::vector<Token> after_;
+
+    std::vector<std::string> spellings_;
+    std::unordered_map<std::string, uint32_t> spellingIds_;
+    std::vector<int> counts_;
+    std::set<std::string> distinct_[kTokenKinds];
+};
+
+int isKeyword(const char buffer[]);
+bool isKeywordToken(const char* token, size_t len);
+bool isLogicalOperator(const std::string& s);
+bool isMathOperator(const std::string& s);
+
+#endif
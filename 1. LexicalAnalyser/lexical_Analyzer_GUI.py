@@ -1,10 +1,15 @@
 import os
 import subprocess
+import sys
 import threading
+import time
 import ttkbootstrap as tb
 from ttkbootstrap.constants import *
 from tkinter import filedialog, messagebox, scrolledtext
 
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+import build  # noqa: E402
+
 
 class LexicalGUI:
     def __init__(self, root):
@@ -82,15 +87,20 @@ class LexicalGUI:
             self.root.destroy()
             return
 
-        self.set_status("Compiling lexical analyzer...")
+        self.set_status("Checking lexical analyzer build...")
         self.progress.start(10)
-        compile_cmd = ["g++", "-std=c++11", self.LEXICAL_CPP, "-o", self.EXECUTABLE]
 
         try:
-            subprocess.check_output(compile_cmd, stderr=subprocess.STDOUT)
-            self.set_status("Compilation successful. Select a C++ file to analyze.")
-        except subprocess.CalledProcessError as e:
-            messagebox.showerror("Compilation Error", e.output.decode())
+            # rebuilds lexicalanalyzer.out only if a source is newer
+            start = time.perf_counter()
+            built = build.ensure(["lexer"])
+            elapsed = (time.perf_counter() - start) * 1000
+            state = "Compiled" if built else "Up to date"
+            self.set_status(
+                f"{state} ({elapsed:.0f} ms). Select a C++ file to analyze."
+            )
+        except build.BuildError as e:
+            messagebox.showerror("Compilation Error", str(e))
             self.set_status("Compilation failed. See error above.")
             self.run_button.config(state="disabled")
         finally:
@@ -107,6 +117,7 @@ class LexicalGUI:
         self.set_status("Running lexical analyzer...")
         self.progress.start(10)
 
+        start = time.perf_counter()
         try:
             result = subprocess.check_output(
                 [self.EXECUTABLE, self.selected_file], stderr=subprocess.STDOUT
@@ -116,7 +127,7 @@ class LexicalGUI:
             output = "Runtime Error:\n" + e.output.decode()
 
         self.append_output(output)
-        self.set_status("Done.")
+        self.set_status(f"Done ({(time.perf_counter() - start) * 1000:.0f} ms).")
         self.run_button.config(state="normal")
         self.progress.stop()
 
@@ -1,6 +1,8 @@
 #include <bits/stdc++.h>
 
-using std::unordered_set;
+#include "lexer.h"
+#include "literal.h"
+
 using std::string;
 using std::cerr;
 using std::ifstream;
@@ -9,35 +11,6 @@ using std::istreambuf_iterator;
 using std::cout;
 
 
-int isKeyword(const char buffer[]) {
-    const char* keywords[32] = {
-        "auto", "break", "case", "char", "const", "continue", "default",
-        "do", "double", "else", "enum", "extern", "float", "for", "goto",
-        "if", "int", "long", "register", "return", "short", "signed",
-        "sizeof", "static", "struct", "switch", "typedef", "union",
-        "unsigned", "void", "volatile", "while"
-    };
-    for (int i = 0; i < 32; ++i) {
-        if (strcmp(keywords[i], buffer) == 0)
-            return 1;
-    }
-    return 0;
-}
-
-bool isLogicalOperator(const string& s) {
-    static const unordered_set<string> logicalOps = {
-        "&&", "||", "!", "<", ">", "<=", ">=", "==", "!="
-    };
-    return logicalOps.count(s);
-}
-
-bool isMathOperator(const string& s) {
-    static const unordered_set<string> mathOps = {
-        "+", "-", "*", "/", "=", "+=", "-=", "*=", "/=", "%"
-    };
-    return mathOps.count(s);
-}
-
 int main(int argc, char* argv[]) {
     if (argc < 2) {
         cerr << "Usage: " << argv[0] << " <input_cpp_file>\n";
@@ -53,86 +26,22 @@ int main(int argc, char* argv[]) {
     string content((istreambuf_iterator<char>(fin)), istreambuf_iterator<char>());
     fin.close();
 
-    set<string> keywordsFound;
-    set<string> identifiersFound;
-    set<string> numericalValues;
-    set<string> logicalOperators;
-    set<string> mathOperators;
-    set<char> others;
-
-    const string otherSymbols = ",;(){}[]'\":\\&|";
+    IncrementalLexer lexer(content);
 
-    for (size_t i = 0; i < content.length(); ++i) {
-        // Skip comments
-        if (content[i] == '/' && i + 1 < content.length()) {
-            if (content[i + 1] == '/') {
-                i += 2;
-                while (i < content.length() && content[i] != '\n') ++i;
-                continue;
-            }
-            else if (content[i + 1] == '*') {
-                i += 2;
-                while (i + 1 < content.length() && !(content[i] == '*' && content[i + 1] == '/')) ++i;
-                i += 1;
-                continue;
-            }
-        }
-
-        // Skip string literals
-        if (content[i] == '"') {
-            ++i;
-            while (i < content.length() && content[i] != '"') {
-                if (content[i] == '\\') ++i; // skip escaped character
-                ++i;
-            }
-            continue;
-        }
-
-        // Check 2-character operators first
-        if (i + 1 < content.length()) {
-            string twoCharOp = content.substr(i, 2);
-            if (isLogicalOperator(twoCharOp)) {
-                logicalOperators.insert(twoCharOp);
-                i++;
-                continue;
-            }
-            if (isMathOperator(twoCharOp)) {
-                mathOperators.insert(twoCharOp);
-                i++;
-                continue;
-            }
-        }
-
-        string oneChar(1, content[i]);
-        if (isLogicalOperator(oneChar)) {
-            logicalOperators.insert(oneChar);
-        } else if (isMathOperator(oneChar)) {
-            mathOperators.insert(oneChar);
-        } else if (otherSymbols.find(content[i]) != string::npos) {
-            others.insert(content[i]);
-        }
-    }
-
-    // Tokenize for keywords, identifiers, numbers
-    string token;
-    for (size_t i = 0; i <= content.length(); ++i) {
-        char ch = (i < content.length()) ? content[i] : ' ';
-
-        if (isalnum(ch) || ch == '_') {
-            token += ch;
-        } else {
-            if (!token.empty()) {
-                if (isdigit(token[0])) {
-                    numericalValues.insert(token);
-                } else if (isKeyword(token.c_str())) {
-                    keywordsFound.insert(token);
-                } else {
-                    identifiersFound.insert(token);
-                }
-                token.clear();
-            }
-        }
+    const set<string>& keywordsFound = lexer.distinct(TokenKind::Keyword);
+    const set<string>& identifiersFound = lexer.distinct(TokenKind::Identifier);
+    // numbers are only shown once they decode; the rest are reported
+    set<string> numericalValues;
+    std::vector<std::pair<string, const char*>> numberProblems;
+    for (const auto& number : lexer.distinct(TokenKind::Number)) {
+        literal lit;
+        decode_literal(number.data(), number.size(), &lit);
+        if (lit.status != LIT_INVALID) numericalValues.insert(number);
+        if (lit.status != LIT_OK) numberProblems.emplace_back(number, literal_status_message(&lit));
     }
+    const set<string>& logicalOperators = lexer.distinct(TokenKind::LogicalOperator);
+    const set<string>& mathOperators = lexer.distinct(TokenKind::MathOperator);
+    const set<string>& others = lexer.distinct(TokenKind::Other);
 
     // Output section
     auto printSet = [](const string& label, const set<string>& s) {
@@ -172,12 +81,18 @@ int main(int argc, char* argv[]) {
     if (count % 8 != 0) cout << "\n";
 
     printSet("Numerical Values", numericalValues);
+    if (!numberProblems.empty()) {
+        cout << "----------------------------------------\n";
+        cout << "Numeric Literal Problems (" << numberProblems.size() << "):\n";
+        for (const auto& problem : numberProblems)
+            cout << "  " << problem.first << ": " << problem.second << "\n";
+    }
 
     cout << "----------------------------------------\n";
     cout << "Others (" << others.size() << "):\n";
     count = 0;
     for (const auto& ch : others) {
-        cout << "  " << ch;
+        cout << "  " << ch[0];
         ++count;
         if (count % 16 == 0) cout << "\n";
     }
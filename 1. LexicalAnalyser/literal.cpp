@@ -0,0 +1,298 @@
+#include <cfloat>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <system_error>
+
+#include "literal.h"
+
+namespace {
+
+// longest literal whose separators are stripped into a stack buffer
+constexpr size_t kMaxLiteral = 128;
+
+bool isDigitOf(char c, int base) {
+    if (base == 16)
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+    if (base == 2) return c == '0' || c == '1';
+    return c >= '0' && c <= '9';    // octal digits are checked after the scan
+}
+
+// Scan digits of `base` allowing ' between two digits; returns the end of
+// the run, which stops at a misplaced separator.
+const char* scanDigits(const char* p, const char* end, int base, bool* separators) {
+    const char* start = p;
+    while (p < end) {
+        if (isDigitOf(*p, base)) {
+            ++p;
+        } else if (*p == '\'' && p > start && p + 1 < end && isDigitOf(p[1], base)) {
+            *separators = true;
+            ++p;
+        } else {
+            break;
+        }
+    }
+    return p;
+}
+
+struct IntSuffix {
+    bool isUnsigned;
+    int longs;          // 0, 1 (l) or 2 (ll)
+};
+
+bool parseIntSuffix(const char* p, const char* end, IntSuffix* out) {
+    out->isUnsigned = false;
+    out->longs = 0;
+    bool sawU = false, sawL = false;
+    while (p < end) {
+        if ((*p == 'u' || *p == 'U') && !sawU) {
+            sawU = true;
+            ++p;
+        } else if ((*p == 'l' || *p == 'L') && !sawL) {
+            sawL = true;
+            if (p + 1 < end && p[1] == *p) {    // ll or LL, not lL
+                out->longs = 2;
+                p += 2;
+            } else {
+                out->longs = 1;
+                ++p;
+            }
+        } else {
+            return false;
+        }
+    }
+    out->isUnsigned = sawU;
+    return true;
+}
+
+struct TypeLimit {
+    lit_type type;
+    unsigned long long max;
+};
+
+constexpr TypeLimit kIntTypes[] = {
+    {LIT_INT, INT_MAX},
+    {LIT_UNSIGNED, UINT_MAX},
+    {LIT_LONG, LONG_MAX},
+    {LIT_UNSIGNED_LONG, ULONG_MAX},
+    {LIT_LONG_LONG, LLONG_MAX},
+    {LIT_UNSIGNED_LONG_LONG, ULLONG_MAX},
+};
+
+bool isUnsignedType(lit_type t) {
+    return t == LIT_UNSIGNED || t == LIT_UNSIGNED_LONG || t == LIT_UNSIGNED_LONG_LONG;
+}
+
+int rank(lit_type t) {
+    switch (t) {
+        case LIT_INT: case LIT_UNSIGNED: return 0;
+        case LIT_LONG: case LIT_UNSIGNED_LONG: return 1;
+        default: return 2;
+    }
+}
+
+// First type in int, unsigned, long, ... allowed by the suffix and base that
+// holds value; decimal literals only go unsigned when the suffix says so.
+bool pickIntType(unsigned long long value, const IntSuffix& suffix, bool decimal, lit_type* out) {
+    for (const TypeLimit& t : kIntTypes) {
+        bool isUnsigned = isUnsignedType(t.type);
+        if (rank(t.type) < suffix.longs) continue;
+        if (suffix.isUnsigned && !isUnsigned) continue;
+        if (!suffix.isUnsigned && isUnsigned && decimal) continue;
+        *out = t.type;
+        if (value <= t.max) return true;
+    }
+    return false;   // *out is left at the widest allowed type
+}
+
+// Copy [p, end) without separators into buf; false if it does not fit.
+bool stripSeparators(const char* p, const char* end, char* buf, const char** bufEnd) {
+    if (static_cast<size_t>(end - p) > kMaxLiteral) return false;
+    char* q = buf;
+    for (; p < end; ++p)
+        if (*p != '\'') *q++ = *p;
+    *bufEnd = q;
+    return true;
+}
+
+lit_status finish(literal* out, lit_status status) {
+    out->status = status;
+    return status;
+}
+
+lit_status decodeFloat(const char* first, const char* end, bool hex, literal* out) {
+    // mantissa, then the exponent: e for decimal, p (required) for hex
+    out->type = LIT_DOUBLE;
+    const int base = hex ? 16 : 10;
+    bool separators = false;
+    const char* p = scanDigits(first, end, base, &separators);
+    bool digits = p > first;
+    if (p < end && *p == '.') {
+        const char* frac = ++p;
+        p = scanDigits(p, end, base, &separators);
+        digits = digits || p > frac;
+    }
+    if (!digits) return finish(out, LIT_INVALID);
+
+    bool negativeExponent = false;
+    if (p < end && (hex ? (*p == 'p' || *p == 'P') : (*p == 'e' || *p == 'E'))) {
+        ++p;
+        if (p < end && (*p == '+' || *p == '-')) negativeExponent = *p++ == '-';
+        const char* exp = p;
+        p = scanDigits(p, end, 10, &separators);
+        if (p == exp) return finish(out, LIT_INVALID);
+    } else if (hex) {
+        return finish(out, LIT_INVALID);
+    }
+    const char* numberEnd = p;
+
+    if (p < end) {
+        if (p + 1 != end) return finish(out, LIT_INVALID);
+        if (*p == 'f' || *p == 'F') out->type = LIT_FLOAT;
+        else if (*p == 'l' || *p == 'L') out->type = LIT_LONG_DOUBLE;
+        else return finish(out, LIT_INVALID);
+    }
+
+    char buf[kMaxLiteral];
+    const char* bufEnd = numberEnd;
+    if (separators) {
+        if (!stripSeparators(first, numberEnd, buf, &bufEnd)) return finish(out, LIT_INVALID);
+        first = buf;
+    }
+
+    double value = 0;
+    auto format = hex ? std::chars_format::hex : std::chars_format::general;
+    auto [ptr, ec] = std::from_chars(first, bufEnd, value, format);
+    if (ptr != bufEnd) return finish(out, LIT_INVALID);
+    if (ec == std::errc::result_out_of_range) {
+        // a denormal still decodes; only a value that rounds to 0 lands here
+        out->value.f = negativeExponent ? 0.0 : HUGE_VAL;
+        return finish(out, negativeExponent ? LIT_UNDERFLOW : LIT_OVERFLOW);
+    }
+    out->value.f = value;
+    if (out->type == LIT_FLOAT && std::fabs(value) > FLT_MAX) {
+        out->value.f = HUGE_VAL;
+        return finish(out, LIT_OVERFLOW);
+    }
+    if (out->type == LIT_FLOAT && value != 0 && static_cast<float>(value) == 0) {
+        out->value.f = 0.0;
+        return finish(out, LIT_UNDERFLOW);
+    }
+    return finish(out, LIT_OK);
+}
+
+lit_status decodeInt(const char* first, const char* end, int base, literal* out) {
+    bool separators = false;
+    const char* p = scanDigits(first, end, base, &separators);
+    if (p == first) return finish(out, LIT_INVALID);
+    const char* digitsEnd = p;
+
+    IntSuffix suffix;
+    if (!parseIntSuffix(p, end, &suffix)) return finish(out, LIT_INVALID);
+
+    char buf[kMaxLiteral];
+    if (separators) {
+        if (!stripSeparators(first, digitsEnd, buf, &digitsEnd)) return finish(out, LIT_INVALID);
+        first = buf;
+    }
+
+    unsigned long long value = 0;
+    auto [ptr, ec] = std::from_chars(first, digitsEnd, value, base);
+    if (ptr != digitsEnd) return finish(out, LIT_INVALID);  // e.g. 9 in an octal literal
+    if (ec == std::errc::result_out_of_range) {
+        pickIntType(ULLONG_MAX, suffix, base == 10, &out->type);
+        out->value.i = ULLONG_MAX;
+        return finish(out, LIT_OVERFLOW);
+    }
+
+    out->value.i = value;
+    if (!pickIntType(value, suffix, base == 10, &out->type))
+        return finish(out, LIT_OVERFLOW);
+    return finish(out, LIT_OK);
+}
+
+}  // namespace
+
+
+extern "C" lit_status decode_literal(const char* text, size_t len, literal* out) {
+    const char* p = text;
+    const char* end = text + len;
+    out->type = LIT_INT;
+    out->value.i = 0;
+    if (len == 0) return finish(out, LIT_INVALID);
+
+    // Plain decimal integers are most literals: up to 18 digits cannot
+    // overflow long long, so one pass settles them without from_chars.
+    if (len <= 18 && (p[0] != '0' || len == 1)) {
+        unsigned long long value = 0;
+        size_t i = 0;
+        for (; i < len; ++i) {
+            unsigned digit = static_cast<unsigned char>(p[i]) - '0';
+            if (digit > 9) break;
+            value = value * 10 + digit;
+        }
+        if (i == len) {
+            out->value.i = value;
+            out->type = value <= INT_MAX ? LIT_INT : value <= LONG_MAX ? LIT_LONG : LIT_LONG_LONG;
+            return finish(out, LIT_OK);
+        }
+    }
+
+    if (len > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        for (const char* q = p + 2; q < end; ++q)
+            if (*q == '.' || *q == 'p' || *q == 'P') return decodeFloat(p + 2, end, true, out);
+        return decodeInt(p + 2, end, 16, out);
+    }
+    if (len > 2 && p[0] == '0' && (p[1] == 'b' || p[1] == 'B'))
+        return decodeInt(p + 2, end, 2, out);
+
+    for (const char* q = p; q < end; ++q)
+        if (*q == '.' || *q == 'e' || *q == 'E') return decodeFloat(p, end, false, out);
+
+    // the leading 0 is an octal digit too, so 0'1 keeps its separator between digits
+    if (p[0] == '0' && len > 1 && p[1] != 'u' && p[1] != 'U' && p[1] != 'l' && p[1] != 'L')
+        return decodeInt(p, end, 8, out);
+    return decodeInt(p, end, 10, out);
+}
+
+
+extern "C" int literal_is_float(const literal* lit) {
+    return lit->type == LIT_FLOAT || lit->type == LIT_DOUBLE || lit->type == LIT_LONG_DOUBLE;
+}
+
+
+extern "C" const char* literal_type_name(lit_type type) {
+    switch (type) {
+        case LIT_INT: return "int";
+        case LIT_UNSIGNED: return "unsigned int";
+        case LIT_LONG: return "long";
+        case LIT_UNSIGNED_LONG: return "unsigned long";
+        case LIT_LONG_LONG: return "long long";
+        case LIT_UNSIGNED_LONG_LONG: return "unsigned long long";
+        case LIT_FLOAT: return "float";
+        case LIT_DOUBLE: return "double";
+        case LIT_LONG_DOUBLE: return "long double";
+    }
+    return "?";
+}
+
+
+extern "C" const char* literal_status_message(const literal* lit) {
+    switch (lit->status) {
+        case LIT_OK:
+            return nullptr;
+        case LIT_INVALID:
+            return "invalid numeric literal";
+        case LIT_OVERFLOW:
+            if (!literal_is_float(lit))
+                return "integer literal is too large to be represented in any integer type";
+            if (lit->type == LIT_FLOAT)
+                return "floating-point literal is out of range for type 'float'";
+            return "floating-point literal is out of range for type 'double'";
+        case LIT_UNDERFLOW:
+            if (lit->type == LIT_FLOAT)
+                return "magnitude of floating-point literal is too small for type 'float', value is 0";
+            return "magnitude of floating-point literal is too small for type 'double', value is 0";
+    }
+    return nullptr;
+}
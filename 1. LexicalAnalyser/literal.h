@@ -0,0 +1,63 @@
+#ifndef LITERAL_H
+#define LITERAL_H
+
+/*
+    Numeric literal decoder shared by the lexical analyzer and the ast.l front end.
+
+    Accepts C++ integer literals (decimal, 0x hex, 0 octal, 0b binary), floating
+    literals (decimal with exponent, 0x hex with p exponent), ' digit separators
+    and the u/l/ll/f suffixes. The type follows the C++ rules: an unsuffixed
+    decimal integer is the first of int, long, long long that holds it, while
+    hex, octal and binary also try the unsigned types. Plain decimal integers
+    take a one-pass fast path; everything else is parsed by std::from_chars on
+    the token itself, or on a stack copy with the separators removed, so
+    nothing is allocated.
+
+    Usable from C: the front end is C, the analyzer C++.
+*/
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum lit_type{
+    LIT_INT,
+    LIT_UNSIGNED,
+    LIT_LONG,
+    LIT_UNSIGNED_LONG,
+    LIT_LONG_LONG,
+    LIT_UNSIGNED_LONG_LONG,
+    LIT_FLOAT,
+    LIT_DOUBLE,
+    LIT_LONG_DOUBLE
+};
+
+enum lit_status{
+    LIT_OK,
+    LIT_OVERFLOW,   //too large for any type allowed by its suffix; value saturates
+    LIT_UNDERFLOW,  //nonzero but too small for its floating type; value is 0
+    LIT_INVALID     //not a well-formed literal
+};
+
+typedef struct literal{
+    enum lit_type type;
+    enum lit_status status;
+    union{
+        unsigned long long i;       //integer types, as bits
+        double f;                   //floating types
+    }value;
+}literal;
+
+enum lit_status decode_literal(const char *text, size_t len, literal *out);
+
+int literal_is_float(const literal *lit);
+const char *literal_type_name(enum lit_type type);
+const char *literal_status_message(const literal *lit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,145 @@
+#include <stdlib.h>
+
+#include "alloc.h"
+
+typedef struct alloc_stats{
+    unsigned long long count;		//blocks allocated
+    unsigned long long bytes;		//bytes allocated
+    unsigned long long frees;
+    long long live;					//bytes allocated here and not yet freed
+    long long peak;
+}alloc_stats;
+
+//kept at 16 bytes so the block after it stays suitably aligned
+typedef struct alloc_header{
+    unsigned int size;
+    unsigned char site;
+    unsigned char phase;
+    unsigned short pad;
+    unsigned long long magic;
+}alloc_header;
+
+#define ALLOC_MAGIC 0x616c6c6f63686472ULL
+
+static const char *site_names[ALLOC_NSITES] = {
+    "Node", "tree_stack", "struct node", "xref uses"
+};
+
+static const char *phase_names[ALLOC_NPHASES] = {
+    "yyparse", "cleansymbol", "preorder"
+};
+
+static int enabled = 0;
+static enum alloc_phase current = ALLOC_PHASE_PARSE;
+
+static alloc_stats sites[ALLOC_NSITES];
+static alloc_stats phases[ALLOC_NPHASES];
+static long long live_total = 0, peak_total = 0;
+static long long phase_peak[ALLOC_NPHASES];	//peak of live_total while each phase ran
+
+
+void alloc_enable(void){
+	enabled = 1;
+}
+
+
+void alloc_set_phase(enum alloc_phase phase){
+	current = phase;
+	if(live_total > phase_peak[phase])
+		phase_peak[phase] = live_total;
+}
+
+
+static void account(alloc_stats *s, long long delta){
+	s->live += delta;
+	if(s->live > s->peak)
+		s->peak = s->live;
+}
+
+
+void *xmalloc(size_t size, enum alloc_site site){
+	if(!enabled)
+		return malloc(size);
+
+	alloc_header *h = (alloc_header*)malloc(sizeof(alloc_header) + size);
+	if(h == NULL)
+		return NULL;
+	h->size = (unsigned int)size;
+	h->site = (unsigned char)site;
+	h->phase = (unsigned char)current;
+	h->magic = ALLOC_MAGIC;
+
+	sites[site].count++;
+	sites[site].bytes += size;
+	phases[current].count++;
+	phases[current].bytes += size;
+	account(&sites[site], size);
+	account(&phases[current], size);
+
+	live_total += size;
+	if(live_total > peak_total)
+		peak_total = live_total;
+	if(live_total > phase_peak[current])
+		phase_peak[current] = live_total;
+
+	return h + 1;
+}
+
+
+void xfree(void *ptr){
+	if(ptr == NULL)
+		return;
+	if(!enabled){
+		free(ptr);
+		return;
+	}
+
+	alloc_header *h = (alloc_header*)ptr - 1;
+	if(h->magic != ALLOC_MAGIC){
+		fprintf(stderr, "alloc: xfree of a block not from xmalloc (%p)\n", ptr);
+		abort();
+	}
+	h->magic = 0;
+
+	sites[h->site].frees++;
+	account(&sites[h->site], -(long long)h->size);
+	//freed bytes are charged back to the phase that allocated them
+	phases[h->phase].frees++;
+	account(&phases[h->phase], -(long long)h->size);
+	live_total -= h->size;
+
+	free(h);
+}
+
+
+static void print_row(FILE *fp, const char *name, alloc_stats *s, long long peak){
+	fprintf(fp, "%14s %10llu %12llu %10llu %12lld %12lld\n",
+		name, s->count, s->bytes, s->frees, s->live, peak);
+}
+
+
+void alloc_report(FILE *fp){
+	if(!enabled)
+		return;
+
+	fprintf(fp, "\nAllocation Summary\n\n");
+	fprintf(fp, "%14s %10s %12s %10s %12s %12s\n",
+		"Phase", "Allocs", "Bytes", "Frees", "Live", "Peak");
+	for(int p = 0; p < ALLOC_NPHASES; p++)
+		print_row(fp, phase_names[p], &phases[p], phase_peak[p]);
+
+	fprintf(fp, "\n%14s %10s %12s %10s %12s %12s\n",
+		"Site", "Allocs", "Bytes", "Frees", "Live", "Peak");
+	for(int i = 0; i < ALLOC_NSITES; i++)
+		print_row(fp, site_names[i], &sites[i], sites[i].peak);
+
+	fprintf(fp, "\nPeak live: %lld bytes\n", peak_total);
+
+	for(int i = 0; i < ALLOC_NSITES; i++){
+		alloc_stats *s = &sites[i];
+		if(s->live > 0)
+			fprintf(fp, "leak: %s: %llu blocks, %lld bytes never freed\n",
+				site_names[i], s->count - s->frees, s->live);
+	}
+	fprintf(fp, "\n");
+}
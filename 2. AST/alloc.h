@@ -0,0 +1,40 @@
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/*
+    Allocation accounting for the front end.
+    Every AST node, tree stack cell and symbol goes through xmalloc()/xfree().
+    With accounting off (the default) they are plain malloc()/free(); with
+    alloc_enable() each block carries a small header recording its size, site
+    and the phase it was allocated in, so the exit report can show count,
+    bytes, live bytes and peak per phase and per site, and list the blocks
+    that were never freed.
+*/
+
+enum alloc_site{
+    ALLOC_NODE,			//Node, the AST
+    ALLOC_TREE_STACK,	//tree_stack cells
+    ALLOC_SYMBOL,		//struct node, the symbol table
+    ALLOC_XREF,			//use arrays of the cross-reference index
+    ALLOC_NSITES
+};
+
+enum alloc_phase{
+    ALLOC_PHASE_PARSE,
+    ALLOC_PHASE_CLEANSYMBOL,
+    ALLOC_PHASE_PREORDER,
+    ALLOC_NPHASES
+};
+
+void alloc_enable(void);
+void alloc_set_phase(enum alloc_phase phase);
+
+void *xmalloc(size_t size, enum alloc_site site);
+void xfree(void *ptr);
+
+void alloc_report(FILE *fp);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef AST_H
+#define AST_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "srcpos.h"
+
+//symbol table entry
+struct node{
+    char token[20];
+    char name[20];
+    int dtype;
+    int scope;
+    srcpos offset;		//where it was first seen
+    int valid;
+    union value{
+        float f;
+        int i;
+        char c;
+    }val;
+    uint32_t uses;		//its slot in xref.c's use table, 0 if never used
+    struct node *link;
+};
+
+typedef struct Node{
+    struct Node *left;   // init
+    struct Node *right;  // cond
+    struct Node *val;    // incr
+    struct Node *body;   // body
+    char token[100];
+    int level;
+    srcpos offset;
+    int type;			//leaves: dtype of their symbol or literal, else -1
+}Node;
+
+typedef struct tree_stack{
+    Node *node;
+    struct tree_stack *next;
+}tree_stack;
+
+extern struct node *first;
+extern tree_stack *tree_top;
+extern char preBuf[];
+extern int scope;
+extern int embedded;			//set by minicc.c: no symbol table printout or snapshot files
+extern void (*yylex_hook)(int token, srcpos at);
+
+struct node * checksym(char *);
+void addsymbol(struct node *,char *);	
+void addInt(struct node *, int, int);
+void addFloat(struct node *, int, float);
+void addChar(struct node *, int, char);
+void addArray(struct node *, int, int);
+void addfunc(struct node *t, int, char *);
+void printsymtable();
+
+struct node * addtosymbol(struct node * n);
+void cleansymbol();
+
+//AST 
+void create_node(char *token, int leaf, srcpos offset);
+void type_leaf(int dtype);
+const char *leaf_type_name(const Node *n);	//"int", "float" or "char" for a typed leaf, else NULL
+void push_tree(Node *newnode);
+Node *pop_tree();
+void preorder(Node* root);
+void printtree(Node* root);
+int getmaxlevel(Node *root);
+void printGivenLevel(Node* root, int level, int h);
+void get_levels(Node *root, int level);
+
+char *read_input(FILE *fp, size_t *len);
+void frontend_reset(void);
+int frontend_parse(void);			//yyparse, then the diagnostics
+void lex_reset(FILE *in);		//ast.l
+
+#endif
@@ -4,12 +4,27 @@
     #include <string.h>
     #include <limits.h>
 
+    #include "ast.h"
+    #include "trace.h"
+    #include "perf.h"
+    #include "alloc.h"
+    #include "pch.h"
+    #include "symtab.h"
+    #include "xref.h"
+    #include "sema.h"
+    #include "diag.h"
+
     void yyerror(const char*);
     int yylex();
+    static int traced_yylex(void);
+    #define yylex traced_yylex
     extern FILE * yyin, *yyout;
 
+    //a symbol's location is where it starts: its first child, or where the
+    //previous symbol started if it is empty
+    #define YYLLOC_DEFAULT(Cur, Rhs, N)	((Cur) = (N) ? YYRHSLOC(Rhs, 1) : YYRHSLOC(Rhs, 0))
+
     int x=0;	
-    extern int line;
     int scope = 0;
 
     int unaryop = -1;		//unary operator type
@@ -21,62 +36,26 @@
 
     char tempStr[100];		//sprintf
 
-    struct node{
-        char token[20];
-        char name[20];
-        int dtype;
-        int scope;
-        int lineno;
-        int valid;
-        union value{
-            float f;
-            int i;
-            char c;
-        }val;
-        struct node *link;
-    }*first = NULL, *tmp, *crt, *lhs;
-
-    typedef struct Node{
-        struct Node *left;   // init
-        struct Node *right;  // cond
-        struct Node *val;    // incr
-        struct Node *body;   // body
-        char token[100];
-        int level;
-    }Node;
-
-    typedef struct tree_stack{
-        Node *node;
-        struct tree_stack *next;
-    }tree_stack;
+    //node tokens of the assignment operators, by assignop
+    static const char *const assign_tokens[] = {"=", "+=", "-=", "*=", "/=", "%="};
+
+    struct node *first = NULL, *tmp, *crt, *lhs;
 
     tree_stack *tree_top = NULL;
     char preBuf[1000000];
 
-    struct node * checksym(char *);
-    void addsymbol(struct node *,char *);	
-    void addInt(struct node *, int, int);
-    void addFloat(struct node *, int, float);
-    void addChar(struct node *, int, char);
-    void addfunc(struct node *t, int, char *);
-    void printsymtable();
-
-    struct node * addtosymbol(struct node * n);
-    void cleansymbol();
-
-    //AST 
-    void create_node(char *token, int leaf);
-    void push_tree(Node *newnode);
-    Node *pop_tree();
-    void preorder(Node* root);
-    void printtree(Node* root);
-    int getmaxlevel(Node *root);
-    void printGivenLevel(Node* root, int level, int h);
-    void get_levels(Node *root, int level);
+    static const char *pch_out = NULL;		//--emit-pch: parse a header into this file
+    static const char *symtab_out = NULL;	//--symtab: binary symbol table snapshot
+    static const char *xref_out = NULL;		//--xref: use-def index
+
+    int embedded = 0;
+    void (*yylex_hook)(int token, srcpos at) = NULL;	//sees every token the parser reads
 %}
 
+%locations
+
 %token  HASH INCLUDE IOSTREAM
-%token  STRING_LITERAL HEADER_LITERAL PRINT RETURN
+%token  STRING_LITERAL PRINT RETURN
 %left 	'+' '-'
 %left 	'/' '*' '%'
 %right 	'='
@@ -93,6 +72,7 @@
 %token <cval> 	CHARACTER_LITERAL
 %token <fval> 	FLOAT_LITERAL 
 %token <ptr> 	IDENTIFIER  
+%token <string>	HEADER_LITERAL
 
 %token	INC_OP  DEC_OP 	LE_OP 	GE_OP 	EQ_OP 	NE_OP
 %token	MUL_ASSIGN 	DIV_ASSIGN 	MOD_ASSIGN 	ADD_ASSIGN 	SUB_ASSIGN
@@ -116,18 +96,47 @@
 
 %%
 S : program {
+                trace_begin("sema");
+                sema_check(tree_top, pch_loaded_roots());
+                diag_flush();
+                trace_end();
+                trace_begin("cleansymbol");
+                perf_phase_begin(PERF_PHASE_CLEANSYMBOL);
+                alloc_set_phase(ALLOC_PHASE_CLEANSYMBOL);
                 cleansymbol();	
-                printsymtable();
+                alloc_set_phase(ALLOC_PHASE_PARSE);
+                perf_phase_end(PERF_PHASE_CLEANSYMBOL);
+                trace_end();
+                if(pch_out == NULL && !embedded){
+                    trace_begin("printsymtable");
+                    printsymtable();
+                    trace_end();
+                    trace_begin("symtab_write");
+                    if(symtab_out != NULL)
+                        symtab_write(symtab_out, first);
+                    if(xref_out != NULL)
+                        xref_write(xref_out, first);
+                    trace_end();
+                }
                 return 0;
             }
   
 
 program
-    : HASH INCLUDE '<' libraries '>' program
-    | HASH INCLUDE HEADER_LITERAL 	 program
+    : include_list translation_unit
     | translation_unit
     ;
 
+include_list
+    : include
+    | include_list include
+    ;
+
+include
+    : HASH INCLUDE '<' libraries '>'
+    | HASH INCLUDE HEADER_LITERAL		{ include_header($3, @3); }
+    ;
+
 translation_unit
     : ext_dec
     | translation_unit ext_dec
@@ -151,7 +160,7 @@ block_item_list
     : block_item
     | block_item_list block_item 	
             {
-                create_node("stmt", 0);
+                create_node("stmt", 0, @$);
             }
     ;
 
@@ -161,7 +170,7 @@ block_item
     | function_call ';'
     | RETURN expression_statement	
             {
-                create_node("return", 1);
+                create_node("return", 1, @1);
             }
     | printstat ';'
     ;
@@ -199,11 +208,14 @@ condition_statement
             // AST: if (cond, then)
             Node *then_stmt = pop_tree();
             Node *cond = pop_tree();
-            Node *if_node = (Node*)malloc(sizeof(Node));
+            Node *if_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(if_node->token, "if");
             if_node->left = cond;
             if_node->right = then_stmt;
             if_node->val = NULL; // No else branch
+            if_node->body = NULL;
+            if_node->offset = @1;
+            if_node->type = -1;
             push_tree(if_node);
         }
     | IF '(' relational_expression ')' statement ELSE statement
@@ -212,11 +224,14 @@ condition_statement
             Node *else_stmt = pop_tree();
             Node *then_stmt = pop_tree();
             Node *cond = pop_tree();
-            Node *if_node = (Node*)malloc(sizeof(Node));
+            Node *if_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(if_node->token, "if");
             if_node->left = cond;
             if_node->right = then_stmt;
             if_node->val = else_stmt; // Attach else as third child
+            if_node->body = NULL;
+            if_node->offset = @1;
+            if_node->type = -1;
             push_tree(if_node);
         }
 ;
@@ -231,17 +246,19 @@ iteration_statement
             Node *incr = pop_tree();
             Node *cond = pop_tree();
             Node *init = pop_tree();
-            Node *for_node = (Node*)malloc(sizeof(Node));
+            Node *for_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(for_node->token, "for");
             for_node->left = init;
             for_node->right = cond;
             for_node->val = incr;
             for_node->body = body;
+            for_node->offset = @1;
+            for_node->type = -1;
             push_tree(for_node);
         }
     | WHILE '(' relational_expression ')' statement 
             {
-                create_node("while", 0); 
+                create_node("while", 0, @1); 
             }
     ;
 
@@ -258,12 +275,12 @@ init_declarator_list
     ;
 
 init_declarator
-    : IDENTIFIER { create_node($1->name, 1); } '=' assignment_expression
+    : IDENTIFIER { create_node($1->name, 1, @1); type_leaf(datatype); } '=' assignment_expression
                     {	
                         if($1->dtype !=- 1 && $1->scope < scope && $1->valid == 1){
 																		
 							struct node *ftp, *nnode;
-							nnode = (struct node *)malloc(sizeof(struct node));
+							nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 							ftp = first;
 							while(ftp->link!=NULL){
 								ftp = ftp->link;
@@ -272,94 +289,47 @@ init_declarator
 							ftp->link = nnode;
 							nnode->link = NULL;
 							$1 = nnode;
+							$1->offset = @1;
 
 							if (datatype == 0){	
 								
 								addInt($1, 0, $4);
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'int\' \n\n");
-								}
 							}
 							else if(datatype == 1){
 								
 								addFloat($1, 1, $4);
-								if(assigntype == 2){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'char\' to \'float\' \n\n");
-								}
 							}
 							else if(datatype == 2){
 								float tempf = (float)$4;
 								addChar($1, 2, (int)tempf);
-
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'char\' \n\n");
-								}
 							}
 							x = datatype;
 							
-							create_node("=", 0);
+							create_node("=", 0, @3);
 
 						}
 
 						
 						else if($1->dtype !=- 1){
 
-								printf("Line:%d: ", line);
-								printf("\033[1;31m");
-								printf("error: ");
-								printf("\033[0m");
-								printf("redefinition of \'%s\' \n",  $1->name);
+								diag_report(@1, DIAG_ERROR, "redefinition of \'%s\' \n",  $1->name);
 						}
 						else{
 							
 							
-							create_node("=", 0);
+							create_node("=", 0, @3);
 
 							if (datatype == 0){	
 								
 								addInt($1, 0, $4);
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'int\' \n\n");
-								}
 							}
 							else if(datatype == 1){
 								
 								addFloat($1, 1, $4);
-								if(assigntype == 2){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'char\' to \'float\' \n\n");
-								}
 							}
 							else if(datatype == 2){
 								float tempf = (float)$4;
 								addChar($1, 2, (int)tempf);
-
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'char\' \n\n");
-								}
 							}
 							x = datatype;
 							
@@ -372,7 +342,7 @@ init_declarator
 							// printf("case 1 \n" );
 																		
 							struct node *ftp, *nnode;
-							nnode = (struct node *)malloc(sizeof(struct node));
+							nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 							ftp = first;
 							while(ftp->link!=NULL){
 								ftp = ftp->link;
@@ -381,6 +351,7 @@ init_declarator
 							ftp->link = nnode;
 							nnode->link = NULL;							
 							$1 = nnode;
+							$1->offset = @1;
 							
 							if (datatype == 0){	
 								addInt($1, 0, INT_MIN);
@@ -397,15 +368,12 @@ init_declarator
 							char buff[20];
 							strcpy(buff, "Dc ");
 							strcat(buff, $1->name);
-							create_node(buff, 1);
+							create_node(buff, 1, @1);
+							type_leaf(datatype);
 
 						}
 						else if($1->dtype !=- 1 ){
-							printf("Line:%d: ", line);
-							printf("\033[1;31m");
-							printf("error: ");
-							printf("\033[0m");
-							printf("redefinition of \'%s\' \n", $1->name);
+							diag_report(@1, DIAG_ERROR, "redefinition of \'%s\' \n", $1->name);
 						
 						}else{
 							
@@ -425,49 +393,67 @@ init_declarator
 							char buff[20];
 							strcpy(buff, "Dc ");
 							strcat(buff, $1->name);
-							create_node(buff, 1);
+							create_node(buff, 1, @1);
+							type_leaf(datatype);
 						
 						}
 					}
+    | IDENTIFIER '[' INTEGER_LITERAL ']'
+					{
+						if($1->dtype != -1 && !($1->scope < scope && $1->valid == 1)){
+							diag_report(@1, DIAG_ERROR, "redefinition of \'%s\' \n", $1->name);
+						}
+						else if($3 <= 0){
+							diag_report(@3, DIAG_ERROR, "array \'%s\' must have a positive size \n", $1->name);
+						}
+						else{
+							//shadows a symbol of an outer scope
+							if($1->dtype != -1){
+								struct node *ftp, *nnode;
+								nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
+								ftp = first;
+								while(ftp->link!=NULL){
+									ftp = ftp->link;
+								}
+								addsymbol(nnode,$1->name);
+								ftp->link = nnode;
+								nnode->link = NULL;
+								$1 = nnode;
+								$1->offset = @1;
+							}
+							addArray($1, datatype, $3);
+							x = datatype;
+
+							//"Dc a[100]", so the dump carries the size
+							char buff[48];
+							snprintf(buff, sizeof(buff), "Dc %s[%d]", $1->name, $3);
+							create_node(buff, 1, @1);
+							type_leaf(datatype);
+						}
+					}
     ;
 
 
 assignment_expression
     : conditional_expression	{	$$ = $1; }
     | unary_expression	{ crt = lhs; } assignment_operator assignment_expression 	//$1 = $4
-            {							
-				switch(assignop){
+            {
+				//an element's value is not tracked: only its node is made
+				if(idcheck == 1 && crt != NULL && strcmp(crt->token, "array") == 0){
+					create_node((char*)assign_tokens[assignop], 0, @3);
+					crt = NULL;
+				}
+				else switch(assignop){
 					case 0: if(idcheck == 1){
-								create_node("=", 0);
+								create_node("=", 0, @3);
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)$4;
 									
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = $4;
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)$4);
 								}
 							}
@@ -478,35 +464,14 @@ assignment_expression
 							break;
 
 					case 1: if(idcheck == 1){
-								create_node("+=", 0);
+								create_node("+=", 0, @3);
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)$1 + (int)$4;
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = $1+ $4;
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)$1 + (int)$4);
 								}
 							}
@@ -517,35 +482,14 @@ assignment_expression
 							break;
 
 					case 2:	if(idcheck == 1){
-							create_node("-=", 0);
+							create_node("-=", 0, @3);
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)$1 - (int)$4;
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = $1 - $4;
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)$1 - (int)$4);
 								}
 							}
@@ -556,35 +500,14 @@ assignment_expression
 							break;
 
 					case 3:	if(idcheck == 1){
-								create_node("*=", 0);
+								create_node("*=", 0, @3);
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)$1 * (int)$4;
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = $1 * $4;
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)$1 * (int)$4);
 								}
 							}
@@ -595,35 +518,14 @@ assignment_expression
 							break;
 
 					case 4:	if(idcheck == 1){
-								create_node("/=", 0);
+								create_node("/=", 0, @3);
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)$1 / (int)$4;
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = $1 / $4;
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)$1 / (int)$4);
 								}
 							}
@@ -634,35 +536,14 @@ assignment_expression
 							break;
 
 					case 5:	if(idcheck == 1){
-								create_node("%=", 0);
+								create_node("%=", 0, @3);
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)$1 % (int)$4;
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = (int)$1 % (int)$4;
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)$1 % (int)$4);
 								}
 							}
@@ -700,11 +581,14 @@ conditional_expression
             Node *else_expr = pop_tree();
             Node *then_expr = pop_tree();
             Node *cond = pop_tree();
-            Node *if_node = (Node*)malloc(sizeof(Node));
+            Node *if_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(if_node->token, "if");
             if_node->left = cond;
             if_node->right = then_expr;
             if_node->val = else_expr;
+            if_node->body = NULL;
+            if_node->offset = @2;
+            if_node->type = -1;
             push_tree(if_node);
 
             if($1 == 1){
@@ -734,11 +618,7 @@ primary_expression
 
                     if($1->dtype == -1 && check_un == 0){
 
-						printf("Line:%d: ", line);
-						printf("\033[1;31m");
-						printf("error: ");
-						printf("\033[0m");
-						printf("use of undeclared identifier \'%s\' \n\n", $1->name);
+						diag_report(@1, DIAG_ERROR, "use of undeclared identifier \'%s\' \n\n", $1->name);
 
 						check_un = 0;		// set check_un = -1
 
@@ -746,17 +626,23 @@ primary_expression
 					else if($1->dtype == 0){
 						$$ = $1->val.i;
 						assigntype = 0;
-						create_node($1->name, 1);
+						create_node($1->name, 1, @1);
+						type_leaf($1->dtype);
+						xref_add($1, @1);
 					}
 					else if($1->dtype == 1){
 						$$ = $1->val.f;
 						assigntype = 1;
-						create_node($1->name, 1);
+						create_node($1->name, 1, @1);
+						type_leaf($1->dtype);
+						xref_add($1, @1);
 					}
 					else if($1->dtype == 2){
 						$$ = $1->val.c;
 						assigntype = 2;
-						create_node($1->name, 1);
+						create_node($1->name, 1, @1);
+						type_leaf($1->dtype);
+						xref_add($1, @1);
 					}
 						
 									
@@ -767,20 +653,25 @@ primary_expression
 					assigntype = 0;
 				
 					sprintf(tempStr, "%d", (int)$1);
-					create_node(tempStr, 1);
+					create_node(tempStr, 1, @1);
+					type_leaf(0);
 				}
 
 	| FLOAT_LITERAL	
 				{	
 					assigntype = 1;
 					sprintf(tempStr, "%f", $1);
-					create_node(tempStr, 1);
+					create_node(tempStr, 1, @1);
+					type_leaf(1);
 				}
 	| CHARACTER_LITERAL
 				{	
+					$$ = $1;
 					assigntype = 2;
-					sprintf(tempStr, "%c", $1);
-					create_node(tempStr, 1);
+					//its code, so the dump cannot mistake it for an identifier
+					sprintf(tempStr, "%d", (int)$1);
+					create_node(tempStr, 1, @1);
+					type_leaf(2);
 				}
 	| '(' expression ')'
 				{
@@ -790,8 +681,15 @@ primary_expression
 
 postfix_expression
 	: primary_expression		{	$$ = $1;	}
-	| postfix_expression INC_OP	{	$1++; $$ = $1;	create_node("++", 0); }	
-	| postfix_expression DEC_OP {	$1--; $$ = $1;	create_node("--", 0); }
+	| postfix_expression '[' { $<ptr>$ = lhs; } expression ']'
+				{
+					//the index's identifiers set lhs; an assignment is to the array
+					lhs = $<ptr>3;
+					$$ = 0;
+					create_node("[]", 0, @2);
+				}
+	| postfix_expression INC_OP	{	$1++; $$ = $1;	create_node("++", 0, @2); }	
+	| postfix_expression DEC_OP {	$1--; $$ = $1;	create_node("--", 0, @2); }
 	;
 
 unary_expression
@@ -799,12 +697,12 @@ unary_expression
 	| unary_operator unary_expression 
 				{
 					switch(unaryop){
-						case 1:	$$ = $2; create_node("'+'", 0); break;
-						case 2:	$$ = -$2; create_node("'-'", 0); break;
-						case 3:	$$ = !$2; create_node("!", 0); break;
-						case 4:	$$ = ~((int)$2); create_node("~", 0); break;	
-						case 5:	$$ = ++$2; create_node("++", 0); break;
-						case 6:	$$ = --$2; create_node("--", 0); break;		
+						case 1:	$$ = $2; create_node("'+'", 0, @1); break;
+						case 2:	$$ = -$2; create_node("'-'", 0, @1); break;
+						case 3:	$$ = !$2; create_node("!", 0, @1); break;
+						case 4:	$$ = ~((int)$2); create_node("~", 0, @1); break;	
+						case 5:	$$ = ++$2; create_node("++", 0, @1); break;
+						case 6:	$$ = --$2; create_node("--", 0, @1); break;		
 					}
 					unaryop = -1;
 				} 
@@ -824,12 +722,12 @@ equality_expression
     : relational_expression {	$$ = $1;	}
     | equality_expression EQ_OP relational_expression
                 { 
-                    create_node("==", 0);
+                    create_node("==", 0, @2);
                     $$ = ($1 == $3) ? 1 : 0;
                 }
     | equality_expression NE_OP relational_expression
                 { 
-                    create_node("!=", 0);
+                    create_node("!=", 0, @2);
                     $$ = ($1 != $3) ? 1 : 0;
                 }
     ;
@@ -838,22 +736,22 @@ relational_expression
     : additive_expression	{	$$ = $1;	}
     | relational_expression '<' additive_expression
                 { 
-                    create_node("<", 0);
+                    create_node("<", 0, @2);
                     $$ = ($1 < $3) ? 1 : 0;
                 }
     | relational_expression '>' additive_expression
                 { 
-                    create_node(">", 0);
+                    create_node(">", 0, @2);
                     $$ = ($1 > $3) ? 1 : 0;
                 }
     | relational_expression LE_OP additive_expression
                 { 
-                    create_node("<=", 0);
+                    create_node("<=", 0, @2);
                     $$ = ($1 <= $3) ? 1 : 0;
                 }
     | relational_expression GE_OP additive_expression
                 { 
-                    create_node(">=", 0);
+                    create_node(">=", 0, @2);
                     $$ = ($1 >= $3) ? 1 : 0;
                 }		
     ;
@@ -862,12 +760,12 @@ additive_expression
     : multiplicative_expression	{	$$ = $1;	}
     | additive_expression '+' multiplicative_expression 	
             {	
-                create_node("+", 0);
+                create_node("+", 0, @2);
                 $$ = $1 + $3;	
             }
     | additive_expression '-' multiplicative_expression		
             {	
-                create_node("-", 0);
+                create_node("-", 0, @2);
                 $$ = $1 - $3;	
             }
     ;
@@ -876,42 +774,34 @@ multiplicative_expression
     : unary_expression			{	$$ = $1;	}
     | multiplicative_expression '*' unary_expression 	
                     {	
-                        create_node("*", 0);	
+                        create_node("*", 0, @2);	
                         $$ = $1 * $3;	
                     }
     | multiplicative_expression '/' unary_expression	
                     {	
                         if($3 == 0){
-                            printf("Line:%d: ", line);
-                            printf("\033[1;35m"); 
-                            printf("warning: ");
-                            printf("\033[0m");
-                            printf("division by zero is undefined\n\n");
+                            diag_report(@3, DIAG_WARNING, "division by zero is undefined\n\n");
                             $$ = INT_MAX;		//junk value in real
                         }else{
                             $$ = $1 / $3;	
-                            create_node("/", 0);
+                            create_node("/", 0, @2);
                         }
                     }
     | multiplicative_expression '%' unary_expression	
                     {	
                         if(assigntype == 1){
-                            printf("Line:%d: ", line);
-                            printf("\033[1;31m");
-                            printf("error: ");
-                            printf("\033[0m");
-                            printf("invalid operands to binary expression (\'float\' and \'float\') \n\n");
+                            diag_report(@2, DIAG_ERROR, "invalid operands to binary expression (\'float\' and \'float\') \n\n");
                         }else{								
                             $$ = (int)$1 % (int)$3;	
-                            create_node("%", 0);
+                            create_node("%", 0, @2);
                         }
                     }
     ;
 
 function_definition
-    : type_specifier declarator compound_statement 	
+    : type_specifier declarator { trace_begin($2); } compound_statement 	
                 {
-                    create_node($2, 3);
+                    create_node($2, 3, @2);
                     struct node *ftp;
                     ftp = first;
                     while(ftp!=NULL){
@@ -924,15 +814,12 @@ function_definition
                         ftp=ftp->link;
                     }
                     scope--;
+                    trace_end();
                 }
-    | declarator compound_statement 									
+    | declarator { trace_begin($1); } compound_statement 									
                 {	
-                    create_node($1, 3);
-                    printf("Line:%d: ", line);
-                    printf("\033[1;35m"); 
-                    printf("warning: ");
-                    printf("\033[0m");
-                    printf("type specifier missing, defaults to \'int\' \n");
+                    create_node($1, 3, @1);
+                    diag_report(@1, DIAG_WARNING, "type specifier missing, defaults to \'int\' \n");
 
                     struct node *ftp;
                     ftp = first;
@@ -946,6 +833,7 @@ function_definition
                         ftp=ftp->link;
                     }
                     scope--;
+                    trace_end();
                 }
     ;
 
@@ -985,27 +873,89 @@ identifier_list
 
 
 void yyerror(const char *str){
-	fflush(stdout);
-	printf("Line:%d: ", line);
-	printf("\033[1;31m");
-	printf("error: ");
-	printf("\033[0m");
-	printf("%s\n", str);
+	diag_report(yylloc, DIAG_ERROR, "%s\n", str);
 }
 
 
-int main(){
-	yyout = fopen("output.c", "w");
+#ifndef FRONTEND_NO_MAIN
+int main(int argc, char *argv[]){
+	int counters = 0;
 
+	//headers missing from the cache are parsed by this program itself
+	pch_set_builder("/proc/self/exe");
+	for(int i = 1; i < argc; i++){
+		if(strncmp(argv[i], "--trace=", 8) == 0){
+			if(trace_open(argv[i] + 8) != 0)
+				return 1;
+		}
+		else if(strcmp(argv[i], "--counters") == 0){
+			counters = 1;
+		}
+		else if(strcmp(argv[i], "--alloc-stats") == 0){
+			alloc_enable();
+		}
+		else if(strncmp(argv[i], "-I", 2) == 0 && argv[i][2] != '\0'){
+			pch_add_include_dir(argv[i] + 2);
+		}
+		else if(strncmp(argv[i], "--pch-dir=", 10) == 0){
+			pch_set_cache_dir(argv[i] + 10);
+		}
+		else if(strncmp(argv[i], "--emit-pch=", 11) == 0){
+			pch_out = argv[i] + 11;
+		}
+		else if(strncmp(argv[i], "--pch-including=", 16) == 0){
+			pch_set_including(argv[i] + 16);
+		}
+		else if(strncmp(argv[i], "--symtab=", 9) == 0){
+			symtab_out = argv[i] + 9;
+		}
+		else if(strncmp(argv[i], "--xref=", 7) == 0){
+			xref_out = argv[i] + 7;
+		}
+		else if(strncmp(argv[i], "--jobs=", 7) == 0){
+			sema_set_jobs(atoi(argv[i] + 7));
+		}
+		else{
+			fprintf(stderr, "usage: %s [--trace=out.json] [--counters] [--alloc-stats] [-Idir] [--pch-dir=dir] [--symtab=symtab.bin] [--xref=xref.bin] [--jobs=n] < input.cpp\n", argv[0]);
+			return 1;
+		}
+	}
+
+	yyout = fopen(pch_out ? "/dev/null" : "output.c", "w");
+	lines_reset();
 
-	tree_top = (tree_stack*)malloc(sizeof(tree_stack));
+	//read the whole input up front so file I/O is its own phase
+	trace_begin("read");
+	size_t srclen;
+	char *src = read_input(stdin, &srclen);
+	yyin = fmemopen(src, srclen, "r");
+	trace_end();
+
+	if(counters)
+		perf_open();
+
+	tree_top = (tree_stack*)xmalloc(sizeof(tree_stack), ALLOC_TREE_STACK);
 	tree_top->node = NULL;
 	tree_top->next = NULL;
 	struct Node *root;
 
-	printf("\n");
-	yyparse();
+	//a header being precompiled: its symbols and trees go to the cache file
+	if(pch_out != NULL){
+		int status = frontend_parse() == 0 && !pch_include_failed() ? pch_write(pch_out, first, tree_top) : 1;
+		fclose(yyout);
+		return status == 0 ? 0 : 1;
+	}
 
+	printf("\n");
+	trace_begin("yyparse");
+	perf_phase_begin(PERF_PHASE_PARSE);
+	frontend_parse();
+	perf_phase_end(PERF_PHASE_PARSE);
+	trace_end();
+
+	trace_begin("preorder");
+	perf_phase_begin(PERF_PHASE_PREORDER);
+	alloc_set_phase(ALLOC_PHASE_PREORDER);
 	root = pop_tree();
 	get_levels(root, 1);
 
@@ -1015,10 +965,72 @@ int main(){
 	preorder(root);
 	printf("\n\nPreorder Traversal\n\n");
 	printf("%s\n", preBuf);
+	perf_phase_end(PERF_PHASE_PREORDER);
+	trace_end();
 
+	//stderr, so the GUIs' parsing of stdout is unaffected
+	perf_report(stderr, srclen);
+	perf_close();
+	alloc_report(stderr);
+
+	fclose(yyin);
+	free(src);
 	fclose(yyout);
+	trace_close();
 	return 0;
 }
+#endif
+
+
+//yyparse, with the diagnostics printed either way: after a syntax error the
+//S action never ran, so the trees built before it are checked here
+int frontend_parse(void){
+	int status = yyparse();
+	if(status != 0){
+		trace_begin("sema");
+		sema_check(tree_top, pch_loaded_roots());
+		diag_flush();
+		trace_end();
+	}
+	return status;
+}
+
+
+//back to the state before the first parse; the caller frees the old trees and symbols
+void frontend_reset(void){
+	x = 0;
+	scope = 0;
+	unaryop = -1;
+	assignop = -1;
+	datatype = -1;
+	assigntype = -1;
+	idcheck = -1;
+	check_un = 0;
+	first = tmp = crt = lhs = NULL;
+	preBuf[0] = '\0';
+
+	tree_top = (tree_stack*)xmalloc(sizeof(tree_stack), ALLOC_TREE_STACK);
+	tree_top->node = NULL;
+	tree_top->next = NULL;
+	lines_reset();
+	pch_reset();
+	diag_reset();
+}
+
+
+char *read_input(FILE *fp, size_t *len){
+	size_t cap = 4096, n = 0, got;
+	char *buf = (char*)malloc(cap);
+	while((got = fread(buf + n, 1, cap - n, fp)) > 0){
+		n += got;
+		if(n == cap){
+			cap *= 2;
+			buf = (char*)realloc(buf, cap);
+		}
+	}
+	*len = n;
+	return buf;
+}
 
 
 void addfunc(struct node *t,int type, char *s){
@@ -1048,6 +1060,16 @@ void addFloat(struct node *t,int type,float val) {
 }
 
 
+//an array of size elements; the size is kept as its value
+void addArray(struct node *t, int type, int size) {
+	if(t->dtype == -1) {
+		t->dtype = type;
+		t->val.i = size;
+		strcpy(t->token, "array");
+	}
+}
+
+
 void addChar(struct node *t,int type, char val) {
    	if(t->dtype == -1) {
    	    t->dtype = type;
@@ -1079,7 +1101,7 @@ struct node * checksym(char *vname) {
 	struct node *same;
 	
 	if(first == NULL) {
-		nnode = (struct node *)malloc(sizeof(struct node));
+		nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 		addsymbol(nnode,vname);
 	    first = nnode;
 	}
@@ -1111,7 +1133,7 @@ struct node * checksym(char *vname) {
 	        rp = ftp;
 	        ftp = ftp->link;
 	    }
-	    nnode = (struct node *)malloc(sizeof(struct node));
+	    nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 		addsymbol(nnode,vname);
 
 	    rp->link = nnode;
@@ -1122,11 +1144,13 @@ struct node * checksym(char *vname) {
 
 void addsymbol(struct node *tp, char *vname) {
     strcpy(tp->name,vname);
+    tp->token[0] = '\0';
     tp->dtype = -1;
     tp->link = NULL;
     tp->scope = scope;
     tp->valid = 1;
-    tp->lineno = line;
+    tp->uses = 0;
+    tp->offset = yylloc;		//checksym runs inside the lexer, so this is the identifier's token
 }
 
 
@@ -1138,11 +1162,13 @@ void cleansymbol(){
  
         if (entry->dtype == -1  ) { 
             *pp = entry->link; 
-            free(entry); 
+            xref_release(entry);
+            xfree(entry); 
         }
         else if(strcmp(entry->name,"main")== 0 && strcmp(entry->token, "function")==0){	//remove main entry from symbol table
         	*pp = entry->link; 
-            free(entry); 
+            xref_release(entry);
+            xfree(entry); 
         }
         // Else move to next 
         else
@@ -1171,9 +1197,12 @@ void printsymtable(){
         if(ftp->dtype==3)
         	strcpy(data_type,"void");
 
-        printf("%11s\t%12s\t%6s\t\t%d\t\t%d\t\t",ftp->token, ftp->name, data_type, ftp->scope, ftp->lineno);
+        printf("%11s\t%12s\t%6s\t\t%d\t\t%d\t\t",ftp->token, ftp->name, data_type, ftp->scope, srcpos_line(ftp->offset));
 
-        if(ftp->dtype == 0){
+        if(strcmp(ftp->token, "array") == 0){
+        	printf("[%d]\n", ftp->val.i);
+        }
+        else if(ftp->dtype == 0){
         	if(ftp->val.i == INT_MIN)
         		printf("-\n");
         	else
@@ -1200,7 +1229,7 @@ void printsymtable(){
 }
 
 
-void create_node(char *token, int leaf) {
+void create_node(char *token, int leaf, srcpos offset) {
 	Node *l;
 	Node *r;
 	if(leaf==0) {
@@ -1217,16 +1246,32 @@ void create_node(char *token, int leaf) {
 		r = NULL;
 	}
 
-	Node *newnode = (Node*)malloc(sizeof(Node));
+	Node *newnode = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
 	strcpy(newnode->token, token);
 	newnode->left = l;
 	newnode->right = r;
+	newnode->val = NULL;
+	newnode->body = NULL;
+	newnode->offset = offset;
+	newnode->type = -1;
 	push_tree(newnode);
 }
 
 
+//the type sema.c gives the leaf just created
+void type_leaf(int dtype){
+	tree_top->node->type = dtype;
+}
+
+
+const char *leaf_type_name(const Node *n){
+	static const char *const names[] = {"int", "float", "char"};
+	return n->type >= 0 && n->type < 3 ? names[n->type] : NULL;
+}
+
+
 void push_tree(Node *newnode){
-	tree_stack *temp= (tree_stack*)malloc(sizeof(tree_stack));
+	tree_stack *temp= (tree_stack*)xmalloc(sizeof(tree_stack), ALLOC_TREE_STACK);
 	temp->node = newnode;
 	temp->next = tree_top;
 	tree_top = temp;
@@ -1234,11 +1279,15 @@ void push_tree(Node *newnode){
 
 
 Node* pop_tree(){
+	//never pop the sentinel: after an error has dropped a leaf (an undeclared
+	//identifier, a header that failed to load) the stack can run short
+	if(tree_top == NULL || tree_top->next == NULL)
+		return NULL;
 	tree_stack *temp = tree_top;
 	tree_top = tree_top->next;
 	Node *retnode = temp->node;
 	if(temp != NULL)
-		free(temp);
+		xfree(temp);
 	return retnode;
 }
 
@@ -1301,6 +1350,12 @@ void preorder(Node * node){
     if(node->left || node->right || node->val || node->body)
         strcat(preBuf, " ( ");
     strcat(preBuf, node->token);
+    //typed leaves carry their type to the ICG
+    const char *type = leaf_type_name(node);
+    if(type != NULL){
+        strcat(preBuf, ":");
+        strcat(preBuf, type);
+    }
     strcat(preBuf, " ");
 
     if(node->left) preorder(node->left);
@@ -1330,3 +1385,19 @@ void get_levels(Node *root, int level){
 		get_levels(root->right, level+1);
 	}
 }
+
+
+#undef yylex
+static int traced_yylex(void){
+	if(!trace_enabled() && !perf_enabled() && yylex_hook == NULL)
+		return yylex();
+
+	long long start = trace_now();
+	perf_phase_begin(PERF_PHASE_LEX);
+	int tok = yylex();
+	perf_phase_end(PERF_PHASE_LEX);
+	trace_complete("yylex", TRACE_TID_LEXER, start, trace_now());
+	if(yylex_hook != NULL)
+		yylex_hook(tok, yylloc);
+	return tok;
+}
@@ -1,10 +1,15 @@
 import os
 import subprocess
+import sys
+import time
 import ttkbootstrap as tb
 from ttkbootstrap.constants import *
 from tkinter import filedialog, messagebox, scrolledtext
 import threading
 
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+import build  # noqa: E402
+
 
 class ASTModuleGUI:
     def __init__(self, root):
@@ -93,30 +98,25 @@ class ASTModuleGUI:
 
         try:
             self.clear_output()
-            cmds = [
-                ["lex", "ast.l"],
-                ["yacc", "-d", "ast.y"],
-                ["gcc", "y.tab.c", "lex.yy.c"],
-            ]
-
-            for cmd in cmds:
-                self.append_output(f"Running: {' '.join(cmd)}\n")
-                process = subprocess.run(
-                    cmd, capture_output=True, text=True, cwd=self.script_dir
-                )
-                if process.returncode != 0:
-                    self.append_output(
-                        f"Error running {' '.join(cmd)}:\n{process.stderr}\n"
-                    )
-                    self.set_status("Error during compilation.")
-                    return
+            # lex, yacc and gcc run only when a source is newer than a.out
+            start = time.perf_counter()
+            try:
+                built = build.ensure(["frontend"], log=self.append_output)
+            except build.BuildError as e:
+                self.append_output(f"Error: {e}\n")
+                self.set_status("Error during compilation.")
+                return
+            elapsed = (time.perf_counter() - start) * 1000
+            state = "rebuilt" if built else "up to date"
+            self.append_output(f"Front end {state} ({elapsed:.0f} ms)\n")
 
             with open(cpp_file, "r") as input_file:
                 self.append_output(
                     f"\nExecuting ./a.out with input file {os.path.basename(cpp_file)}...\n"
                 )
                 final_process = subprocess.run(
-                    ["./a.out"],
+                    # headers are searched for beside the selected file
+                    ["./a.out", f"-I{os.path.dirname(os.path.abspath(cpp_file))}"],
                     stdin=input_file,
                     capture_output=True,
                     text=True,
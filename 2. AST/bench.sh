@@ -0,0 +1,4 @@
+lex ast.l
+yacc -d ast.y
+gcc -O2 -DFRONTEND_NO_MAIN -I"../1. LexicalAnalyser" y.tab.c lex.yy.c trace.c perf.c alloc.c srcpos.c diag.c pch.c symtab.c xref.c sema.c "../1. LexicalAnalyser/literal.cpp" bench_frontend.c -lstdc++ -pthread -o bench_frontend.out
+./bench_frontend.out
\ No newline at end of file
@@ -0,0 +1,313 @@
+/*
+    Microbenchmarks for the front end's data structures.
+
+    Each primitive is timed twice: "old" is a frozen copy of the baseline
+    implementation kept in this file, "new" is whatever ast.y currently
+    links in. When a data structure changes, the speedup column is its
+    measured justification; when nothing has changed the two should match.
+
+    Built against y.tab.c with -DFRONTEND_NO_MAIN, see bench.sh.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ast.h"
+
+#define REPEATS 5
+
+extern int check_un;
+
+static struct node *legacy_first = NULL;
+static tree_stack *legacy_top = NULL;
+static char legacy_buf[1000000];
+
+
+static double now_ns(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+
+static void report(const char *name, int size, double old_ns, double new_ns, int ops){
+	printf("%-28s %8d %12.1f %12.1f %8.2fx\n",
+		name, size, old_ns / ops, new_ns / ops, old_ns / new_ns);
+}
+
+
+/* ---- baseline implementations ---- */
+
+//the parser reaches create_node and the stack through calls into y.tab.c;
+//kept out of line so the copies here are not inlined into the timing loop
+#define LEGACY __attribute__((noinline))
+
+static struct node * legacy_checksym(char *vname) {
+	struct node *ftp;
+	struct node *rp;
+	struct node *nnode;
+
+	if(legacy_first == NULL) {
+		nnode = (struct node *)malloc(sizeof(struct node));
+		addsymbol(nnode,vname);
+		legacy_first = nnode;
+	}
+	else {
+		ftp = legacy_first;
+		while(ftp!=NULL) {
+			if(strcmp(vname,ftp->name) == 0){
+				if(ftp->scope > scope && ftp->valid == 1)
+					return ftp;
+				else if(ftp->scope == scope && ftp->valid == 1)
+					return ftp;
+				else if(ftp->scope < scope && ftp->valid == 1){
+					check_un = 1;
+					return ftp;
+				}
+				else if(ftp->scope > scope && ftp->valid == 0)
+					check_un = 0;
+			}
+			rp = ftp;
+			ftp = ftp->link;
+		}
+		nnode = (struct node *)malloc(sizeof(struct node));
+		addsymbol(nnode,vname);
+		rp->link = nnode;
+	}
+	return nnode;
+}
+
+
+LEGACY static void legacy_push_tree(Node *newnode){
+	tree_stack *temp= (tree_stack*)malloc(sizeof(tree_stack));
+	temp->node = newnode;
+	temp->next = legacy_top;
+	legacy_top = temp;
+}
+
+
+LEGACY static Node* legacy_pop_tree(){
+	tree_stack *temp = legacy_top;
+	legacy_top = legacy_top->next;
+	Node *retnode = temp->node;
+	free(temp);
+	return retnode;
+}
+
+
+LEGACY static void legacy_create_node(char *token, int leaf) {
+	Node *l = NULL;
+	Node *r = NULL;
+	if(leaf==0) {
+		r = legacy_pop_tree();
+		l = legacy_pop_tree();
+	}
+	else if(leaf != 1) {
+		l = legacy_pop_tree();
+	}
+
+	Node *newnode = (Node*)malloc(sizeof(Node));
+	strcpy(newnode->token, token);
+	newnode->left = l;
+	newnode->right = r;
+	newnode->val = NULL;
+	newnode->body = NULL;
+	legacy_push_tree(newnode);
+}
+
+
+static void legacy_preorder(Node * node){
+	if (node == NULL)
+		return;
+
+	if(node->left || node->right || node->val || node->body)
+		strcat(legacy_buf, " ( ");
+	strcat(legacy_buf, node->token);
+	if(leaf_type_name(node) != NULL){
+		strcat(legacy_buf, ":");
+		strcat(legacy_buf, leaf_type_name(node));
+	}
+	strcat(legacy_buf, " ");
+
+	if(node->left) legacy_preorder(node->left);
+	if(node->right) legacy_preorder(node->right);
+	if(node->val) legacy_preorder(node->val);
+	if(node->body) legacy_preorder(node->body);
+
+	if(node->left || node->right || node->val || node->body)
+		strcat(legacy_buf, ") ");
+}
+
+
+/* ---- helpers ---- */
+
+static void free_symbols(struct node *n){
+	while(n != NULL){
+		struct node *next = n->link;
+		free(n);
+		n = next;
+	}
+}
+
+
+static void free_tree(Node *n){
+	if(n == NULL)
+		return;
+	free_tree(n->left);
+	free_tree(n->right);
+	free_tree(n->val);
+	free_tree(n->body);
+	free(n);
+}
+
+
+static char (*make_names(int n))[20]{
+	char (*names)[20] = malloc(n * sizeof(*names));
+	for(int i = 0; i < n; i++)
+		sprintf(names[i], "v%d", i);
+	return names;
+}
+
+
+/* ---- benchmarks ---- */
+
+//inserts then looks up every name once; side 0 is the baseline
+static void time_checksym(int side, char (*names)[20], int nsyms, double *ins, double *look){
+	struct node *(*lookup)(char *) = side == 0 ? legacy_checksym : checksym;
+	double t0, t1, t2;
+
+	t0 = now_ns();
+	for(int i = 0; i < nsyms; i++)
+		lookup(names[i]);
+	t1 = now_ns();
+	for(int i = 0; i < nsyms; i++)
+		lookup(names[i]);
+	t2 = now_ns();
+	if(t1 - t0 < *ins) *ins = t1 - t0;
+	if(t2 - t1 < *look) *look = t2 - t1;
+	if(side == 0){
+		free_symbols(legacy_first);
+		legacy_first = NULL;
+	}
+	else{
+		cleansymbol();		//every entry is still dtype -1, so this empties the table
+		first = NULL;
+	}
+}
+
+
+//whichever side runs second gets the blocks the first one just freed, in
+//reverse order, so its list is scattered and it walks slower; alternate
+//which goes first so both sides' best run is on a fresh heap
+static void bench_checksym(int nsyms){
+	char (*names)[20] = make_names(nsyms);
+	double best_ins[2] = {1e300, 1e300}, best_look[2] = {1e300, 1e300};
+
+	for(int rep = 0; rep < REPEATS; rep++)
+		for(int k = 0; k < 2; k++){
+			int side = (rep + k) % 2;
+			time_checksym(side, names, nsyms, &best_ins[side], &best_look[side]);
+		}
+
+	report("checksym insert", nsyms, best_ins[0], best_ins[1], nsyms);
+	report("checksym lookup", nsyms, best_look[0], best_look[1], nsyms);
+	free(names);
+}
+
+
+//builds a left-leaning expression tree of n leaves the way the parser does
+static void time_tree(int side, int n, double *best){
+	double t0 = now_ns();
+	if(side == 0){
+		legacy_create_node("x", 1);
+		for(int i = 1; i < n; i++){
+			legacy_create_node("y", 1);
+			legacy_create_node("+", 0);
+		}
+	}
+	else{
+		create_node("x", 1, 0);
+		for(int i = 1; i < n; i++){
+			create_node("y", 1, 0);
+			create_node("+", 0, 0);
+		}
+	}
+	double t1 = now_ns();
+	free_tree(side == 0 ? legacy_pop_tree() : pop_tree());
+	if(t1 - t0 < *best) *best = t1 - t0;
+}
+
+
+static void bench_tree(int n){
+	double best[2] = {1e300, 1e300};
+
+	for(int rep = 0; rep < REPEATS; rep++)
+		for(int k = 0; k < 2; k++){
+			int side = (rep + k) % 2;
+			time_tree(side, n, &best[side]);
+		}
+
+	//2n-1 create_node calls, each with its push and pops
+	report("create/push/pop_tree", n, best[0], best[1], 2 * n - 1);
+}
+
+
+static Node *balanced_tree(int depth){
+	Node *n = (Node*)calloc(1, sizeof(Node));
+	if(depth == 0){
+		strcpy(n->token, "x");
+		n->type = 0;
+		return n;
+	}
+	n->type = -1;
+	strcpy(n->token, "+");
+	n->left = balanced_tree(depth - 1);
+	n->right = balanced_tree(depth - 1);
+	return n;
+}
+
+
+static void bench_preorder(int depth){
+	Node *root = balanced_tree(depth);
+	int nodes = (1 << (depth + 1)) - 1;
+	double best[2] = {1e300, 1e300};
+
+	for(int rep = 0; rep < REPEATS; rep++){
+		legacy_buf[0] = '\0';
+		double t0 = now_ns();
+		legacy_preorder(root);
+		double t1 = now_ns();
+		if(t1 - t0 < best[0]) best[0] = t1 - t0;
+
+		preBuf[0] = '\0';
+		t0 = now_ns();
+		preorder(root);
+		t1 = now_ns();
+		if(t1 - t0 < best[1]) best[1] = t1 - t0;
+	}
+
+	if(strcmp(legacy_buf, preBuf) != 0)
+		printf("preorder: output differs from the baseline!\n");
+	report("preorder", nodes, best[0], best[1], nodes);
+	free_tree(root);
+}
+
+
+int main(){
+	static const int symbol_counts[] = {10, 100, 1000, 5000};
+	static const int tree_sizes[] = {100, 10000, 100000};
+	static const int preorder_depths[] = {6, 9, 12};
+
+	tree_top = (tree_stack*)calloc(1, sizeof(tree_stack));
+	legacy_top = (tree_stack*)calloc(1, sizeof(tree_stack));
+
+	printf("%-28s %8s %12s %12s %9s\n", "benchmark", "size", "old ns/op", "new ns/op", "speedup");
+	for(size_t i = 0; i < sizeof(symbol_counts) / sizeof(symbol_counts[0]); i++)
+		bench_checksym(symbol_counts[i]);
+	for(size_t i = 0; i < sizeof(tree_sizes) / sizeof(tree_sizes[0]); i++)
+		bench_tree(tree_sizes[i]);
+	for(size_t i = 0; i < sizeof(preorder_depths) / sizeof(preorder_depths[0]); i++)
+		bench_preorder(preorder_depths[i]);
+	return 0;
+}
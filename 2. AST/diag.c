@@ -0,0 +1,61 @@
+#define _GNU_SOURCE		//vasprintf
+
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "diag.h"
+
+typedef struct diag{
+    srcpos at;
+    uint32_t seq;			//order of the reports, for a stable sort
+    int severity;
+    char *msg;
+}diag;
+
+static diag *diags = NULL;
+static uint32_t ndiags = 0, cap = 0;
+
+
+void diag_report(srcpos at, int severity, const char *fmt, ...){
+	if(ndiags == cap){
+		cap = cap ? cap * 2 : 16;
+		diags = realloc(diags, cap * sizeof(diag));
+	}
+	va_list ap;
+	va_start(ap, fmt);
+	if(vasprintf(&diags[ndiags].msg, fmt, ap) < 0)
+		diags[ndiags].msg = NULL;
+	va_end(ap);
+	diags[ndiags].at = at;
+	diags[ndiags].seq = ndiags;
+	diags[ndiags].severity = severity;
+	ndiags++;
+}
+
+
+static int by_position(const void *a, const void *b){
+	const diag *x = a, *y = b;
+	if(x->at != y->at)
+		return x->at < y->at ? -1 : 1;
+	return x->seq < y->seq ? -1 : x->seq > y->seq;
+}
+
+
+void diag_flush(void){
+	qsort(diags, ndiags, sizeof(diag), by_position);
+	for(uint32_t i = 0; i < ndiags; i++){
+		print_loc(diags[i].at);
+		printf(diags[i].severity == DIAG_ERROR ? "\033[1;31m" : "\033[1;35m");
+		printf(diags[i].severity == DIAG_ERROR ? "error: " : "warning: ");
+		printf("\033[0m");
+		printf("%s", diags[i].msg ? diags[i].msg : "");
+	}
+	diag_reset();
+}
+
+
+void diag_reset(void){
+	for(uint32_t i = 0; i < ndiags; i++)
+		free(diags[i].msg);
+	ndiags = 0;
+}
@@ -0,0 +1,23 @@
+#ifndef DIAG_H
+#define DIAG_H
+
+#include "srcpos.h"
+
+/*
+    Diagnostics of one parse, printed together in source order.
+    The grammar actions, the lexer, #include processing and sema find their
+    errors and warnings at different times and sema finds its own on several
+    threads, so nothing is printed where it is found: each report is kept
+    with its offset, and diag_flush sorts them by offset, reports at the same
+    offset in the order they were made, and prints them on stdout.
+*/
+
+enum { DIAG_ERROR, DIAG_WARNING };
+
+//fmt is the message after "error: " or "warning: ", with its own newlines
+void diag_report(srcpos at, int severity, const char *fmt, ...)
+	__attribute__((format(printf, 3, 4)));
+void diag_flush(void);
+void diag_reset(void);				//drop what was not printed
+
+#endif
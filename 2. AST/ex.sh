@@ -1,4 +1,4 @@
 lex ast.l
 yacc -d ast.y
-gcc y.tab.c lex.yy.c 
+gcc -I"../1. LexicalAnalyser" y.tab.c lex.yy.c trace.c perf.c alloc.c srcpos.c diag.c pch.c symtab.c xref.c sema.c "../1. LexicalAnalyser/literal.cpp" -lstdc++ -pthread
 ./a.out<input.cpp
\ No newline at end of file
@@ -0,0 +1,441 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "icg.h"
+
+//the converter's view of the tree: an atom, or a list of items
+typedef struct sx{
+    const char *atom;
+    struct sx **items;
+    size_t n, cap;
+}sx;
+
+
+static const char *keep(icg *g, char *s){
+	if(g->nstrings == g->strings_cap){
+		g->strings_cap = g->strings_cap ? g->strings_cap * 2 : 64;
+		g->strings = realloc(g->strings, g->strings_cap * sizeof(char*));
+	}
+	g->strings[g->nstrings++] = s;
+	return s;
+}
+
+
+static sx *sx_new(const char *atom){
+	sx *x = calloc(1, sizeof(sx));
+	x->atom = atom;
+	return x;
+}
+
+
+static void sx_add(sx *list, sx *item){
+	if(list->n == list->cap){
+		list->cap = list->cap ? list->cap * 2 : 4;
+		list->items = realloc(list->items, list->cap * sizeof(sx*));
+	}
+	list->items[list->n++] = item;
+}
+
+
+static void sx_free(sx *x){
+	for(size_t i = 0; i < x->n; i++)
+		sx_free(x->items[i]);
+	free(x->items);
+	free(x);
+}
+
+
+//the dump splits tokens on whitespace
+static void add_words(icg *g, sx *list, const char *token){
+	const char *p = token;
+	while(*p != '\0'){
+		while(*p == ' ')
+			p++;
+		const char *start = p;
+		while(*p != '\0' && *p != ' ')
+			p++;
+		if(p > start)
+			sx_add(list, sx_new(keep(g, strndup(start, p - start))));
+	}
+}
+
+
+static int is_name(const char *atom){
+	return atom != NULL && (isalpha((unsigned char)atom[0]) || atom[0] == '_');
+}
+
+
+static size_t hash(const char *s){
+	size_t h = 14695981039346656037u;	//FNV-1a
+	for(; *s != '\0'; s++)
+		h = (h ^ (unsigned char)*s) * 1099511628211u;
+	return h;
+}
+
+
+//the slot of name in g->slots: its var index + 1, or 0 where it would go
+static size_t *slot_of(const icg *g, const char *name){
+	size_t mask = g->nslots - 1;
+	for(size_t i = hash(name) & mask; ; i = (i + 1) & mask){
+		size_t *slot = &g->slots[i];
+		if(*slot == 0 || strcmp(g->vars[*slot - 1].name, name) == 0)
+			return slot;
+	}
+}
+
+
+static icg_var *find_var(const icg *g, const char *name){
+	if(g->nslots == 0)
+		return NULL;
+	size_t *slot = slot_of(g, name);
+	return *slot ? &g->vars[*slot - 1] : NULL;
+}
+
+
+static const char *type_of(const icg *g, const char *atom){
+	if(atom == NULL)
+		return "int";
+	if(!is_name(atom))
+		return strchr(atom, '.') != NULL ? "float" : "int";
+	const icg_var *v = find_var(g, atom);
+	return v != NULL ? v->type : "int";
+}
+
+
+//a name keeps the type it is first given
+static icg_var *set_type(icg *g, const char *name, const char *type){
+	icg_var *v = find_var(g, name);
+	if(v != NULL)
+		return v;
+	if(2 * (g->nvars + 1) > g->nslots){
+		free(g->slots);
+		g->nslots = g->nslots ? g->nslots * 2 : 64;
+		g->slots = calloc(g->nslots, sizeof(size_t));
+		for(size_t i = 0; i < g->nvars; i++)
+			*slot_of(g, g->vars[i].name) = i + 1;
+	}
+	if(g->nvars == g->vars_cap){
+		g->vars_cap = g->vars_cap ? g->vars_cap * 2 : 16;
+		g->vars = realloc(g->vars, g->vars_cap * sizeof(icg_var));
+	}
+	v = &g->vars[g->nvars++];
+	v->name = name;
+	v->type = type;
+	v->size = NULL;
+	v->declared = 0;
+	*slot_of(g, name) = g->nvars;
+	return v;
+}
+
+
+//usual arithmetic conversions: char becomes int
+static const char *arith_type(const char *a, const char *b){
+	return strcmp(a, "float") == 0 || strcmp(b, "float") == 0 ? "float" : "int";
+}
+
+
+static void add_node(icg *g, sx *list, const Node *n){
+	if(n->left == NULL && n->right == NULL && n->val == NULL && n->body == NULL){
+		size_t before = list->n;
+		add_words(g, list, n->token);
+		//the dump's name:type, as its last word
+		const char *type = leaf_type_name(n);
+		if(type != NULL && list->n > before && is_name(list->items[list->n - 1]->atom)){
+			const char *atom = list->items[list->n - 1]->atom;
+			const char *bracket = strchr(atom, '[');
+			if(bracket == NULL){
+				set_type(g, atom, type);
+				return;
+			}
+			//an array's declaration, "Dc a[100]"
+			icg_var *v = set_type(g, keep(g, strndup(atom, bracket - atom)), type);
+			if(v->size == NULL)
+				v->size = keep(g, strndup(bracket + 1, strcspn(bracket + 1, "]")));
+		}
+		return;
+	}
+	sx *sub = sx_new(NULL);
+	add_words(g, sub, n->token);
+	const Node *kids[4] = {n->left, n->right, n->val, n->body};
+	for(int i = 0; i < 4; i++)
+		if(kids[i] != NULL)
+			add_node(g, sub, kids[i]);
+	sx_add(list, sub);
+}
+
+
+static const char *new_temp(icg *g){
+	char buf[16];
+	snprintf(buf, sizeof(buf), "t%d", ++g->temps);
+	return keep(g, strdup(buf));
+}
+
+
+static const char *new_label(icg *g){
+	char buf[16];
+	snprintf(buf, sizeof(buf), "L%d", ++g->labels);
+	return keep(g, strdup(buf));
+}
+
+
+static void emit(icg *g, const char *op, const char *arg1, const char *arg2, const char *result){
+	if(g->ncode == g->cap){
+		g->cap = g->cap ? g->cap * 2 : 64;
+		g->code = realloc(g->code, g->cap * sizeof(tac));
+	}
+	tac *t = &g->code[g->ncode++];
+	t->op = op;
+	t->arg1 = arg1;
+	t->arg2 = arg2;
+	t->result = result;
+}
+
+
+static sx *item(const sx *x, size_t i){
+	return x != NULL && x->atom == NULL && i < x->n ? x->items[i] : NULL;
+}
+
+
+static int is(const sx *x, const char *atom){
+	return x != NULL && x->atom != NULL && strcmp(x->atom, atom) == 0;
+}
+
+
+//the four arithmetic operators first
+static const char *const binary_ops[][2] = {
+	{"+", "ADD"}, {"-", "SUB"}, {"*", "MUL"}, {"/", "DIV"},
+	{">", ">"}, {"<", "<"}, {"<=", "<="}, {">=", ">="}, {"==", "=="}, {"!=", "!="},
+};
+
+//compound assignments, and the operation each one does
+static const char *const compound_ops[][2] = {
+	{"+=", "ADD"}, {"-=", "SUB"}, {"*=", "MUL"}, {"/=", "DIV"},
+};
+
+
+static const char *convert_expression(icg *g, const sx *expr){
+	if(expr == NULL)
+		return NULL;
+	if(expr->atom != NULL)
+		return expr->atom;
+	const sx *op = item(expr, 0);
+	if(op == NULL || op->atom == NULL)
+		return NULL;
+
+	if(is(op, "=") && is(item(item(expr, 1), 0), "[]")){
+		const sx *array = item(item(expr, 1), 1);
+		const char *index = convert_expression(g, item(item(expr, 1), 2));
+		const char *value = convert_expression(g, item(expr, 2));
+		emit(g, "CHECK", array ? array->atom : NULL, index, NULL);
+		emit(g, "STORE", value, index, array ? array->atom : NULL);
+		return value;
+	}
+	if(is(op, "=")){
+		const sx *target = item(expr, 1);
+		const char *value = convert_expression(g, item(expr, 2));
+		emit(g, "ASSIGN", value, NULL, target ? target->atom : NULL);
+		return target ? target->atom : NULL;
+	}
+	for(size_t i = 0; i < sizeof(compound_ops) / sizeof(compound_ops[0]); i++){
+		if(!is(op, compound_ops[i][0]))
+			continue;
+		if(is(item(item(expr, 1), 0), "[]")){
+			//a[i] op= x loads, operates and stores back at one index
+			const sx *array = item(item(expr, 1), 1);
+			const char *name = array ? array->atom : NULL;
+			const char *index = convert_expression(g, item(item(expr, 1), 2));
+			const char *value = convert_expression(g, item(expr, 2));
+			emit(g, "CHECK", name, index, NULL);
+			const char *old = new_temp(g);
+			emit(g, "LOAD", name, index, old);
+			set_type(g, old, type_of(g, name));
+			const char *temp = new_temp(g);
+			emit(g, compound_ops[i][1], old, value, temp);
+			set_type(g, temp, arith_type(type_of(g, old), type_of(g, value)));
+			emit(g, "STORE", temp, index, name);
+			return temp;
+		}
+		//x op= y is x = x op y
+		const sx *target = item(expr, 1);
+		const char *var = target ? target->atom : NULL;
+		const char *value = convert_expression(g, item(expr, 2));
+		const char *temp = new_temp(g);
+		emit(g, compound_ops[i][1], var, value, temp);
+		set_type(g, temp, arith_type(type_of(g, var), type_of(g, value)));
+		emit(g, "ASSIGN", temp, NULL, var);
+		return var;
+	}
+	for(size_t i = 0; i < sizeof(binary_ops) / sizeof(binary_ops[0]); i++){
+		if(is(op, binary_ops[i][0])){
+			const char *arg1 = convert_expression(g, item(expr, 1));
+			const char *arg2 = convert_expression(g, item(expr, 2));
+			const char *temp = new_temp(g);
+			emit(g, binary_ops[i][1], arg1, arg2, temp);
+			//comparisons are ints, as in C
+			set_type(g, temp, i < 4 ? arith_type(type_of(g, arg1), type_of(g, arg2)) : "int");
+			return temp;
+		}
+	}
+	if(is(op, "[]")){
+		const sx *array = item(expr, 1);
+		const char *index = convert_expression(g, item(expr, 2));
+		const char *temp = new_temp(g);
+		emit(g, "CHECK", array ? array->atom : NULL, index, NULL);
+		emit(g, "LOAD", array ? array->atom : NULL, index, temp);
+		set_type(g, temp, type_of(g, array ? array->atom : NULL));
+		return temp;
+	}
+	if(is(op, "++")){
+		const sx *last = item(expr, expr->n - 1);
+		const char *var = last ? last->atom : NULL;
+		const char *temp = new_temp(g);
+		set_type(g, temp, arith_type(type_of(g, var), "int"));
+		emit(g, "ADD", var, "1", temp);
+		emit(g, "ASSIGN", temp, NULL, var);
+		return var;
+	}
+	if(is(op, "if")){
+		const char *result = new_temp(g);
+		const char *label_false = new_label(g);
+		const char *label_end = new_label(g);
+		const char *cond = convert_expression(g, item(expr, 1));
+		emit(g, "IF_FALSE", cond, NULL, label_false);
+		//each branch is evaluated only on its own path
+		const char *then_val = convert_expression(g, item(expr, 2));
+		const char *type = type_of(g, then_val);
+		emit(g, "ASSIGN", then_val, NULL, result);
+		emit(g, "GOTO", label_end, NULL, NULL);
+		emit(g, "LABEL", label_false, NULL, NULL);
+		if(expr->n > 3){
+			const char *else_val = convert_expression(g, item(expr, 3));
+			type = arith_type(type, type_of(g, else_val));
+			emit(g, "ASSIGN", else_val, NULL, result);
+		}
+		emit(g, "LABEL", label_end, NULL, NULL);
+		set_type(g, result, type);
+		return result;
+	}
+	return NULL;
+}
+
+
+static void convert_statement(icg *g, const sx *stmt){
+	if(stmt == NULL || stmt->atom != NULL || stmt->n == 0)
+		return;
+	const sx *op = stmt->items[0];
+
+	if(is(op, "stmt") || is(op, "main")){
+		for(size_t i = 1; i < stmt->n; i++)
+			convert_statement(g, stmt->items[i]);
+	}
+	else if(is(op, "for")){
+		convert_statement(g, item(stmt, 1));
+		convert_expression(g, item(stmt, 2));
+
+		const char *label_start = new_label(g);
+		const char *label_end = new_label(g);
+		emit(g, "LABEL", label_start, NULL, NULL);
+
+		const char *cond = convert_expression(g, item(item(stmt, 3), 1));
+		emit(g, "IF_FALSE", cond, NULL, label_end);
+
+		convert_statement(g, item(stmt, 4));
+		convert_expression(g, item(stmt, 3));
+
+		emit(g, "GOTO", label_start, NULL, NULL);
+		emit(g, "LABEL", label_end, NULL, NULL);
+	}
+	else if(!is(op, "Dc")){
+		convert_expression(g, stmt);
+	}
+}
+
+
+//a DECLARE of each name the code mentions, in front of it
+static void declare(icg *g){
+	tac *code = g->code;
+	size_t ncode = g->ncode;
+	g->code = NULL;
+	g->ncode = g->cap = 0;
+	for(size_t i = 0; i < ncode; i++){
+		const tac *t = &code[i];
+		const char *names[3] = {t->result, t->arg1, t->arg2};
+		if(strcmp(t->op, "GOTO") == 0 || strcmp(t->op, "LABEL") == 0)
+			continue;
+		if(strcmp(t->op, "IF_FALSE") == 0)
+			names[0] = names[2] = NULL;
+		for(int k = 0; k < 3; k++){
+			if(!is_name(names[k]))
+				continue;
+			icg_var *v = set_type(g, names[k], "int");
+			if(!v->declared){
+				v->declared = 1;
+				emit(g, "DECLARE", v->type, v->size, v->name);
+			}
+		}
+	}
+	for(size_t i = 0; i < ncode; i++)
+		emit(g, code[i].op, code[i].arg1, code[i].arg2, code[i].result);
+	free(code);
+}
+
+
+int icg_convert(icg *out, Node *root){
+	memset(out, 0, sizeof(*out));
+	if(root == NULL)
+		return -1;
+
+	sx *top = sx_new(NULL);
+	add_node(out, top, root);
+	const sx *block = item(top, 0);
+	int status = -1;
+	if(block != NULL && is(item(block, 0), "main")){
+		convert_statement(out, block);
+		declare(out);
+		status = 0;
+	}
+	sx_free(top);
+	return status;
+}
+
+
+void icg_free(icg *g){
+	for(size_t i = 0; i < g->nstrings; i++)
+		free(g->strings[i]);
+	free(g->strings);
+	free(g->code);
+	free(g->vars);
+	free(g->slots);
+	memset(g, 0, sizeof(*g));
+}
+
+
+#define OR_NONE(s)	((s) ? (s) : "None")
+
+int icg_format(const tac *t, char *buf, size_t size){
+	if(strcmp(t->op, "DECLARE") == 0 && t->arg2 != NULL)
+		return snprintf(buf, size, "%s %s[%s]", OR_NONE(t->arg1), OR_NONE(t->result), t->arg2);
+	if(strcmp(t->op, "DECLARE") == 0)
+		return snprintf(buf, size, "%s %s", OR_NONE(t->arg1), OR_NONE(t->result));
+	if(strcmp(t->op, "ASSIGN") == 0)
+		return snprintf(buf, size, "%s = %s", OR_NONE(t->result), OR_NONE(t->arg1));
+	if(strcmp(t->op, "LOAD") == 0)
+		return snprintf(buf, size, "%s = %s[%s]", OR_NONE(t->result), OR_NONE(t->arg1), OR_NONE(t->arg2));
+	if(strcmp(t->op, "STORE") == 0)
+		return snprintf(buf, size, "%s[%s] = %s", OR_NONE(t->result), OR_NONE(t->arg2), OR_NONE(t->arg1));
+	if(strcmp(t->op, "CHECK") == 0)
+		return snprintf(buf, size, "check %s[%s]", OR_NONE(t->arg1), OR_NONE(t->arg2));
+	if(strcmp(t->op, "IF_FALSE") == 0)
+		return snprintf(buf, size, "ifFalse %s goto %s", OR_NONE(t->arg1), OR_NONE(t->result));
+	if(strcmp(t->op, "GOTO") == 0)
+		return snprintf(buf, size, "goto %s", OR_NONE(t->arg1));
+	if(strcmp(t->op, "LABEL") == 0)
+		return snprintf(buf, size, "%s:", OR_NONE(t->arg1));
+	for(size_t i = 0; i < sizeof(binary_ops) / sizeof(binary_ops[0]); i++)
+		if(strcmp(t->op, binary_ops[i][1]) == 0)
+			return snprintf(buf, size, "%s = %s %s %s", OR_NONE(t->result), OR_NONE(t->arg1),
+				binary_ops[i][0], OR_NONE(t->arg2));
+	return snprintf(buf, size, "UNHANDLED_INSTRUCTION: %s", t->op);
+}
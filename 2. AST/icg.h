@@ -0,0 +1,57 @@
+#ifndef ICG_H
+#define ICG_H
+
+#include <stddef.h>
+
+#include "ast.h"
+
+/*
+    Three-address code from the AST, for the embedding API (minicc.h).
+
+    A C port of "3. ICG/program_converter.py": it walks the same tree the
+    preorder dump prints, reading it exactly as the converter reads that
+    dump (a leaf such as "Dc x" is two atoms of its parent), so both
+    produce the same instructions and icg_format() the same lines as
+    format_tac(). Absent operands are NULL and format as "None".
+
+    The code starts with a DECLARE of every name it mentions, in order of
+    first mention: variables have the type of their leaves, temporaries
+    the type of the value they hold, and a name with no type is an int.
+    An array's DECLARE has its size as arg2; LOAD (t = a[i]) and STORE
+    (a[i] = x) read and write its elements, each after a CHECK (check a[i])
+    of the index.
+*/
+
+typedef struct tac{
+    const char *op;			//DECLARE, ASSIGN, LOAD, STORE, CHECK, ADD, SUB, MUL, DIV, a comparison, IF_FALSE, GOTO, LABEL
+    const char *arg1;		//the type of a DECLARE, the array of a LOAD or CHECK
+    const char *arg2;		//the size of an array's DECLARE, the index of a LOAD, STORE or CHECK
+    const char *result;		//destination, the array of a STORE, or the label of IF_FALSE
+}tac;
+
+typedef struct icg_var{
+    const char *name;
+    const char *type;		//"int", "float" or "char"; an array's elements
+    const char *size;		//an array's number of elements, else NULL
+    int declared;
+}icg_var;
+
+typedef struct icg{
+    tac *code;
+    size_t ncode, cap;
+    int temps, labels;
+    icg_var *vars;			//the type of each name, as first seen
+    size_t nvars, vars_cap;
+    size_t *slots;			//hash of vars by name: index + 1, 0 for empty
+    size_t nslots;
+    char **strings;			//temporaries, labels and atoms owned by this
+    size_t nstrings, strings_cap;
+}icg;
+
+//root is the tree a.out prints; 0 if it is a main block, -1 otherwise
+int icg_convert(icg *out, Node *root);
+void icg_free(icg *g);
+
+int icg_format(const tac *t, char *buf, size_t size);
+
+#endif
@@ -0,0 +1,3 @@
+lex ast.l
+yacc -d ast.y
+gcc -O2 -fPIC -shared -DFRONTEND_NO_MAIN -I"../1. LexicalAnalyser" y.tab.c lex.yy.c trace.c perf.c alloc.c srcpos.c diag.c pch.c symtab.c xref.c sema.c icg.c minicc.c "../1. LexicalAnalyser/literal.cpp" -lstdc++ -pthread -o libminicc.so
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ast.h"
+#include "alloc.h"
+#include "icg.h"
+#include "pch.h"
+#include "xref.h"
+#include "minicc.h"
+
+extern FILE *yyin, *yyout;
+extern char *yytext;
+
+_Static_assert(sizeof(minicc_tac) == sizeof(tac), "minicc_tac mirrors tac");
+_Static_assert(sizeof(unsigned) == sizeof(srcpos), "uses are handed out as srcpos");
+
+struct minicc{
+    char *diagnostics;
+    size_t diagnostics_len;
+
+    minicc_token *tokens;
+    size_t ntokens, tokens_cap;
+    char *text;				//token spellings, NUL-separated
+    size_t text_len, text_cap;
+
+    minicc_symbol *symbols;
+    struct node **symnodes;	//the entry behind each symbol, for its uses
+    size_t nsymbols;
+    minicc_node *nodes;
+    size_t nnodes, nodes_cap;
+    icg code;
+
+    Node **trees;			//what the parse left, owned until the next compile
+    size_t ntrees;
+    struct node *symtab;
+};
+
+static minicc *current;		//the context a compile is filling
+
+static const char *const type_names[] = {"int", "float", "char", "void"};
+
+
+int minicc_version(void){
+	return MINICC_API_VERSION;
+}
+
+
+minicc *minicc_create(void){
+	return calloc(1, sizeof(minicc));
+}
+
+
+void minicc_add_include_dir(const char *dir){
+	pch_add_include_dir(strdup(dir));
+}
+
+
+void minicc_set_pch_dir(const char *dir){
+	pch_set_cache_dir(strdup(dir));
+}
+
+
+void minicc_set_pch_builder(const char *frontend){
+	pch_set_builder(strdup(frontend));
+}
+
+
+static void free_tree(Node *n){
+	if(n == NULL)
+		return;
+	free_tree(n->left);
+	free_tree(n->right);
+	free_tree(n->val);
+	free_tree(n->body);
+	xfree(n);
+}
+
+
+static void clear(minicc *cc){
+	free(cc->diagnostics);
+	free(cc->tokens);
+	free(cc->text);
+	free(cc->symbols);
+	free(cc->symnodes);
+	free(cc->nodes);
+	icg_free(&cc->code);
+	for(size_t i = 0; i < cc->ntrees; i++)
+		free_tree(cc->trees[i]);
+	free(cc->trees);
+	while(cc->symtab != NULL){
+		struct node *next = cc->symtab->link;
+		xref_release(cc->symtab);
+		xfree(cc->symtab);
+		cc->symtab = next;
+	}
+	memset(cc, 0, sizeof(*cc));
+}
+
+
+void minicc_free(minicc *cc){
+	if(cc == NULL)
+		return;
+	clear(cc);
+	free(cc);
+}
+
+
+//spellings are offsets into text until the parse is over, as text moves
+static void record_token(int token, srcpos at){
+	minicc *cc = current;
+	if(token <= 0)
+		return;
+	size_t len = strlen(yytext) + 1;
+	if(cc->text_len + len > cc->text_cap){
+		cc->text_cap = (cc->text_len + len) * 2;
+		cc->text = realloc(cc->text, cc->text_cap);
+	}
+	memcpy(cc->text + cc->text_len, yytext, len);
+
+	if(cc->ntokens == cc->tokens_cap){
+		cc->tokens_cap = cc->tokens_cap ? cc->tokens_cap * 2 : 256;
+		cc->tokens = realloc(cc->tokens, cc->tokens_cap * sizeof(minicc_token));
+	}
+	minicc_token *t = &cc->tokens[cc->ntokens++];
+	t->code = token;
+	t->text = (const char*)(uintptr_t)cc->text_len;
+	t->offset = at;
+	cc->text_len += len;
+}
+
+
+static void add_nodes(minicc *cc, const Node *n, int depth){
+	if(n == NULL)
+		return;
+	if(cc->nnodes == cc->nodes_cap){
+		cc->nodes_cap = cc->nodes_cap ? cc->nodes_cap * 2 : 256;
+		cc->nodes = realloc(cc->nodes, cc->nodes_cap * sizeof(minicc_node));
+	}
+	minicc_node *out = &cc->nodes[cc->nnodes++];
+	out->token = n->token;
+	out->depth = depth;
+	out->nchildren = (n->left != NULL) + (n->right != NULL) + (n->val != NULL) + (n->body != NULL);
+	out->offset = n->offset;
+	out->line = srcpos_line(n->offset);
+	out->type = leaf_type_name(n);
+	add_nodes(cc, n->left, depth + 1);
+	add_nodes(cc, n->right, depth + 1);
+	add_nodes(cc, n->val, depth + 1);
+	add_nodes(cc, n->body, depth + 1);
+}
+
+
+static void collect(minicc *cc){
+	for(size_t i = 0; i < cc->ntokens; i++){
+		minicc_token *t = &cc->tokens[i];
+		int line, col;
+		srcpos_resolve(t->offset, &line, &col);
+		t->text = cc->text + (uintptr_t)t->text;
+		t->line = line;
+		t->column = col;
+	}
+
+	//after a syntax error cleansymbol never ran: leave out the placeholders
+	//checksym made for names that were never declared
+	cc->symtab = first;
+	for(struct node *s = first; s != NULL; s = s->link)
+		if(s->dtype != -1)
+			cc->nsymbols++;
+	cc->symbols = calloc(cc->nsymbols ? cc->nsymbols : 1, sizeof(minicc_symbol));
+	cc->symnodes = calloc(cc->nsymbols ? cc->nsymbols : 1, sizeof(struct node*));
+	size_t i = 0;
+	for(struct node *s = first; s != NULL; s = s->link){
+		if(s->dtype == -1)
+			continue;
+		minicc_symbol *out = &cc->symbols[i];
+		cc->symnodes[i++] = s;
+		out->name = s->name;
+		out->kind = s->token;
+		out->type = s->dtype >= 0 && s->dtype <= 3 ? type_names[s->dtype] : "";
+		out->scope = s->scope;
+		out->offset = s->offset;
+		out->line = srcpos_line(s->offset);
+		out->value = s->dtype == 1 ? s->val.f : s->dtype == 2 ? s->val.c : s->val.i;
+	}
+
+	//the stack is newest first; keep the trees in source order
+	for(tree_stack *s = tree_top; s != NULL && s->next != NULL; s = s->next)
+		cc->ntrees++;
+	cc->trees = calloc(cc->ntrees ? cc->ntrees : 1, sizeof(Node*));
+	i = cc->ntrees;
+	while(i > 0)
+		cc->trees[--i] = pop_tree();
+	for(i = 0; i < cc->ntrees; i++)
+		add_nodes(cc, cc->trees[i], 0);
+
+	//a.out prints the newest tree, and the converter reads that dump
+	if(cc->ntrees > 0)
+		icg_convert(&cc->code, cc->trees[cc->ntrees - 1]);
+}
+
+
+int minicc_compile(minicc *cc, const char *src, size_t len){
+	clear(cc);
+	current = cc;
+	embedded = 1;
+	frontend_reset();
+
+	if(yyout == NULL)
+		yyout = fopen("/dev/null", "w");
+	yyin = fmemopen((void*)src, len, "r");
+	if(yyin == NULL)
+		return -1;
+	lex_reset(yyin);
+
+	//the front end reports through printf; keep what it prints
+	fflush(stdout);
+	FILE *saved = stdout;
+	FILE *captured = open_memstream(&cc->diagnostics, &cc->diagnostics_len);
+	stdout = captured;
+	yylex_hook = record_token;
+	int status = frontend_parse();
+	yylex_hook = NULL;
+	fflush(captured);
+	stdout = saved;
+	fclose(captured);
+
+	fclose(yyin);
+	yyin = NULL;
+	collect(cc);
+	xfree(tree_top);
+	tree_top = NULL;
+	first = NULL;
+	current = NULL;
+	return status;
+}
+
+
+const char *minicc_diagnostics(const minicc *cc){
+	return cc->diagnostics ? cc->diagnostics : "";
+}
+
+
+size_t minicc_token_count(const minicc *cc){
+	return cc->ntokens;
+}
+
+
+const minicc_token *minicc_token_at(const minicc *cc, size_t i){
+	return i < cc->ntokens ? &cc->tokens[i] : NULL;
+}
+
+
+size_t minicc_symbol_count(const minicc *cc){
+	return cc->nsymbols;
+}
+
+
+const minicc_symbol *minicc_symbol_at(const minicc *cc, size_t i){
+	return i < cc->nsymbols ? &cc->symbols[i] : NULL;
+}
+
+
+const unsigned *minicc_symbol_uses(const minicc *cc, size_t i, size_t *count){
+	if(i >= cc->nsymbols){
+		*count = 0;
+		return NULL;
+	}
+	uint32_t n;
+	const srcpos *uses = xref_symbol_uses(cc->symnodes[i], &n);
+	*count = n;
+	return uses;
+}
+
+
+size_t minicc_node_count(const minicc *cc){
+	return cc->nnodes;
+}
+
+
+const minicc_node *minicc_node_at(const minicc *cc, size_t i){
+	return i < cc->nnodes ? &cc->nodes[i] : NULL;
+}
+
+
+size_t minicc_tac_count(const minicc *cc){
+	return cc->code.ncode;
+}
+
+
+const minicc_tac *minicc_tac_at(const minicc *cc, size_t i){
+	return i < cc->code.ncode ? (const minicc_tac*)&cc->code.code[i] : NULL;
+}
+
+
+int minicc_format_tac(const minicc_tac *t, char *buf, size_t size){
+	return icg_format((const tac*)t, buf, size);
+}
@@ -0,0 +1,89 @@
+#ifndef MINICC_H
+#define MINICC_H
+
+/*
+    C API of libminicc.so, the front end and ICG as a library (see lib.sh).
+
+    minicc_compile() parses a buffer in-process and keeps what a.out and the
+    ICG would print as arrays: the tokens the parser read, the cleaned symbol
+    table, the AST in preorder and the three-address code. The arrays and
+    their strings belong to the context and stay valid until the next
+    compile or minicc_free(). Diagnostics are captured as the text a.out
+    would print, instead of going to stdout.
+
+    The front end keeps its state in globals, so a process compiles one
+    buffer at a time; the include and cache settings are process-wide.
+*/
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MINICC_API_VERSION	3
+
+typedef struct minicc minicc;
+
+typedef struct minicc_token{
+    int code;				//parser token number, or the character for one-character tokens
+    const char *text;
+    unsigned offset, line, column;
+}minicc_token;
+
+typedef struct minicc_symbol{
+    const char *name;
+    const char *kind;		//"identifier", "function" or "param"
+    const char *type;		//"int", "float", "char" or "void"
+    int scope;
+    unsigned offset, line;
+    double value;			//chars as their code
+}minicc_symbol;
+
+typedef struct minicc_node{
+    const char *token;
+    int depth;				//0 for each top-level tree
+    int nchildren;
+    unsigned offset, line;
+    const char *type;		//"int", "float" or "char" for a typed leaf, else NULL
+}minicc_node;
+
+typedef struct minicc_tac{
+    const char *op;			//DECLARE, ASSIGN, ADD, SUB, MUL, DIV, a comparison, IF_FALSE, GOTO, LABEL
+    const char *arg1, *arg2, *result;	//NULL when absent; arg1 of a DECLARE is the type
+}minicc_tac;
+
+int minicc_version(void);
+
+minicc *minicc_create(void);
+void minicc_free(minicc *cc);
+
+void minicc_add_include_dir(const char *dir);
+void minicc_set_pch_dir(const char *dir);
+void minicc_set_pch_builder(const char *frontend);	//a.out, to parse headers missing from the cache; none by default
+
+//0 if the buffer parsed; diagnostics may still contain errors and warnings
+int minicc_compile(minicc *cc, const char *src, size_t len);
+const char *minicc_diagnostics(const minicc *cc);
+
+size_t minicc_token_count(const minicc *cc);
+const minicc_token *minicc_token_at(const minicc *cc, size_t i);
+
+size_t minicc_symbol_count(const minicc *cc);
+const minicc_symbol *minicc_symbol_at(const minicc *cc, size_t i);
+//byte offsets of the identifiers that resolved to symbol i, in source order
+const unsigned *minicc_symbol_uses(const minicc *cc, size_t i, size_t *count);
+
+size_t minicc_node_count(const minicc *cc);
+const minicc_node *minicc_node_at(const minicc *cc, size_t i);
+
+//empty unless the tree a.out prints is a main block, like program_converter.py
+size_t minicc_tac_count(const minicc *cc);
+const minicc_tac *minicc_tac_at(const minicc *cc, size_t i);
+int minicc_format_tac(const minicc_tac *t, char *buf, size_t size);	//an icg_output.txt line
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
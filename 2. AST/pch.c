@@ -0,0 +1,556 @@
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "pch.h"
+#include "alloc.h"
+#include "trace.h"
+#include "diag.h"
+
+#define PCH_MAGIC		"MINIPCH"
+#define PCH_VERSION		3
+
+typedef struct pch_header{
+    char magic[8];
+    uint32_t version;
+    uint32_t nsymbols;
+    uint32_t nnodes;
+    uint32_t nroots;		//trees left on the tree stack, bottom first
+    uint32_t ndeps;
+    uint32_t nchars;		//length of the dependency paths, each NUL-terminated
+    uint32_t pad;
+    uint64_t hash;
+}pch_header;
+
+typedef struct pch_symbol{
+    char token[20];
+    char name[20];
+    int32_t dtype;
+    int32_t scope;
+    int32_t valid;
+    uint32_t val;			//the value union's bits
+}pch_symbol;
+
+//children are node indices, -1 for none; nodes are stored in preorder
+typedef struct pch_node{
+    int32_t left, right, val, body;
+    uint32_t offset;
+    int32_t type;			//the node's dtype, -1 if untyped
+    char token[100];
+}pch_node;
+
+//a file the header read through its own includes, with the hash of the
+//contents it had; path is an offset into the paths at the end of the file
+typedef struct pch_dep{
+    uint64_t hash;
+    uint32_t path;
+    uint32_t pad;
+}pch_dep;
+
+typedef struct dep{
+    char *path;
+    uint64_t hash;
+}dep;
+
+static const char *include_dirs[PCH_MAX_INCLUDE_DIRS];
+static int ninclude_dirs = 0;
+static const char *cache_dir = "pch-cache";
+static int loaded_roots = 0;
+static const char *builder = NULL;		//none: headers missing from the cache are errors
+static dep *deps = NULL;		//every header this parse read, for pch_write
+static int ndeps = 0, deps_cap = 0;
+static uint64_t *included = NULL;	//text hashes of the headers this parse took in
+static int nincluded = 0, included_cap = 0;
+//text hashes of the headers whose precompiles this one runs inside, outermost
+//first: including one of them again would never finish
+static uint64_t including[PCH_MAX_INCLUDE_DEPTH];
+static int nincluding = 0;
+static int include_failed = 0;
+
+
+void pch_add_include_dir(const char *dir){
+	if(ninclude_dirs < PCH_MAX_INCLUDE_DIRS)
+		include_dirs[ninclude_dirs++] = dir;
+}
+
+
+void pch_set_cache_dir(const char *dir){
+	cache_dir = dir;
+}
+
+
+int pch_loaded_roots(void){
+	return loaded_roots;
+}
+
+
+void pch_set_including(const char *hashes){
+	nincluding = 0;
+	for(const char *p = hashes; *p != '\0' && nincluding < PCH_MAX_INCLUDE_DEPTH; ){
+		char *end;
+		including[nincluding++] = strtoull(p, &end, 16);
+		if(end == p)
+			break;
+		p = *end == ',' ? end + 1 : end;
+	}
+}
+
+
+int pch_include_failed(void){
+	return include_failed;
+}
+
+
+void pch_reset(void){
+	loaded_roots = 0;
+	for(int i = 0; i < ndeps; i++)
+		free(deps[i].path);
+	ndeps = 0;
+	nincluded = 0;
+	include_failed = 0;
+}
+
+
+//0 if a header with this text was already included in this parse
+static int mark_included(uint64_t text){
+	for(int i = 0; i < nincluded; i++)
+		if(included[i] == text)
+			return 0;
+	if(nincluded == included_cap){
+		included_cap = included_cap ? 2 * included_cap : 8;
+		included = realloc(included, included_cap * sizeof(uint64_t));
+	}
+	included[nincluded++] = text;
+	return 1;
+}
+
+
+static void add_dep(const char *path, uint64_t hash){
+	for(int i = 0; i < ndeps; i++)
+		if(strcmp(deps[i].path, path) == 0)
+			return;
+	if(ndeps == deps_cap){
+		deps_cap = deps_cap ? 2 * deps_cap : 8;
+		deps = realloc(deps, deps_cap * sizeof(dep));
+	}
+	deps[ndeps].path = strdup(path);
+	deps[ndeps].hash = hash;
+	ndeps++;
+}
+
+
+void pch_set_builder(const char *exe){
+	builder = exe;
+}
+
+
+static void include_error(srcpos at, const char *fmt, const char *arg){
+	char msg[512];
+	include_failed = 1;
+	snprintf(msg, sizeof(msg), fmt, arg);
+	diag_report(at, DIAG_ERROR, "%s \n\n", msg);
+}
+
+
+static uint64_t fnv(uint64_t h, const char *p, size_t len){
+	for(size_t i = 0; i < len; i++){
+		h ^= (unsigned char)p[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+
+//FNV-1a, salted with the format version so old caches are never loaded
+static uint64_t content_hash(const char *p, size_t len){
+	return fnv(14695981039346656037ULL ^ PCH_VERSION, p, len);
+}
+
+
+//hash of a file's contents, or 0 if it cannot be read
+static uint64_t file_hash(const char *path){
+	FILE *fp = fopen(path, "r");
+	if(fp == NULL)
+		return 0;
+	size_t len;
+	char *src = read_input(fp, &len);
+	fclose(fp);
+	if(src == NULL)
+		return 0;
+	uint64_t h = content_hash(src, len);
+	free(src);
+	return h;
+}
+
+
+/* ---- writing, in the child ---- */
+
+//a NUL-terminated string into a field of size bytes, cut to fit
+static void copy_field(char *dst, const char *src, size_t size){
+	size_t n = strnlen(src, size - 1);
+	memcpy(dst, src, n);
+	dst[n] = '\0';
+}
+
+
+static uint32_t count_nodes(Node *n){
+	if(n == NULL)
+		return 0;
+	return 1 + count_nodes(n->left) + count_nodes(n->right) + count_nodes(n->val) + count_nodes(n->body);
+}
+
+
+static int32_t flatten(Node *n, pch_node *out, int32_t *next){
+	if(n == NULL)
+		return -1;
+	int32_t i = (*next)++;
+	memset(&out[i], 0, sizeof(out[i]));
+	copy_field(out[i].token, n->token, sizeof(out[i].token));
+	out[i].offset = n->offset;
+	out[i].type = n->type;
+	out[i].left = flatten(n->left, out, next);
+	out[i].right = flatten(n->right, out, next);
+	out[i].val = flatten(n->val, out, next);
+	out[i].body = flatten(n->body, out, next);
+	return i;
+}
+
+
+int pch_write(const char *path, struct node *symbols, tree_stack *stack){
+	pch_header h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, PCH_MAGIC, sizeof(h.magic));
+	h.version = PCH_VERSION;
+
+	for(struct node *s = symbols; s != NULL; s = s->link)
+		h.nsymbols++;
+	//the bottom of the tree stack is an empty sentinel cell
+	for(tree_stack *t = stack; t != NULL && t->node != NULL; t = t->next){
+		h.nroots++;
+		h.nnodes += count_nodes(t->node);
+	}
+
+	pch_symbol *syms = calloc(h.nsymbols ? h.nsymbols : 1, sizeof(pch_symbol));
+	pch_node *nodes = calloc(h.nnodes ? h.nnodes : 1, sizeof(pch_node));
+	int32_t *roots = calloc(h.nroots ? h.nroots : 1, sizeof(int32_t));
+	h.ndeps = ndeps;
+	pch_dep *table = calloc(ndeps ? ndeps : 1, sizeof(pch_dep));
+	for(int d = 0; d < ndeps; d++){
+		table[d].hash = deps[d].hash;
+		table[d].path = h.nchars;
+		h.nchars += strlen(deps[d].path) + 1;
+	}
+
+	uint32_t i = 0;
+	for(struct node *s = symbols; s != NULL; s = s->link, i++){
+		copy_field(syms[i].token, s->token, sizeof(syms[i].token));
+		copy_field(syms[i].name, s->name, sizeof(syms[i].name));
+		syms[i].dtype = s->dtype;
+		syms[i].scope = s->scope;
+		syms[i].valid = s->valid;
+		memcpy(&syms[i].val, &s->val, sizeof(syms[i].val));
+	}
+
+	int32_t next = 0;
+	i = h.nroots;
+	for(tree_stack *t = stack; t != NULL && t->node != NULL; t = t->next)
+		roots[--i] = flatten(t->node, nodes, &next);
+
+	//write beside the target and rename, so a reader never sees half a file
+	char tmp[4096];
+	snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (int)getpid());
+	FILE *fp = fopen(tmp, "wb");
+	int ok = fp != NULL
+		&& fwrite(&h, sizeof(h), 1, fp) == 1
+		&& fwrite(syms, sizeof(pch_symbol), h.nsymbols, fp) == h.nsymbols
+		&& fwrite(table, sizeof(pch_dep), h.ndeps, fp) == h.ndeps
+		&& fwrite(nodes, sizeof(pch_node), h.nnodes, fp) == h.nnodes
+		&& fwrite(roots, sizeof(int32_t), h.nroots, fp) == h.nroots;
+	for(int d = 0; ok && d < ndeps; d++)
+		ok = fwrite(deps[d].path, strlen(deps[d].path) + 1, 1, fp) == 1;
+	if(fp != NULL && fclose(fp) != 0)
+		ok = 0;
+	if(ok && rename(tmp, path) != 0)
+		ok = 0;
+	if(!ok){
+		fprintf(stderr, "pch: cannot write %s: %s\n", path, strerror(errno));
+		unlink(tmp);
+	}
+
+	free(syms);
+	free(nodes);
+	free(roots);
+	free(table);
+	return ok ? 0 : -1;
+}
+
+
+/* ---- loading, in the including compile ---- */
+
+//the trees must be a forest the back-to-front build below can follow:
+//every child comes after its parent, and no node is reached twice
+static int valid_trees(const pch_header *h, const pch_symbol *syms, const pch_node *nodes, const int32_t *roots){
+	for(uint32_t i = 0; i < h->nsymbols; i++)
+		if(syms[i].token[sizeof(syms[i].token) - 1] != '\0' || syms[i].name[sizeof(syms[i].name) - 1] != '\0')
+			return 0;
+	char *reached = calloc(h->nnodes ? h->nnodes : 1, 1);
+	int ok = 1;
+	for(uint32_t i = 0; ok && i < h->nnodes; i++){
+		const pch_node *p = &nodes[i];
+		int32_t child[4] = {p->left, p->right, p->val, p->body};
+		ok = p->token[sizeof(p->token) - 1] == '\0';
+		for(int c = 0; ok && c < 4; c++){
+			if(child[c] == -1)
+				continue;
+			ok = child[c] > (int64_t)i && (uint32_t)child[c] < h->nnodes && !reached[child[c]];
+			if(ok)
+				reached[child[c]] = 1;
+		}
+	}
+	for(uint32_t i = 0; ok && i < h->nroots; i++){
+		ok = roots[i] >= 0 && (uint32_t)roots[i] < h->nnodes && !reached[roots[i]];
+		if(ok)
+			reached[roots[i]] = 1;
+	}
+	free(reached);
+	return ok;
+}
+
+
+int pch_load(const char *path, srcpos at){
+	int fd = open(path, O_RDONLY);
+	if(fd < 0)
+		return -1;
+	struct stat st;
+	if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(pch_header)){
+		close(fd);
+		return -1;
+	}
+	size_t size = st.st_size;
+	const char *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(map == MAP_FAILED)
+		return -1;
+
+	const pch_header *h = (const pch_header*)map;
+	size_t need = sizeof(pch_header) + (size_t)h->nsymbols * sizeof(pch_symbol)
+		+ (size_t)h->ndeps * sizeof(pch_dep) + (size_t)h->nnodes * sizeof(pch_node)
+		+ (size_t)h->nroots * sizeof(int32_t) + h->nchars;
+	if(memcmp(h->magic, PCH_MAGIC, sizeof(h->magic)) != 0 || h->version != PCH_VERSION || need != size){
+		munmap((void*)map, size);
+		return -1;
+	}
+	const pch_symbol *syms = (const pch_symbol*)(h + 1);
+	const pch_dep *table = (const pch_dep*)(syms + h->nsymbols);
+	const pch_node *nodes = (const pch_node*)(table + h->ndeps);
+	const int32_t *roots = (const int32_t*)(nodes + h->nnodes);
+	const char *paths = (const char*)(roots + h->nroots);
+	if(!valid_trees(h, syms, nodes, roots)){
+		munmap((void*)map, size);
+		return -1;
+	}
+
+	//the key covers only the header's own text: a header it includes may
+	//have changed since
+	int fresh = h->ndeps == 0 || (h->nchars > 0 && paths[h->nchars - 1] == '\0');
+	for(uint32_t i = 0; fresh && i < h->ndeps; i++)
+		fresh = table[i].path < h->nchars && file_hash(paths + table[i].path) == table[i].hash;
+	if(!fresh){
+		munmap((void*)map, size);
+		return -1;
+	}
+	for(uint32_t i = 0; i < h->ndeps; i++){
+		add_dep(paths + table[i].path, table[i].hash);
+		mark_included(table[i].hash);
+	}
+
+	//the header's own offsets mean nothing in this file, so its symbols are
+	//placed at the #include
+	for(uint32_t i = 0; i < h->nsymbols; i++){
+		struct node *n = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
+		memset(n, 0, sizeof(*n));
+		memcpy(n->token, syms[i].token, sizeof(n->token));
+		memcpy(n->name, syms[i].name, sizeof(n->name));
+		n->dtype = syms[i].dtype;
+		n->scope = syms[i].scope;
+		n->valid = syms[i].valid;
+		memcpy(&n->val, &syms[i].val, sizeof(syms[i].val));
+		n->offset = at;
+		n->link = NULL;
+		addtosymbol(n);
+	}
+
+	//children always follow their parent, so build back to front
+	Node **built = malloc((h->nnodes ? h->nnodes : 1) * sizeof(Node*));
+	for(int64_t i = (int64_t)h->nnodes - 1; i >= 0; i--){
+		const pch_node *p = &nodes[i];
+		Node *n = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
+		memcpy(n->token, p->token, sizeof(n->token));
+		n->left = p->left >= 0 ? built[p->left] : NULL;
+		n->right = p->right >= 0 ? built[p->right] : NULL;
+		n->val = p->val >= 0 ? built[p->val] : NULL;
+		n->body = p->body >= 0 ? built[p->body] : NULL;
+		n->level = 0;
+		n->offset = at;
+		n->type = p->type;
+		built[i] = n;
+	}
+	for(uint32_t i = 0; i < h->nroots; i++)
+		push_tree(built[roots[i]]);
+	loaded_roots += h->nroots;
+
+	free(built);
+	munmap((void*)map, size);
+	return 0;
+}
+
+
+//an entry is named <slot>-<hash>.pch, the slot standing for the header's
+//path; once a new entry is built, the others in its slot were built from
+//text the header no longer has, and are removed
+static void prune_slot(const char *slot, const char *keep){
+	DIR *dir = opendir(cache_dir);
+	if(dir == NULL)
+		return;
+	size_t n = strlen(slot);
+	struct dirent *e;
+	while((e = readdir(dir)) != NULL){
+		size_t len = strlen(e->d_name);
+		if(strncmp(e->d_name, slot, n) != 0 || len < 4 || strcmp(e->d_name + len - 4, ".pch") != 0
+				|| strcmp(e->d_name, keep) == 0)
+			continue;
+		char old[4096];
+		snprintf(old, sizeof(old), "%s/%s", cache_dir, e->d_name);
+		unlink(old);
+	}
+	closedir(dir);
+}
+
+
+//run this front end on the header with --emit-pch, passing the search setup on
+static int build_pch(const char *header, const char *out, uint64_t text){
+	char emit[4200], pchdir[4200], incs[PCH_MAX_INCLUDE_DIRS][4200];
+	char within[32 + 17 * PCH_MAX_INCLUDE_DEPTH];
+	char *argv[PCH_MAX_INCLUDE_DIRS + 5];
+	int argc = 0;
+
+	argv[argc++] = (char*)builder;
+	snprintf(emit, sizeof(emit), "--emit-pch=%s", out);
+	argv[argc++] = emit;
+	snprintf(pchdir, sizeof(pchdir), "--pch-dir=%s", cache_dir);
+	argv[argc++] = pchdir;
+	int w = snprintf(within, sizeof(within), "--pch-including=");
+	for(int i = 0; i < nincluding; i++)
+		w += snprintf(within + w, sizeof(within) - w, "%016llx,", (unsigned long long)including[i]);
+	snprintf(within + w, sizeof(within) - w, "%016llx", (unsigned long long)text);
+	argv[argc++] = within;
+	for(int i = 0; i < ninclude_dirs; i++){
+		snprintf(incs[i], sizeof(incs[i]), "-I%s", include_dirs[i]);
+		argv[argc++] = incs[i];
+	}
+	argv[argc] = NULL;
+
+	fflush(stdout);
+	fflush(stderr);
+	pid_t pid = fork();
+	if(pid < 0)
+		return -1;
+	if(pid == 0){
+		int fd = open(header, O_RDONLY);
+		if(fd < 0 || dup2(fd, 0) < 0)
+			_exit(127);
+		execv(argv[0], argv);
+		_exit(127);
+	}
+
+	int status;
+	if(waitpid(pid, &status, 0) < 0)
+		return -1;
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : -1;
+}
+
+
+void include_header(const char *literal, srcpos at){
+	char name[128];
+	size_t n = strlen(literal);
+	if(n >= 2 && literal[0] == '"' && literal[n - 1] == '"'){
+		literal++;
+		n -= 2;
+	}
+	snprintf(name, sizeof(name), "%.*s", (int)n, literal);
+
+	static const char *cwd_only[] = { "." };
+	const char **dirs = ninclude_dirs ? include_dirs : cwd_only;
+	int ndirs = ninclude_dirs ? ninclude_dirs : 1;
+
+	char path[4096];
+	char *src = NULL;
+	size_t len = 0;
+	for(int i = 0; i < ndirs && src == NULL; i++){
+		snprintf(path, sizeof(path), "%s/%s", dirs[i], name);
+		FILE *fp = fopen(path, "r");
+		if(fp != NULL){
+			src = read_input(fp, &len);
+			fclose(fp);
+		}
+	}
+	if(src == NULL){
+		include_error(at, "\'%s\' file not found", name);
+		return;
+	}
+
+	uint64_t text = content_hash(src, len);
+	for(int i = 0; i < nincluding; i++){
+		if(including[i] == text){
+			free(src);
+			include_error(at, "include cycle: \'%s\' includes itself", name);
+			return;
+		}
+	}
+	if(nincluding == PCH_MAX_INCLUDE_DEPTH){
+		free(src);
+		include_error(at, "\'%s\' is nested too deeply", name);
+		return;
+	}
+	//a header already taken in adds nothing, as if it had include guards
+	if(!mark_included(text)){
+		free(src);
+		return;
+	}
+
+	//the same text found through other directories can include other files
+	trace_begin(name);
+	add_dep(path, text);
+	uint64_t hash = text;
+	for(int i = 0; i < ndirs; i++)
+		hash = fnv(hash, dirs[i], strlen(dirs[i]) + 1);
+	char slot[24], entry[64], pch[4096];
+	snprintf(slot, sizeof(slot), "%016llx-", (unsigned long long)fnv(14695981039346656037ULL, path, strlen(path)));
+	snprintf(entry, sizeof(entry), "%s%016llx.pch", slot, (unsigned long long)hash);
+	snprintf(pch, sizeof(pch), "%s/%s", cache_dir, entry);
+	free(src);
+
+	//a missing or stale cache entry is rebuilt; pch_load changes nothing
+	//until the file has been validated
+	if(pch_load(pch, at) != 0){
+		if(builder == NULL){
+			include_error(at, "cannot precompile \'%s\': no front end set to build headers", name);
+		}
+		else{
+			mkdir(cache_dir, 0777);
+			if(build_pch(path, pch, text) != 0 || pch_load(pch, at) != 0)
+				include_error(at, "could not precompile \'%s\'", name);
+			else
+				prune_slot(slot, entry);
+		}
+	}
+	trace_end();
+}
@@ -0,0 +1,37 @@
+#ifndef PCH_H
+#define PCH_H
+
+#include "ast.h"
+
+/*
+    #include "x.h" processing with a parsed-header cache.
+
+    A header is parsed once, by running the front end on it in a child process
+    with --emit-pch, which writes the header's symbol table and AST to
+    <cache dir>/<slot>-<hash>.pch, the slot being a hash of its path and the
+    hash one of its contents and the include directories. Every include of a header with the same contents, in this
+    compile or a later one, maps that file and copies the symbols and trees
+    into the current parse instead of lexing the header again. The file also
+    lists the headers it includes in turn, with hashes of their contents; if
+    any has changed, the entry is built again. Building an entry removes the
+    others in its slot, left from earlier contents of the same header, and an
+    entry whose trees are not well formed is treated as missing.
+*/
+
+#define PCH_MAX_INCLUDE_DIRS	16
+#define PCH_MAX_INCLUDE_DEPTH	64
+
+void pch_add_include_dir(const char *dir);		//searched in order; "." if none given
+void pch_set_cache_dir(const char *dir);
+void pch_set_builder(const char *exe);			//front end run with --emit-pch; none set, none run
+void pch_set_including(const char *hashes);		//--pch-including: headers being precompiled around this one
+int pch_include_failed(void);			//an #include reported an error; the header is not cached
+
+void include_header(const char *literal, srcpos at);	//literal as lexed, with its quotes
+
+int pch_write(const char *path, struct node *symbols, tree_stack *stack);
+int pch_load(const char *path, srcpos at);
+int pch_loaded_roots(void);		//trees pushed by headers, at the bottom of the stack
+void pch_reset(void);			//a new parse starts with an empty tree stack
+
+#endif
@@ -0,0 +1,163 @@
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "perf.h"
+
+static const char *counter_names[PERF_NCOUNTERS] = {
+    "cycles", "instructions", "cache-misses", "branch-misses"
+};
+
+static const unsigned long long counter_configs[PERF_NCOUNTERS] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+
+static const char *phase_names[PERF_NPHASES] = {
+    "lex", "yyparse", "cleansymbol", "preorder"
+};
+
+static int fds[PERF_NCOUNTERS];
+static int slot[PERF_NCOUNTERS];	//position in the group read, -1 if not opened
+static int nopened = 0;
+static int leader = -1;
+
+static uint64_t begin_values[PERF_NPHASES][PERF_NCOUNTERS];
+static uint64_t totals[PERF_NPHASES][PERF_NCOUNTERS];
+static unsigned long long calls[PERF_NPHASES];
+
+
+static int open_counter(unsigned long long config, int group_fd){
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = config;
+	attr.read_format = PERF_FORMAT_GROUP;
+	attr.disabled = (group_fd == -1);
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+
+int perf_open(void){
+	for(int i = 0; i < PERF_NCOUNTERS; i++){
+		fds[i] = -1;
+		slot[i] = -1;
+	}
+
+	for(int i = 0; i < PERF_NCOUNTERS; i++){
+		int fd = open_counter(counter_configs[i], leader);
+		if(fd < 0){
+			if(leader == -1){
+				fprintf(stderr, "counters: %s unavailable (%s), counters disabled\n",
+					counter_names[i], strerror(errno));
+				return -1;
+			}
+			fprintf(stderr, "counters: %s unavailable (%s)\n", counter_names[i], strerror(errno));
+			continue;
+		}
+		if(leader == -1)
+			leader = fd;
+		fds[i] = fd;
+		slot[i] = nopened++;
+	}
+
+	ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	return 0;
+}
+
+
+void perf_close(void){
+	for(int i = 0; i < PERF_NCOUNTERS; i++){
+		if(fds[i] >= 0)
+			close(fds[i]);
+		fds[i] = -1;
+	}
+	leader = -1;
+	nopened = 0;
+}
+
+
+int perf_enabled(void){
+	return leader != -1;
+}
+
+
+static void read_counters(uint64_t values[PERF_NCOUNTERS]){
+	uint64_t buf[1 + PERF_NCOUNTERS];
+	if(read(leader, buf, sizeof(buf)) < (ssize_t)sizeof(uint64_t)){
+		memset(values, 0, PERF_NCOUNTERS * sizeof(uint64_t));
+		return;
+	}
+	for(int i = 0; i < PERF_NCOUNTERS; i++)
+		values[i] = slot[i] >= 0 ? buf[1 + slot[i]] : 0;
+}
+
+
+void perf_phase_begin(enum perf_phase phase){
+	if(leader == -1)
+		return;
+	read_counters(begin_values[phase]);
+}
+
+
+void perf_phase_end(enum perf_phase phase){
+	if(leader == -1)
+		return;
+
+	uint64_t now[PERF_NCOUNTERS];
+	read_counters(now);
+	for(int i = 0; i < PERF_NCOUNTERS; i++)
+		totals[phase][i] += now[i] - begin_values[phase][i];
+	calls[phase]++;
+}
+
+
+void perf_report(FILE *fp, size_t srclen){
+	if(leader == -1)
+		return;
+
+	double kb = srclen / 1024.0;
+	if(kb <= 0)
+		kb = 1.0 / 1024.0;
+
+	fprintf(fp, "\nHardware Counters (%zu bytes of source)\n\n", srclen);
+	fprintf(fp, "%12s %14s %14s %6s %14s %14s\n",
+		"Phase", "Cycles", "Instructions", "IPC", "CacheMiss/KB", "BranchMiss/KB");
+
+	for(int p = 0; p < PERF_NPHASES; p++){
+		uint64_t *t = totals[p];
+		fprintf(fp, "%12s", phase_names[p]);
+
+		for(int i = PERF_CYCLES; i <= PERF_INSTRUCTIONS; i++){
+			if(slot[i] >= 0)
+				fprintf(fp, " %14llu", (unsigned long long)t[i]);
+			else
+				fprintf(fp, " %14s", "-");
+		}
+
+		if(slot[PERF_CYCLES] >= 0 && slot[PERF_INSTRUCTIONS] >= 0 && t[PERF_CYCLES] > 0)
+			fprintf(fp, " %6.2f", (double)t[PERF_INSTRUCTIONS] / t[PERF_CYCLES]);
+		else
+			fprintf(fp, " %6s", "-");
+
+		for(int i = PERF_CACHE_MISSES; i <= PERF_BRANCH_MISSES; i++){
+			if(slot[i] >= 0)
+				fprintf(fp, " %14.1f", t[i] / kb);
+			else
+				fprintf(fp, " %14s", "-");
+		}
+		fprintf(fp, "\n");
+	}
+	fprintf(fp, "\n'lex' is summed over %llu yylex calls and is also part of 'yyparse'.\n",
+		calls[PERF_PHASE_LEX]);
+}
@@ -0,0 +1,40 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/*
+    Hardware performance counters per front end phase (Linux perf_event_open).
+    Counters are opened as one group so a phase boundary costs a single read().
+    If the kernel or the machine does not provide a counter it is reported as
+    unavailable and the rest keep working; if none can be opened, perf_open()
+    says why and every other call becomes a no-op.
+*/
+
+enum perf_counter{
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_CACHE_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_NCOUNTERS
+};
+
+enum perf_phase{
+    PERF_PHASE_LEX,			//summed over every yylex call
+    PERF_PHASE_PARSE,		//yyparse, lexing included
+    PERF_PHASE_CLEANSYMBOL,
+    PERF_PHASE_PREORDER,
+    PERF_NPHASES
+};
+
+int perf_open(void);
+void perf_close(void);
+int perf_enabled(void);
+
+void perf_phase_begin(enum perf_phase phase);
+void perf_phase_end(enum perf_phase phase);
+
+void perf_report(FILE *fp, size_t srclen);
+
+#endif
@@ -0,0 +1,204 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sema.h"
+#include "diag.h"
+
+#define TYPE_UNKNOWN	-1
+#define TYPE_INT		0
+#define TYPE_FLOAT		1
+#define TYPE_CHAR		2
+
+typedef struct diag{
+    srcpos at;
+    const char *msg;
+}diag;
+
+typedef struct unit{
+    Node *root;
+    diag *diags;
+    uint32_t ndiags, cap;
+}unit;
+
+static int jobs = 0;
+
+
+void sema_set_jobs(int n){
+	jobs = n;
+}
+
+
+static void report(unit *u, srcpos at, const char *msg){
+	if(u->ndiags == u->cap){
+		u->cap = u->cap ? u->cap * 2 : 8;
+		u->diags = realloc(u->diags, u->cap * sizeof(diag));
+	}
+	u->diags[u->ndiags].at = at;
+	u->diags[u->ndiags].msg = msg;
+	u->ndiags++;
+}
+
+
+static int is_leaf(const Node *n){
+	return n->left == NULL && n->right == NULL && n->val == NULL && n->body == NULL;
+}
+
+
+static int is_op(const Node *n, const char *const *ops){
+	for(; *ops != NULL; ops++)
+		if(strcmp(n->token, *ops) == 0)
+			return 1;
+	return 0;
+}
+
+
+static const char *const arith_ops[] = {"+", "-", "*", "/", "%", NULL};
+static const char *const assign_ops[] = {"=", "+=", "-=", "*=", "/=", "%=", NULL};
+static const char *const compare_ops[] = {"<", ">", "<=", ">=", "==", "!=", "&&", "||", NULL};
+
+
+//usual arithmetic conversions for the types this language has
+static int arith_type(int a, int b){
+	if(a == TYPE_UNKNOWN || b == TYPE_UNKNOWN)
+		return TYPE_UNKNOWN;
+	if(a == TYPE_FLOAT || b == TYPE_FLOAT)
+		return TYPE_FLOAT;
+	return TYPE_INT;
+}
+
+
+//where an expression starts: binary nodes sit at their operator
+static srcpos start_of(const Node *n){
+	srcpos at = n->offset;
+	const Node *kids[4] = {n->left, n->right, n->val, n->body};
+	for(int i = 0; i < 4; i++){
+		if(kids[i] != NULL){
+			srcpos s = start_of(kids[i]);
+			if(s < at)
+				at = s;
+		}
+	}
+	return at;
+}
+
+
+static void check_conversion(unit *u, int to, int from, const Node *rhs){
+	const char *msg = NULL;
+	if(to == TYPE_INT && from == TYPE_FLOAT)
+		msg = "implicit conversion from \'float\' to \'int\' \n\n";
+	else if(to == TYPE_FLOAT && from == TYPE_CHAR)
+		msg = "implicit conversion from \'char\' to \'float\' \n\n";
+	else if(to == TYPE_CHAR && from == TYPE_FLOAT)
+		msg = "implicit conversion from \'float\' to \'char\' \n\n";
+	if(msg != NULL)
+		report(u, start_of(rhs), msg);
+}
+
+
+//type of the expression at n, reporting what it finds on the way
+static int check(unit *u, const Node *n){
+	if(n == NULL)
+		return TYPE_UNKNOWN;
+	if(is_leaf(n))
+		return n->type;
+
+	if(n->left != NULL && n->right != NULL && n->val == NULL && n->body == NULL){
+		if(is_op(n, assign_ops)){
+			int to = check(u, n->left);
+			check_conversion(u, to, check(u, n->right), n->right);
+			return to;
+		}
+		if(is_op(n, arith_ops)){
+			int a = check(u, n->left);
+			return arith_type(a, check(u, n->right));
+		}
+		if(is_op(n, compare_ops)){
+			check(u, n->left);
+			check(u, n->right);
+			return TYPE_INT;
+		}
+	}
+	if(strcmp(n->token, "++") == 0)
+		return check(u, n->left);
+	//a[i] has the type of the elements of a
+	if(strcmp(n->token, "[]") == 0){
+		if(check(u, n->right) == TYPE_FLOAT)
+			report(u, start_of(n->right), "array subscript is not an integer \n\n");
+		return check(u, n->left);
+	}
+
+	//the ternary operator has a value; statements and the rest do not
+	check(u, n->left);
+	int then = check(u, n->right);
+	int other = check(u, n->val);
+	check(u, n->body);
+	if(strcmp(n->token, "if") == 0 && n->val != NULL)
+		return arith_type(then, other);
+	return TYPE_UNKNOWN;
+}
+
+
+typedef struct pool{
+    unit *units;
+    int nunits;
+    atomic_int next;
+}pool;
+
+
+static void *worker(void *arg){
+	pool *p = arg;
+	int i;
+	while((i = atomic_fetch_add(&p->next, 1)) < p->nunits)
+		check(&p->units[i], p->units[i].root);
+	return NULL;
+}
+
+
+void sema_check(tree_stack *stack, int skip){
+	int n = 0;
+	for(tree_stack *s = stack; s != NULL && s->next != NULL; s = s->next)
+		n++;
+	n -= skip;
+	if(n <= 0)
+		return;
+
+	//the stack is newest first; units are numbered in source order
+	pool p;
+	p.units = calloc(n, sizeof(unit));
+	p.nunits = n;
+	atomic_init(&p.next, 0);
+	int i = n;
+	for(tree_stack *s = stack; i > 0; s = s->next)
+		p.units[--i].root = s->node;
+
+	int threads = jobs > 0 ? jobs : (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(threads > n)
+		threads = n;
+	if(threads <= 1){
+		worker(&p);
+	}
+	else{
+		//the calling thread is one of the workers
+		pthread_t *tids = malloc((threads - 1) * sizeof(pthread_t));
+		int started = 0;
+		while(started < threads - 1 && pthread_create(&tids[started], NULL, worker, &p) == 0)
+			started++;
+		worker(&p);
+		for(int t = 0; t < started; t++)
+			pthread_join(tids[t], NULL);
+		free(tids);
+	}
+
+	//hand them on in the order each tree found them; diag_flush sorts
+	for(i = 0; i < n; i++){
+		unit *u = &p.units[i];
+		for(uint32_t k = 0; k < u->ndiags; k++)
+			diag_report(u->diags[k].at, DIAG_WARNING, "%s", u->diags[k].msg);
+		free(u->diags);
+	}
+	free(p.units);
+}
@@ -0,0 +1,25 @@
+#ifndef SEMA_H
+#define SEMA_H
+
+#include "ast.h"
+
+/*
+    Semantic checks over the finished AST.
+
+    The grammar actions build the tree and the symbol table; the implicit
+    conversion warnings are found afterwards by this pass. Each top-level
+    tree (a function definition or a global declaration) is checked on its
+    own by a pool of threads: leaves carry the type of their symbol or
+    literal from the parse, so the checks only read the tree and never look
+    at the symbol table or any other shared state. Each tree's diagnostics
+    are buffered by its thread, then handed to diag.h, which prints them in
+    source order with the parse's other diagnostics.
+*/
+
+void sema_set_jobs(int jobs);		//threads; 0 (the default) is one per CPU
+
+//check the trees on the stack above the sentinel, skipping the bottom
+//`skip` ones (headers, checked when their pch was built)
+void sema_check(tree_stack *stack, int skip);
+
+#endif
@@ -0,0 +1,66 @@
+#include <stdlib.h>
+
+#include "srcpos.h"
+
+//starts[i] is the offset of line i+1; starts[0] is always 0
+static srcpos *starts = NULL;
+static int nlines = 0, cap = 0;
+
+
+static void push(srcpos start){
+	if(nlines == cap){
+		cap = cap ? cap * 2 : 1024;
+		starts = (srcpos*)realloc(starts, cap * sizeof(srcpos));
+	}
+	starts[nlines++] = start;
+}
+
+
+void lines_reset(void){
+	nlines = 0;
+	push(0);
+}
+
+
+void lines_add(srcpos start){
+	if(nlines == 0)
+		push(0);
+	push(start);
+}
+
+
+//index of the last line starting at or before pos
+static int find_line(srcpos pos){
+	int lo = 0, hi = nlines - 1;
+	while(lo < hi){
+		int mid = lo + (hi - lo + 1) / 2;
+		if(starts[mid] <= pos)
+			lo = mid;
+		else
+			hi = mid - 1;
+	}
+	return lo;
+}
+
+
+int srcpos_line(srcpos pos){
+	if(nlines == 0)
+		push(0);
+	return find_line(pos) + 1;
+}
+
+
+void srcpos_resolve(srcpos pos, int *line, int *col){
+	if(nlines == 0)
+		push(0);
+	int i = find_line(pos);
+	*line = i + 1;
+	*col = (int)(pos - starts[i]) + 1;
+}
+
+
+void print_loc(srcpos pos){
+	int line, col;
+	srcpos_resolve(pos, &line, &col);
+	printf("Line:%d:%d: ", line, col);
+}
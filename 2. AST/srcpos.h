@@ -0,0 +1,29 @@
+#ifndef SRCPOS_H
+#define SRCPOS_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+    Source positions for the front end.
+    Tokens, AST nodes, symbols and diagnostics carry a 4-byte byte offset into
+    the input instead of a copied line number. The lexer records the offset of
+    every line start as it scans, so an offset resolves to line and column
+    with a binary search over that index when something is actually printed.
+*/
+
+typedef uint32_t srcpos;
+
+//bison locations are a single offset; YYLLOC_DEFAULT is set in ast.y
+#define YYLTYPE srcpos
+#define YYLTYPE_IS_DECLARED 1
+
+void lines_reset(void);
+void lines_add(srcpos start);		//a new line begins at start
+
+int srcpos_line(srcpos pos);		//1-based
+void srcpos_resolve(srcpos pos, int *line, int *col);
+
+void print_loc(srcpos pos);			//"Line:12:5: " on stdout
+
+#endif
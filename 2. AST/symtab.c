@@ -0,0 +1,216 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "symtab.h"
+
+_Static_assert(sizeof(symtab_file_header) == 24, "symtab header layout");
+_Static_assert(sizeof(symtab_entry) == 28, "symtab entry layout");
+
+struct symtab{
+    const char *map;
+    size_t size;
+    const symtab_file_header *header;
+    const symtab_entry *entries;
+    const uint32_t *index;
+    const char *strings;
+};
+
+
+/* ---- writing ---- */
+
+static struct node **sort_nodes;
+
+
+static int by_name(const void *a, const void *b){
+	const struct node *x = sort_nodes[*(const uint32_t*)a];
+	const struct node *y = sort_nodes[*(const uint32_t*)b];
+	int c = strcmp(x->name, y->name);
+	if(c != 0)
+		return c;
+	if(x->scope != y->scope)
+		return x->scope < y->scope ? -1 : 1;
+	return *(const uint32_t*)a < *(const uint32_t*)b ? -1 : 1;
+}
+
+
+//string pool with the few distinct tokens shared
+typedef struct pool{
+    char *buf;
+    uint32_t size, cap;
+    uint32_t tokens[8];
+    int ntokens;
+}pool;
+
+
+static uint32_t pool_add(pool *p, const char *s){
+	uint32_t len = strlen(s) + 1;
+	uint32_t padded = (len + 3) & ~3u;
+	if(p->size + padded > p->cap){
+		p->cap = (p->size + padded) * 2;
+		p->buf = realloc(p->buf, p->cap);
+	}
+	uint32_t at = p->size;
+	memset(p->buf + at, 0, padded);
+	memcpy(p->buf + at, s, len);
+	p->size += padded;
+	return at;
+}
+
+
+static uint32_t pool_token(pool *p, const char *s){
+	for(int i = 0; i < p->ntokens; i++)
+		if(strcmp(p->buf + p->tokens[i], s) == 0)
+			return p->tokens[i];
+	uint32_t at = pool_add(p, s);
+	if(p->ntokens < 8)
+		p->tokens[p->ntokens++] = at;
+	return at;
+}
+
+
+int symtab_write(const char *path, struct node *symbols){
+	uint32_t n = 0;
+	for(struct node *s = symbols; s != NULL; s = s->link)
+		n++;
+
+	struct node **nodes = malloc((n ? n : 1) * sizeof(*nodes));
+	symtab_entry *entries = calloc(n ? n : 1, sizeof(*entries));
+	uint32_t *index = malloc((n ? n : 1) * sizeof(*index));
+	pool strings = {0};
+
+	uint32_t i = 0;
+	for(struct node *s = symbols; s != NULL; s = s->link, i++){
+		nodes[i] = s;
+		index[i] = i;
+	}
+	sort_nodes = nodes;
+	qsort(index, n, sizeof(*index), by_name);
+
+	//names are interned in sorted order, so equal names are adjacent
+	for(uint32_t k = 0; k < n; k++){
+		uint32_t e = index[k];
+		if(k > 0 && strcmp(nodes[e]->name, nodes[index[k - 1]]->name) == 0)
+			entries[e].name = entries[index[k - 1]].name;
+		else
+			entries[e].name = pool_add(&strings, nodes[e]->name);
+	}
+	for(i = 0; i < n; i++){
+		struct node *s = nodes[i];
+		entries[i].token = pool_token(&strings, s->token);
+		entries[i].line = srcpos_line(s->offset);
+		entries[i].offset = s->offset;
+		entries[i].scope = s->scope;
+		memcpy(&entries[i].value, &s->val, sizeof(entries[i].value));
+		entries[i].dtype = (int8_t)s->dtype;
+		entries[i].valid = (uint8_t)s->valid;
+	}
+
+	symtab_file_header h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, SYMTAB_MAGIC, sizeof(h.magic));
+	h.version = SYMTAB_VERSION;
+	h.count = n;
+	h.strings_size = strings.size;
+
+	FILE *fp = fopen(path, "wb");
+	int ok = fp != NULL
+		&& fwrite(&h, sizeof(h), 1, fp) == 1
+		&& fwrite(entries, sizeof(*entries), n, fp) == n
+		&& fwrite(index, sizeof(*index), n, fp) == n
+		&& fwrite(strings.buf, 1, strings.size, fp) == strings.size;
+	if(fp != NULL && fclose(fp) != 0)
+		ok = 0;
+	if(!ok)
+		fprintf(stderr, "symtab: cannot write %s\n", path);
+
+	free(nodes);
+	free(entries);
+	free(index);
+	free(strings.buf);
+	return ok ? 0 : -1;
+}
+
+
+/* ---- reading ---- */
+
+symtab *symtab_open(const char *path){
+	int fd = open(path, O_RDONLY);
+	if(fd < 0)
+		return NULL;
+	struct stat st;
+	if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(symtab_file_header)){
+		close(fd);
+		return NULL;
+	}
+	size_t size = st.st_size;
+	const char *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(map == MAP_FAILED)
+		return NULL;
+
+	const symtab_file_header *h = (const symtab_file_header*)map;
+	size_t need = sizeof(*h) + (size_t)h->count * (sizeof(symtab_entry) + sizeof(uint32_t)) + h->strings_size;
+	if(memcmp(h->magic, SYMTAB_MAGIC, sizeof(h->magic)) != 0 || h->version != SYMTAB_VERSION || need != size){
+		munmap((void*)map, size);
+		return NULL;
+	}
+
+	symtab *t = malloc(sizeof(symtab));
+	t->map = map;
+	t->size = size;
+	t->header = h;
+	t->entries = (const symtab_entry*)(h + 1);
+	t->index = (const uint32_t*)(t->entries + h->count);
+	t->strings = (const char*)(t->index + h->count);
+	return t;
+}
+
+
+void symtab_close(symtab *t){
+	if(t == NULL)
+		return;
+	munmap((void*)t->map, t->size);
+	free(t);
+}
+
+
+uint32_t symtab_count(const symtab *t){
+	return t->header->count;
+}
+
+
+const symtab_entry *symtab_at(const symtab *t, uint32_t i){
+	return &t->entries[i];
+}
+
+
+const symtab_entry *symtab_sorted(const symtab *t, uint32_t k){
+	return &t->entries[t->index[k]];
+}
+
+
+const char *symtab_string(const symtab *t, uint32_t offset){
+	return t->strings + offset;
+}
+
+
+uint32_t symtab_find(const symtab *t, const char *name, uint32_t *first){
+	uint32_t lo = 0, hi = t->header->count;
+	while(lo < hi){
+		uint32_t mid = lo + (hi - lo) / 2;
+		if(strcmp(symtab_string(t, symtab_sorted(t, mid)->name), name) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	*first = lo;
+	uint32_t end = lo;
+	while(end < t->header->count && strcmp(symtab_string(t, symtab_sorted(t, end)->name), name) == 0)
+		end++;
+	return end - lo;
+}
@@ -0,0 +1,59 @@
+#ifndef SYMTAB_H
+#define SYMTAB_H
+
+#include <stdint.h>
+
+#include "ast.h"
+
+/*
+    Binary symbol table snapshots.
+
+    symtab_write() saves the symbol table at the end of a parse: a header, one
+    fixed-size entry per symbol in table order, an index of entry numbers
+    sorted by name (then scope), and a pool of the NUL-terminated strings the
+    entries point into. Everything is 4-byte aligned and in the writer's byte
+    order, so a reader maps the file and uses it in place: symtab_find() is a
+    binary search over the index, and nothing is parsed or copied. A file from
+    a host of the other byte order reads its version byte-swapped and is
+    rejected. symtab.py reads the same format from Python, as little-endian.
+*/
+
+#define SYMTAB_MAGIC	"MINISYM"
+#define SYMTAB_VERSION	1
+
+typedef struct symtab_file_header{
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint32_t strings_size;
+    uint32_t reserved;
+}symtab_file_header;
+
+typedef struct symtab_entry{
+    uint32_t name;			//string pool offsets
+    uint32_t token;			//"identifier", "array", "function", "param"
+    uint32_t line;
+    uint32_t offset;		//byte offset in the source
+    int32_t scope;
+    uint32_t value;			//bits of the int, float or char, by dtype; an array's size
+    int8_t dtype;			//0 int, 1 float, 2 char, 3 void
+    uint8_t valid;
+    uint8_t pad[2];
+}symtab_entry;
+
+int symtab_write(const char *path, struct node *symbols);
+
+typedef struct symtab symtab;
+
+symtab *symtab_open(const char *path);
+void symtab_close(symtab *t);
+
+uint32_t symtab_count(const symtab *t);
+const symtab_entry *symtab_at(const symtab *t, uint32_t i);		//table order
+const symtab_entry *symtab_sorted(const symtab *t, uint32_t k);	//name order
+const char *symtab_string(const symtab *t, uint32_t offset);
+
+//number of symbols called name; they are symtab_sorted(t, *first) onwards
+uint32_t symtab_find(const symtab *t, const char *name, uint32_t *first);
+
+#endif
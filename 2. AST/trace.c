@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+#define TRACE_NAME_LEN   64
+#define TRACE_MAX_DEPTH  64
+
+typedef struct trace_event{
+    char name[TRACE_NAME_LEN];
+    int tid;
+    long long start;
+    long long end;
+}trace_event;
+
+static FILE *trace_file = NULL;
+static trace_event *events = NULL;
+static int nevents = 0, capevents = 0;
+
+static trace_event open_spans[TRACE_MAX_DEPTH];
+static int depth = 0;
+
+
+long long trace_now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+
+int trace_open(const char *path){
+	trace_file = fopen(path, "w");
+	if(trace_file == NULL){
+		fprintf(stderr, "trace: cannot open '%s'\n", path);
+		return -1;
+	}
+	return 0;
+}
+
+
+int trace_enabled(void){
+	return trace_file != NULL;
+}
+
+
+void trace_complete(const char *name, int tid, long long start, long long end){
+	if(trace_file == NULL)
+		return;
+
+	if(nevents == capevents){
+		capevents = capevents ? capevents * 2 : 1024;
+		events = (trace_event*)realloc(events, capevents * sizeof(trace_event));
+	}
+	trace_event *e = &events[nevents++];
+	strncpy(e->name, name, TRACE_NAME_LEN - 1);
+	e->name[TRACE_NAME_LEN - 1] = '\0';
+	e->tid = tid;
+	e->start = start;
+	e->end = end;
+}
+
+
+void trace_begin(const char *name){
+	if(trace_file == NULL || depth == TRACE_MAX_DEPTH)
+		return;
+
+	trace_event *e = &open_spans[depth++];
+	strncpy(e->name, name, TRACE_NAME_LEN - 1);
+	e->name[TRACE_NAME_LEN - 1] = '\0';
+	e->tid = TRACE_TID_PARSER;
+	e->start = trace_now();
+}
+
+
+void trace_end(void){
+	if(trace_file == NULL || depth == 0)
+		return;
+
+	trace_event *e = &open_spans[--depth];
+	trace_complete(e->name, e->tid, e->start, trace_now());
+}
+
+
+static void write_name(const char *s){
+	fputc('"', trace_file);
+	for(; *s; s++){
+		if(*s == '"' || *s == '\\')
+			fputc('\\', trace_file);
+		fputc(*s, trace_file);
+	}
+	fputc('"', trace_file);
+}
+
+
+void trace_close(void){
+	if(trace_file == NULL)
+		return;
+
+	//close anything left open by an early exit
+	while(depth > 0)
+		trace_end();
+
+	int pid = (int)getpid();
+
+	fprintf(trace_file, "{\"traceEvents\":[\n");
+	fprintf(trace_file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"front end\"}},\n", pid);
+	fprintf(trace_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"parser\"}},\n", pid, TRACE_TID_PARSER);
+	fprintf(trace_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"lexer\"}}", pid, TRACE_TID_LEXER);
+
+	for(int i = 0; i < nevents; i++){
+		trace_event *e = &events[i];
+		fprintf(trace_file, ",\n{\"name\":");
+		write_name(e->name);
+		fprintf(trace_file, ",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+			pid, e->tid, e->start / 1000.0, (e->end - e->start) / 1000.0);
+	}
+	fprintf(trace_file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+	fclose(trace_file);
+	trace_file = NULL;
+	free(events);
+	events = NULL;
+	nevents = capevents = 0;
+}
@@ -0,0 +1,25 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+    Chrome trace-event output for the front end.
+    Spans are buffered in memory and written as one JSON file by trace_close(),
+    so tracing does not add file I/O to the phases being measured.
+    Timestamps come from CLOCK_MONOTONIC, the same clock the Python driver uses,
+    so front end and driver events line up on one timeline.
+*/
+
+#define TRACE_TID_PARSER    1
+#define TRACE_TID_LEXER     2
+
+int trace_open(const char *path);
+void trace_close(void);
+int trace_enabled(void);
+
+long long trace_now(void);		//nanoseconds
+
+void trace_begin(const char *name);
+void trace_end(void);
+void trace_complete(const char *name, int tid, long long start, long long end);
+
+#endif
@@ -0,0 +1,197 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "alloc.h"
+#include "xref.h"
+
+_Static_assert(sizeof(xref_file_header) == 24, "xref header layout");
+_Static_assert(sizeof(xref_symbol) == 16, "xref symbol layout");
+_Static_assert(sizeof(xref_use) == 8, "xref use layout");
+
+struct xref{
+    const char *map;
+    size_t size;
+    const xref_file_header *header;
+    const xref_symbol *symbols;
+    const xref_use *uses;
+};
+
+
+/* ---- recording ---- */
+
+//use arrays live here rather than in struct node, so the symbol list that
+//checksym walks stays as dense as it was; slot 0 is never handed out
+typedef struct use_list{
+    srcpos *uses;			//sorted
+    uint32_t n, cap;
+}use_list;
+
+static use_list *lists;
+static uint32_t nlists, lists_cap, live;
+
+
+static use_list *list_of(struct node *sym){
+	if(sym->uses == 0){
+		if(nlists == 0)
+			nlists = 1;
+		if(nlists >= lists_cap){
+			lists_cap = lists_cap ? lists_cap * 2 : 64;
+			lists = (use_list*)realloc(lists, lists_cap * sizeof(use_list));
+		}
+		memset(&lists[nlists], 0, sizeof(use_list));
+		sym->uses = nlists++;
+		live++;
+	}
+	return &lists[sym->uses];
+}
+
+
+void xref_add(struct node *sym, srcpos at){
+	use_list *l = list_of(sym);
+	if(l->n == l->cap){
+		uint32_t cap = l->cap ? l->cap * 2 : 4;
+		srcpos *uses = (srcpos*)xmalloc(cap * sizeof(srcpos), ALLOC_XREF);
+		if(l->n > 0)
+			memcpy(uses, l->uses, l->n * sizeof(srcpos));
+		xfree(l->uses);
+		l->uses = uses;
+		l->cap = cap;
+	}
+	//reductions come in source order, so this is an append except for the
+	//occasional use reduced after a later one
+	uint32_t i = l->n++;
+	while(i > 0 && l->uses[i - 1] > at){
+		l->uses[i] = l->uses[i - 1];
+		i--;
+	}
+	l->uses[i] = at;
+}
+
+
+const srcpos *xref_symbol_uses(const struct node *sym, uint32_t *n){
+	if(sym->uses == 0){
+		*n = 0;
+		return NULL;
+	}
+	*n = lists[sym->uses].n;
+	return lists[sym->uses].uses;
+}
+
+
+void xref_release(struct node *sym){
+	if(sym->uses == 0)
+		return;
+	use_list *l = &lists[sym->uses];
+	xfree(l->uses);
+	memset(l, 0, sizeof(*l));
+	sym->uses = 0;
+	//slots are not reused one by one; the table starts over once no symbol
+	//holds one, which is after every unit's cleanup
+	if(--live == 0)
+		nlists = 0;
+}
+
+
+int xref_write(const char *path, struct node *symbols){
+	xref_file_header h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, XREF_MAGIC, sizeof(h.magic));
+	h.version = XREF_VERSION;
+	for(struct node *s = symbols; s != NULL; s = s->link){
+		uint32_t n;
+		xref_symbol_uses(s, &n);
+		h.count++;
+		h.nuses += n;
+	}
+
+	FILE *fp = fopen(path, "wb");
+	if(fp == NULL){
+		fprintf(stderr, "xref: cannot write %s\n", path);
+		return -1;
+	}
+	int ok = fwrite(&h, sizeof(h), 1, fp) == 1;
+	uint32_t first = 0;
+	for(struct node *s = symbols; s != NULL && ok; s = s->link){
+		uint32_t n;
+		xref_symbol_uses(s, &n);
+		xref_symbol r = {s->offset, srcpos_line(s->offset), first, n};
+		ok = fwrite(&r, sizeof(r), 1, fp) == 1;
+		first += n;
+	}
+	for(struct node *s = symbols; s != NULL && ok; s = s->link){
+		uint32_t n;
+		const srcpos *uses = xref_symbol_uses(s, &n);
+		for(uint32_t i = 0; i < n && ok; i++){
+			xref_use u = {uses[i], srcpos_line(uses[i])};
+			ok = fwrite(&u, sizeof(u), 1, fp) == 1;
+		}
+	}
+	if(fclose(fp) != 0)
+		ok = 0;
+	if(!ok)
+		fprintf(stderr, "xref: cannot write %s\n", path);
+	return ok ? 0 : -1;
+}
+
+
+/* ---- reading ---- */
+
+xref *xref_open(const char *path){
+	int fd = open(path, O_RDONLY);
+	if(fd < 0)
+		return NULL;
+	struct stat st;
+	if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(xref_file_header)){
+		close(fd);
+		return NULL;
+	}
+	size_t size = st.st_size;
+	const char *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(map == MAP_FAILED)
+		return NULL;
+
+	const xref_file_header *h = (const xref_file_header*)map;
+	size_t need = sizeof(*h) + (size_t)h->count * sizeof(xref_symbol) + (size_t)h->nuses * sizeof(xref_use);
+	if(memcmp(h->magic, XREF_MAGIC, sizeof(h->magic)) != 0 || h->version != XREF_VERSION || need != size){
+		munmap((void*)map, size);
+		return NULL;
+	}
+
+	xref *x = malloc(sizeof(xref));
+	x->map = map;
+	x->size = size;
+	x->header = h;
+	x->symbols = (const xref_symbol*)(h + 1);
+	x->uses = (const xref_use*)(x->symbols + h->count);
+	return x;
+}
+
+
+void xref_close(xref *x){
+	if(x == NULL)
+		return;
+	munmap((void*)x->map, x->size);
+	free(x);
+}
+
+
+uint32_t xref_count(const xref *x){
+	return x->header->count;
+}
+
+
+const xref_symbol *xref_symbol_at(const xref *x, uint32_t i){
+	return &x->symbols[i];
+}
+
+
+const xref_use *xref_uses(const xref *x, uint32_t i, uint32_t *n){
+	*n = x->symbols[i].nuses;
+	return x->uses + x->symbols[i].first;
+}
@@ -0,0 +1,58 @@
+#ifndef XREF_H
+#define XREF_H
+
+#include <stdint.h>
+
+#include "ast.h"
+
+/*
+    Use-def index.
+
+    The parser calls xref_add() each time primary_expression resolves an
+    identifier to its symbol, so every symbol gets a sorted array of the
+    places it is used, kept in a table beside the symbol list (struct node
+    only holds its slot); where it is declared is the symbol's own offset.
+    xref_write() saves the index beside symtab.bin with one record per
+    symbol in the same order, so record i belongs to symtab entry i: a
+    symbol's declaration and its uses are found by indexing, with no search
+    and no walk of the AST. xref.py reads the same format from Python.
+*/
+
+#define XREF_MAGIC		"MINIXRF"
+#define XREF_VERSION	1
+
+typedef struct xref_file_header{
+    char magic[8];
+    uint32_t version;
+    uint32_t count;			//symbols
+    uint32_t nuses;			//uses of all symbols
+    uint32_t reserved;
+}xref_file_header;
+
+typedef struct xref_symbol{
+    uint32_t def_offset;
+    uint32_t def_line;
+    uint32_t first;			//its uses are [first, first + nuses) of the use array
+    uint32_t nuses;
+}xref_symbol;
+
+typedef struct xref_use{
+    uint32_t offset;
+    uint32_t line;
+}xref_use;
+
+void xref_add(struct node *sym, srcpos at);
+const srcpos *xref_symbol_uses(const struct node *sym, uint32_t *n);	//sorted
+void xref_release(struct node *sym);
+int xref_write(const char *path, struct node *symbols);
+
+typedef struct xref xref;
+
+xref *xref_open(const char *path);
+void xref_close(xref *x);
+
+uint32_t xref_count(const xref *x);
+const xref_symbol *xref_symbol_at(const xref *x, uint32_t i);
+const xref_use *xref_uses(const xref *x, uint32_t i, uint32_t *n);
+
+#endif
@@ -74,12 +74,27 @@
     #include <string.h>
     #include <limits.h>
 
+    #include "ast.h"
+    #include "trace.h"
+    #include "perf.h"
+    #include "alloc.h"
+    #include "pch.h"
+    #include "symtab.h"
+    #include "xref.h"
+    #include "sema.h"
+    #include "diag.h"
+
     void yyerror(const char*);
     int yylex();
+    static int traced_yylex(void);
+    #define yylex traced_yylex
     extern FILE * yyin, *yyout;
 
+    //a symbol's location is where it starts: its first child, or where the
+    //previous symbol started if it is empty
+    #define YYLLOC_DEFAULT(Cur, Rhs, N)	((Cur) = (N) ? YYRHSLOC(Rhs, 1) : YYRHSLOC(Rhs, 0))
+
     int x=0;	
-    extern int line;
     int scope = 0;
 
     int unaryop = -1;		//unary operator type
@@ -91,60 +106,22 @@
 
     char tempStr[100];		//sprintf
 
-    struct node{
-        char token[20];
-        char name[20];
-        int dtype;
-        int scope;
-        int lineno;
-        int valid;
-        union value{
-            float f;
-            int i;
-            char c;
-        }val;
-        struct node *link;
-    }*first = NULL, *tmp, *crt, *lhs;
-
-    typedef struct Node{
-        struct Node *left;   // init
-        struct Node *right;  // cond
-        struct Node *val;    // incr
-        struct Node *body;   // body
-        char token[100];
-        int level;
-    }Node;
-
-    typedef struct tree_stack{
-        Node *node;
-        struct tree_stack *next;
-    }tree_stack;
+    //node tokens of the assignment operators, by assignop
+    static const char *const assign_tokens[] = {"=", "+=", "-=", "*=", "/=", "%="};
+
+    struct node *first = NULL, *tmp, *crt, *lhs;
 
     tree_stack *tree_top = NULL;
     char preBuf[1000000];
 
-    struct node * checksym(char *);
-    void addsymbol(struct node *,char *);	
-    void addInt(struct node *, int, int);
-    void addFloat(struct node *, int, float);
-    void addChar(struct node *, int, char);
-    void addfunc(struct node *t, int, char *);
-    void printsymtable();
-
-    struct node * addtosymbol(struct node * n);
-    void cleansymbol();
-
-    //AST 
-    void create_node(char *token, int leaf);
-    void push_tree(Node *newnode);
-    Node *pop_tree();
-    void preorder(Node* root);
-    void printtree(Node* root);
-    int getmaxlevel(Node *root);
-    void printGivenLevel(Node* root, int level, int h);
-    void get_levels(Node *root, int level);
-
-#line 148 "y.tab.c"
+    static const char *pch_out = NULL;		//--emit-pch: parse a header into this file
+    static const char *symtab_out = NULL;	//--symtab: binary symbol table snapshot
+    static const char *xref_out = NULL;		//--xref: use-def index
+
+    int embedded = 0;
+    void (*yylex_hook)(int token, srcpos at) = NULL;	//sees every token the parser reads
+
+#line 125 "y.tab.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -192,13 +169,13 @@ extern int yydebug;
     INCLUDE = 259,                 /* INCLUDE  */
     IOSTREAM = 260,                /* IOSTREAM  */
     STRING_LITERAL = 261,          /* STRING_LITERAL  */
-    HEADER_LITERAL = 262,          /* HEADER_LITERAL  */
-    PRINT = 263,                   /* PRINT  */
-    RETURN = 264,                  /* RETURN  */
-    INTEGER_LITERAL = 265,         /* INTEGER_LITERAL  */
-    CHARACTER_LITERAL = 266,       /* CHARACTER_LITERAL  */
-    FLOAT_LITERAL = 267,           /* FLOAT_LITERAL  */
-    IDENTIFIER = 268,              /* IDENTIFIER  */
+    PRINT = 262,                   /* PRINT  */
+    RETURN = 263,                  /* RETURN  */
+    INTEGER_LITERAL = 264,         /* INTEGER_LITERAL  */
+    CHARACTER_LITERAL = 265,       /* CHARACTER_LITERAL  */
+    FLOAT_LITERAL = 266,           /* FLOAT_LITERAL  */
+    IDENTIFIER = 267,              /* IDENTIFIER  */
+    HEADER_LITERAL = 268,          /* HEADER_LITERAL  */
     INC_OP = 269,                  /* INC_OP  */
     DEC_OP = 270,                  /* DEC_OP  */
     LE_OP = 271,                   /* LE_OP  */
@@ -230,13 +207,13 @@ extern int yydebug;
 #define INCLUDE 259
 #define IOSTREAM 260
 #define STRING_LITERAL 261
-#define HEADER_LITERAL 262
-#define PRINT 263
-#define RETURN 264
-#define INTEGER_LITERAL 265
-#define CHARACTER_LITERAL 266
-#define FLOAT_LITERAL 267
-#define IDENTIFIER 268
+#define PRINT 262
+#define RETURN 263
+#define INTEGER_LITERAL 264
+#define CHARACTER_LITERAL 265
+#define FLOAT_LITERAL 266
+#define IDENTIFIER 267
+#define HEADER_LITERAL 268
 #define INC_OP 269
 #define DEC_OP 270
 #define LE_OP 271
@@ -261,7 +238,7 @@ extern int yydebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 84 "ast.y"
+#line 63 "ast.y"
 
     int ival;
     float fval;
@@ -269,7 +246,7 @@ union YYSTYPE
     char string[128];
     struct node *ptr;
 
-#line 273 "y.tab.c"
+#line 250 "y.tab.c"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -277,9 +254,23 @@ typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
 
-extern YYSTYPE yylval;
 
+extern YYSTYPE yylval;
+extern YYLTYPE yylloc;
 
 int yyparse (void);
 
@@ -296,19 +287,19 @@ enum yysymbol_kind_t
   YYSYMBOL_INCLUDE = 4,                    /* INCLUDE  */
   YYSYMBOL_IOSTREAM = 5,                   /* IOSTREAM  */
   YYSYMBOL_STRING_LITERAL = 6,             /* STRING_LITERAL  */
-  YYSYMBOL_HEADER_LITERAL = 7,             /* HEADER_LITERAL  */
-  YYSYMBOL_PRINT = 8,                      /* PRINT  */
-  YYSYMBOL_RETURN = 9,                     /* RETURN  */
-  YYSYMBOL_10_ = 10,                       /* '+'  */
-  YYSYMBOL_11_ = 11,                       /* '-'  */
-  YYSYMBOL_12_ = 12,                       /* '/'  */
-  YYSYMBOL_13_ = 13,                       /* '*'  */
-  YYSYMBOL_14_ = 14,                       /* '%'  */
-  YYSYMBOL_15_ = 15,                       /* '='  */
-  YYSYMBOL_INTEGER_LITERAL = 16,           /* INTEGER_LITERAL  */
-  YYSYMBOL_CHARACTER_LITERAL = 17,         /* CHARACTER_LITERAL  */
-  YYSYMBOL_FLOAT_LITERAL = 18,             /* FLOAT_LITERAL  */
-  YYSYMBOL_IDENTIFIER = 19,                /* IDENTIFIER  */
+  YYSYMBOL_PRINT = 7,                      /* PRINT  */
+  YYSYMBOL_RETURN = 8,                     /* RETURN  */
+  YYSYMBOL_9_ = 9,                         /* '+'  */
+  YYSYMBOL_10_ = 10,                       /* '-'  */
+  YYSYMBOL_11_ = 11,                       /* '/'  */
+  YYSYMBOL_12_ = 12,                       /* '*'  */
+  YYSYMBOL_13_ = 13,                       /* '%'  */
+  YYSYMBOL_14_ = 14,                       /* '='  */
+  YYSYMBOL_INTEGER_LITERAL = 15,           /* INTEGER_LITERAL  */
+  YYSYMBOL_CHARACTER_LITERAL = 16,         /* CHARACTER_LITERAL  */
+  YYSYMBOL_FLOAT_LITERAL = 17,             /* FLOAT_LITERAL  */
+  YYSYMBOL_IDENTIFIER = 18,                /* IDENTIFIER  */
+  YYSYMBOL_HEADER_LITERAL = 19,            /* HEADER_LITERAL  */
   YYSYMBOL_INC_OP = 20,                    /* INC_OP  */
   YYSYMBOL_DEC_OP = 21,                    /* DEC_OP  */
   YYSYMBOL_LE_OP = 22,                     /* LE_OP  */
@@ -336,48 +327,55 @@ enum yysymbol_kind_t
   YYSYMBOL_44_ = 44,                       /* '('  */
   YYSYMBOL_45_ = 45,                       /* ')'  */
   YYSYMBOL_46_ = 46,                       /* ','  */
-  YYSYMBOL_47_ = 47,                       /* '?'  */
-  YYSYMBOL_48_ = 48,                       /* ':'  */
-  YYSYMBOL_49_ = 49,                       /* '!'  */
-  YYSYMBOL_50_ = 50,                       /* '~'  */
-  YYSYMBOL_YYACCEPT = 51,                  /* $accept  */
-  YYSYMBOL_S = 52,                         /* S  */
-  YYSYMBOL_program = 53,                   /* program  */
-  YYSYMBOL_translation_unit = 54,          /* translation_unit  */
-  YYSYMBOL_ext_dec = 55,                   /* ext_dec  */
-  YYSYMBOL_libraries = 56,                 /* libraries  */
-  YYSYMBOL_compound_statement = 57,        /* compound_statement  */
-  YYSYMBOL_block_item_list = 58,           /* block_item_list  */
-  YYSYMBOL_block_item = 59,                /* block_item  */
-  YYSYMBOL_printstat = 60,                 /* printstat  */
-  YYSYMBOL_declaration = 61,               /* declaration  */
-  YYSYMBOL_statement = 62,                 /* statement  */
-  YYSYMBOL_condition_statement = 63,       /* condition_statement  */
-  YYSYMBOL_iteration_statement = 64,       /* iteration_statement  */
-  YYSYMBOL_type_specifier = 65,            /* type_specifier  */
-  YYSYMBOL_init_declarator_list = 66,      /* init_declarator_list  */
-  YYSYMBOL_init_declarator = 67,           /* init_declarator  */
-  YYSYMBOL_68_1 = 68,                      /* $@1  */
-  YYSYMBOL_assignment_expression = 69,     /* assignment_expression  */
-  YYSYMBOL_70_2 = 70,                      /* $@2  */
-  YYSYMBOL_assignment_operator = 71,       /* assignment_operator  */
-  YYSYMBOL_conditional_expression = 72,    /* conditional_expression  */
-  YYSYMBOL_expression_statement = 73,      /* expression_statement  */
-  YYSYMBOL_expression = 74,                /* expression  */
-  YYSYMBOL_primary_expression = 75,        /* primary_expression  */
-  YYSYMBOL_postfix_expression = 76,        /* postfix_expression  */
-  YYSYMBOL_unary_expression = 77,          /* unary_expression  */
-  YYSYMBOL_unary_operator = 78,            /* unary_operator  */
-  YYSYMBOL_equality_expression = 79,       /* equality_expression  */
-  YYSYMBOL_relational_expression = 80,     /* relational_expression  */
-  YYSYMBOL_additive_expression = 81,       /* additive_expression  */
-  YYSYMBOL_multiplicative_expression = 82, /* multiplicative_expression  */
-  YYSYMBOL_function_definition = 83,       /* function_definition  */
-  YYSYMBOL_function_call = 84,             /* function_call  */
-  YYSYMBOL_declarator = 85,                /* declarator  */
-  YYSYMBOL_parameter_list = 86,            /* parameter_list  */
-  YYSYMBOL_parameter_declaration = 87,     /* parameter_declaration  */
-  YYSYMBOL_identifier_list = 88            /* identifier_list  */
+  YYSYMBOL_47_ = 47,                       /* '['  */
+  YYSYMBOL_48_ = 48,                       /* ']'  */
+  YYSYMBOL_49_ = 49,                       /* '?'  */
+  YYSYMBOL_50_ = 50,                       /* ':'  */
+  YYSYMBOL_51_ = 51,                       /* '!'  */
+  YYSYMBOL_52_ = 52,                       /* '~'  */
+  YYSYMBOL_YYACCEPT = 53,                  /* $accept  */
+  YYSYMBOL_S = 54,                         /* S  */
+  YYSYMBOL_program = 55,                   /* program  */
+  YYSYMBOL_include_list = 56,              /* include_list  */
+  YYSYMBOL_include = 57,                   /* include  */
+  YYSYMBOL_translation_unit = 58,          /* translation_unit  */
+  YYSYMBOL_ext_dec = 59,                   /* ext_dec  */
+  YYSYMBOL_libraries = 60,                 /* libraries  */
+  YYSYMBOL_compound_statement = 61,        /* compound_statement  */
+  YYSYMBOL_block_item_list = 62,           /* block_item_list  */
+  YYSYMBOL_block_item = 63,                /* block_item  */
+  YYSYMBOL_printstat = 64,                 /* printstat  */
+  YYSYMBOL_declaration = 65,               /* declaration  */
+  YYSYMBOL_statement = 66,                 /* statement  */
+  YYSYMBOL_condition_statement = 67,       /* condition_statement  */
+  YYSYMBOL_iteration_statement = 68,       /* iteration_statement  */
+  YYSYMBOL_type_specifier = 69,            /* type_specifier  */
+  YYSYMBOL_init_declarator_list = 70,      /* init_declarator_list  */
+  YYSYMBOL_init_declarator = 71,           /* init_declarator  */
+  YYSYMBOL_72_1 = 72,                      /* $@1  */
+  YYSYMBOL_assignment_expression = 73,     /* assignment_expression  */
+  YYSYMBOL_74_2 = 74,                      /* $@2  */
+  YYSYMBOL_assignment_operator = 75,       /* assignment_operator  */
+  YYSYMBOL_conditional_expression = 76,    /* conditional_expression  */
+  YYSYMBOL_expression_statement = 77,      /* expression_statement  */
+  YYSYMBOL_expression = 78,                /* expression  */
+  YYSYMBOL_primary_expression = 79,        /* primary_expression  */
+  YYSYMBOL_postfix_expression = 80,        /* postfix_expression  */
+  YYSYMBOL_81_3 = 81,                      /* @3  */
+  YYSYMBOL_unary_expression = 82,          /* unary_expression  */
+  YYSYMBOL_unary_operator = 83,            /* unary_operator  */
+  YYSYMBOL_equality_expression = 84,       /* equality_expression  */
+  YYSYMBOL_relational_expression = 85,     /* relational_expression  */
+  YYSYMBOL_additive_expression = 86,       /* additive_expression  */
+  YYSYMBOL_multiplicative_expression = 87, /* multiplicative_expression  */
+  YYSYMBOL_function_definition = 88,       /* function_definition  */
+  YYSYMBOL_89_4 = 89,                      /* $@4  */
+  YYSYMBOL_90_5 = 90,                      /* $@5  */
+  YYSYMBOL_function_call = 91,             /* function_call  */
+  YYSYMBOL_declarator = 92,                /* declarator  */
+  YYSYMBOL_parameter_list = 93,            /* parameter_list  */
+  YYSYMBOL_parameter_declaration = 94,     /* parameter_declaration  */
+  YYSYMBOL_identifier_list = 95            /* identifier_list  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -644,13 +642,15 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
   yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
@@ -659,8 +659,9 @@ union yyalloc
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
-      + YYSTACK_GAP_MAXIMUM)
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
 
@@ -703,18 +704,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  16
+#define YYFINAL  18
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   255
+#define YYLAST   265
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  51
+#define YYNTOKENS  53
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  38
+#define YYNNTS  43
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  99
+#define YYNRULES  107
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  170
+#define YYNSTATES  181
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   287
@@ -734,16 +735,16 @@ static const yytype_int8 yytranslate[] =
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    49,     2,     2,     2,    14,     2,     2,
-      44,    45,    13,    10,    46,    11,     2,    12,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    48,    43,
-      39,    15,    40,    47,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    51,     2,     2,     2,    13,     2,     2,
+      44,    45,    12,     9,    46,    10,     2,    11,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    50,    43,
+      39,    14,    40,    49,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    47,     2,    48,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    41,     2,    42,    50,     2,     2,     2,
+       2,     2,     2,    41,     2,    42,    52,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -757,7 +758,7 @@ static const yytype_int8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    16,    17,    18,    19,    20,
+       5,     6,     7,     8,    15,    16,    17,    18,    19,    20,
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
       31,    32,    33,    34,    35,    36,    37,    38
 };
@@ -766,16 +767,17 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   118,   118,   126,   127,   128,   132,   133,   137,   138,
-     142,   146,   147,   151,   152,   159,   160,   161,   162,   166,
-     170,   171,   175,   179,   190,   191,   192,   197,   209,   227,
-     242,   249,   250,   251,   252,   256,   257,   261,   261,   369,
-     436,   437,   437,   686,   687,   688,   689,   690,   691,   696,
-     697,   720,   721,   725,   726,   730,   764,   773,   779,   785,
-     792,   793,   794,   798,   799,   815,   816,   817,   818,   819,
-     820,   824,   825,   830,   838,   839,   844,   849,   854,   862,
-     863,   868,   876,   877,   882,   896,   912,   928,   953,   954,
-     959,   964,   965,   966,   970,   971,   975,   976,   980,   981
+       0,    98,    98,   126,   127,   131,   132,   136,   137,   141,
+     142,   146,   147,   151,   155,   156,   160,   161,   168,   169,
+     170,   171,   175,   179,   180,   184,   188,   199,   200,   201,
+     206,   221,   242,   259,   266,   267,   268,   269,   273,   274,
+     278,   278,   339,   401,   438,   439,   439,   567,   568,   569,
+     570,   571,   572,   577,   578,   604,   605,   609,   610,   614,
+     650,   660,   667,   676,   683,   684,   684,   691,   692,   696,
+     697,   713,   714,   715,   716,   717,   718,   722,   723,   728,
+     736,   737,   742,   747,   752,   760,   761,   766,   774,   775,
+     780,   790,   802,   802,   819,   819,   841,   842,   847,   852,
+     853,   854,   858,   859,   863,   864,   868,   869
 };
 #endif
 
@@ -792,24 +794,25 @@ static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 static const char *const yytname[] =
 {
   "\"end of file\"", "error", "\"invalid token\"", "HASH", "INCLUDE",
-  "IOSTREAM", "STRING_LITERAL", "HEADER_LITERAL", "PRINT", "RETURN", "'+'",
-  "'-'", "'/'", "'*'", "'%'", "'='", "INTEGER_LITERAL",
-  "CHARACTER_LITERAL", "FLOAT_LITERAL", "IDENTIFIER", "INC_OP", "DEC_OP",
+  "IOSTREAM", "STRING_LITERAL", "PRINT", "RETURN", "'+'", "'-'", "'/'",
+  "'*'", "'%'", "'='", "INTEGER_LITERAL", "CHARACTER_LITERAL",
+  "FLOAT_LITERAL", "IDENTIFIER", "HEADER_LITERAL", "INC_OP", "DEC_OP",
   "LE_OP", "GE_OP", "EQ_OP", "NE_OP", "MUL_ASSIGN", "DIV_ASSIGN",
   "MOD_ASSIGN", "ADD_ASSIGN", "SUB_ASSIGN", "CHAR", "INT", "FLOAT", "VOID",
   "FOR", "WHILE", "IF", "ELSE", "'<'", "'>'", "'{'", "'}'", "';'", "'('",
-  "')'", "','", "'?'", "':'", "'!'", "'~'", "$accept", "S", "program",
-  "translation_unit", "ext_dec", "libraries", "compound_statement",
-  "block_item_list", "block_item", "printstat", "declaration", "statement",
-  "condition_statement", "iteration_statement", "type_specifier",
-  "init_declarator_list", "init_declarator", "$@1",
-  "assignment_expression", "$@2", "assignment_operator",
-  "conditional_expression", "expression_statement", "expression",
-  "primary_expression", "postfix_expression", "unary_expression",
-  "unary_operator", "equality_expression", "relational_expression",
-  "additive_expression", "multiplicative_expression",
-  "function_definition", "function_call", "declarator", "parameter_list",
-  "parameter_declaration", "identifier_list", YY_NULLPTR
+  "')'", "','", "'['", "']'", "'?'", "':'", "'!'", "'~'", "$accept", "S",
+  "program", "include_list", "include", "translation_unit", "ext_dec",
+  "libraries", "compound_statement", "block_item_list", "block_item",
+  "printstat", "declaration", "statement", "condition_statement",
+  "iteration_statement", "type_specifier", "init_declarator_list",
+  "init_declarator", "$@1", "assignment_expression", "$@2",
+  "assignment_operator", "conditional_expression", "expression_statement",
+  "expression", "primary_expression", "postfix_expression", "@3",
+  "unary_expression", "unary_operator", "equality_expression",
+  "relational_expression", "additive_expression",
+  "multiplicative_expression", "function_definition", "$@4", "$@5",
+  "function_call", "declarator", "parameter_list", "parameter_declaration",
+  "identifier_list", YY_NULLPTR
 };
 
 static const char *
@@ -819,12 +822,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-78)
+#define YYPACT_NINF (-87)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-94)
+#define YYTABLE_NINF (-102)
 
 #define yytable_value_is_error(Yyn) \
   0
@@ -833,23 +836,25 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      38,    11,   -78,   -78,   -78,   -78,   -78,    22,   -78,   158,
-     -78,   -78,     6,   -78,   -27,     1,   -78,   -78,    24,   -25,
-     -78,   -27,    93,    43,   -78,    38,    50,    74,   -78,    54,
-     -78,    52,    17,   -78,   -78,   -78,   -78,   -78,    62,   -78,
-     -78,   101,   116,   126,   -78,   -78,   177,   -78,   -78,   -78,
-     130,   -78,   135,   -78,   -78,   -78,   -78,    54,   -78,   -78,
-     -78,    44,   -78,    58,   129,   177,   -15,   189,   112,   140,
-     156,   163,   -78,   -78,   191,    87,   -78,   123,   -78,   -78,
-     173,   177,   217,   -78,   239,   -78,   -78,    17,   177,   177,
-     179,   -78,   -78,   -78,   -78,   177,   -78,   -78,   190,   -78,
-     177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
-     177,   177,   -78,    86,   -78,   -78,    51,   -78,   227,    38,
-     -78,   185,    17,   -78,    41,    76,   -78,   -78,   -78,   -78,
-     -78,   -78,   -78,   -78,   177,   189,   189,    45,   112,   112,
-     112,   112,   140,   140,   -78,   -78,   -78,   203,   194,   -78,
-     -78,   -78,   -78,   177,   177,   165,   165,   -78,   177,   204,
-     196,   198,   -78,   211,   -78,   -78,   165,   165,   -78,   -78
+     174,     6,   -87,   -87,   -87,   -87,   -87,    47,   -87,   174,
+     -87,   203,   -87,   -87,    48,   -87,    30,    10,   -87,   -87,
+     203,   -87,    16,   -25,   -87,    30,    75,    38,   -87,    79,
+      73,    96,   -87,    78,    38,   -87,   -87,   114,    76,   -87,
+      97,    82,   -87,   -87,    99,   141,    60,    -3,   -87,   -87,
+     -87,   -87,   153,   -87,   178,   156,     7,   -87,   -87,   -87,
+     -87,   -87,   189,   -87,   -87,   204,   205,   206,   -87,   -87,
+      60,   -87,   -87,   -87,   120,   -87,   176,   -87,   -87,   -87,
+     -87,    78,   -87,   -87,   -87,    22,   -87,   -13,   197,    60,
+      37,    33,   150,   137,   179,   209,   -87,   -87,   -87,   -87,
+     -87,   -87,   248,   -87,     7,    60,    60,   124,   -87,   -87,
+     -87,   -87,    60,   -87,   -87,   -87,   202,   -87,    60,    60,
+      60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
+     -87,   113,   135,     7,   -87,   143,   175,   -87,   -87,    60,
+     -87,   -87,   -87,   -87,   -87,   -87,    60,    33,    33,   -37,
+     150,   150,   150,   150,   137,   137,   -87,   -87,   -87,   211,
+     167,   -87,    60,    60,   158,   158,    39,   -87,    60,   212,
+     172,   199,   -87,   219,   -87,   -87,   -87,   158,   158,   -87,
+     -87
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -857,41 +862,45 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int8 yydefact[] =
 {
-       0,     0,    90,    32,    33,    34,    31,     0,     2,     5,
-       6,     8,     0,     9,     0,     0,     1,     7,    39,     0,
-      35,     0,     0,     0,    87,     0,     0,     0,    22,     0,
-      86,     0,     0,    65,    66,    56,    58,    57,    55,    69,
-      70,     0,     0,     0,    11,    51,     0,    67,    68,    23,
-       0,    13,     0,    15,    16,    26,    25,     0,    53,    40,
-      24,     0,    60,    63,    82,     0,    49,    71,    74,    79,
-       0,     0,    98,    93,    97,     0,    94,     0,     4,    10,
-       0,     0,    39,    36,     0,    55,    18,     0,     0,     0,
-       0,    12,    14,    19,    52,     0,    61,    62,     0,    64,
+       0,     0,    98,    35,    36,    37,    34,     0,     2,     0,
+       5,     4,     9,    11,     0,    12,    94,     0,     1,     6,
+       3,    10,    42,     0,    38,    92,     0,     0,     8,     0,
+       0,     0,    25,     0,     0,   106,   101,   105,     0,   102,
+       0,     0,    95,    13,     0,     0,     0,    42,    39,    93,
+     104,    99,     0,   100,     0,     0,     0,    71,    72,    60,
+      62,    61,    59,    75,    76,     0,     0,     0,    14,    55,
+       0,    73,    74,    26,     0,    16,     0,    18,    19,    29,
+      28,     0,    57,    44,    27,     0,    64,    69,    88,     0,
+      53,    77,    80,    85,     0,     0,     7,    43,    59,    41,
+     103,   107,     0,    21,     0,     0,     0,     0,    15,    17,
+      22,    56,     0,    67,    68,    65,     0,    70,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    17,     0,    96,    91,     0,    92,     0,     0,
-      38,     0,     0,    82,     0,     0,    59,    54,    43,    46,
-      47,    48,    44,    45,     0,    72,    73,     0,    77,    78,
-      75,    76,    80,    81,    84,    83,    85,    89,     0,    95,
-      99,     3,    20,     0,     0,     0,     0,    42,     0,    88,
-       0,     0,    30,    27,    50,    21,     0,     0,    29,    28
+      20,     0,     0,     0,    88,     0,     0,    63,    58,     0,
+      47,    50,    51,    52,    48,    49,     0,    78,    79,     0,
+      83,    84,    81,    82,    86,    87,    90,    89,    91,    97,
+       0,    23,     0,     0,     0,     0,     0,    46,     0,    96,
+       0,     0,    33,    30,    66,    54,    24,     0,     0,    32,
+      31
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-     -78,   -78,   -22,   -78,   241,   -78,    -1,   -78,   201,   -78,
-       4,    67,   -78,   -78,   -21,   -78,   223,   -78,   -76,   -78,
-     -78,    95,   -28,   -46,   -78,   -78,   -58,   -78,   -78,   -77,
-     132,    96,   -78,   -78,    -6,   -78,   138,   142
+     -87,   -87,   -87,   -87,   249,   250,    -6,   -87,    19,   -87,
+     186,   -87,   -29,    26,   -87,   -87,   -26,   -87,   228,   -87,
+     -45,   -87,   -87,    94,   -50,   -68,   -87,   -87,   -87,   -86,
+     -87,   -87,   133,   119,   121,   -87,   -87,   -87,   -87,   -10,
+     -87,   213,   132
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_uint8 yydefgoto[] =
 {
-       0,     7,     8,     9,    10,    80,    49,    50,    51,    52,
-      11,    54,    55,    56,    12,    19,    20,    27,    58,    98,
-     134,    59,    60,    61,    62,    63,    64,    65,    66,    67,
-      68,    69,    13,    70,    14,    75,    76,    77
+       0,     7,     8,     9,    10,    11,    12,    44,    73,    74,
+      75,    76,    13,    78,    79,    80,    14,    23,    24,    31,
+      82,   116,   146,    83,    84,    85,    86,    87,   139,    88,
+      89,    90,    91,    92,    93,    15,    34,    27,    94,    16,
+      38,    39,    40
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -899,115 +908,121 @@ static const yytype_uint8 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      90,    57,    74,    78,    86,   120,    21,    99,    25,   100,
-     101,   124,   125,    24,    22,    15,    71,    23,    28,   127,
-      30,    29,    16,   135,   136,    18,    53,    33,    34,    57,
-     123,   123,   102,    35,    36,    37,    85,    39,    40,   -37,
-      26,     1,   123,   123,    71,   123,   123,   123,   123,   123,
-     123,   144,   145,   146,    53,    79,   137,     2,   157,   122,
-      45,    46,    72,   103,   104,   -90,    47,    48,   -90,     3,
-       4,     5,     6,    82,     3,     4,     5,     6,    96,    97,
-     105,   106,     3,     4,     5,     6,   155,    94,    73,    81,
-      95,    95,    74,   158,   154,    74,    84,   151,   103,   104,
-     123,    31,    32,    33,    34,    72,   -90,   160,   161,    35,
-      36,    37,    38,    39,    40,   105,   106,     3,     4,     5,
-       6,   156,   107,   108,     3,     4,     5,     6,    41,    42,
-      43,   147,   115,   116,    22,    44,    45,    46,    31,    32,
-      33,    34,    47,    48,   -41,    87,    35,    36,    37,    38,
-      39,    40,   109,   110,   111,   -41,   -41,   -41,   -41,   -41,
-      88,     3,     4,     5,     6,    41,    42,    43,   117,   118,
-      89,    22,    91,    45,    46,    33,    34,     2,    93,    47,
-      48,    35,    36,    37,    85,    39,    40,    33,    34,     3,
-       4,     5,     6,    35,    36,    37,    85,    39,    40,   112,
-      41,    42,    43,   142,   143,   128,    22,   113,    45,    46,
-     114,   103,   104,   119,    47,    48,   129,   130,   131,   132,
-     133,    46,   162,   163,   126,    95,    47,    48,   105,   106,
-     152,   153,   -37,   168,   169,   138,   139,   140,   141,   159,
-     118,   165,    95,   166,    95,   121,   150,   -93,   -92,   167,
-      17,    92,    83,   164,   149,   148
+      37,    99,   107,   117,    25,    21,   103,   113,   114,   112,
+      17,   -40,    77,   168,    21,    81,    57,    58,    32,   134,
+     134,    33,    59,    60,    61,    98,    37,    63,    64,    28,
+     -40,    95,   134,   134,   115,   134,   134,   134,   134,   134,
+     134,   156,   157,   158,    30,    77,    42,    18,    81,    29,
+      69,    70,   149,    49,   133,   121,   122,   -98,    71,    72,
+     -98,   118,   119,    30,    95,   111,    22,   138,   112,    57,
+      58,   166,   123,   124,    26,    59,    60,    61,    98,    41,
+      63,    64,   134,   163,    43,   112,   120,   174,    45,    55,
+      56,    57,    58,    35,   170,   171,    47,    59,    60,    61,
+      62,   167,    63,    64,    70,    37,     3,     4,     5,     6,
+      46,    71,    72,     3,     4,     5,     6,    65,    66,    67,
+      36,    51,    52,    41,    68,    69,    70,    55,    56,    57,
+      58,    35,    50,    71,    72,    59,    60,    61,    62,    96,
+      63,    64,    53,    54,     3,     4,     5,     6,   127,   128,
+     129,     3,     4,     5,     6,    65,    66,    67,   159,   125,
+     126,    41,   108,    69,    70,   121,   122,    57,    58,   137,
+     112,    71,    72,    59,    60,    61,    98,     1,    63,    64,
+     161,   162,   123,   124,     3,     4,     5,     6,   164,    97,
+     172,   173,     2,    65,    66,    67,   101,   121,   122,    41,
+     102,    69,    70,   179,   180,     3,     4,     5,     6,    71,
+      72,   -45,   169,    54,   123,   124,   140,   176,   112,   110,
+     165,     2,   130,   -45,   -45,   -45,   -45,   -45,   141,   142,
+     143,   144,   145,   -98,     3,     4,     5,     6,   135,   136,
+     150,   151,   152,   153,   177,   112,   154,   155,   104,   105,
+     106,   147,   148,   131,   132,  -101,  -100,   178,    19,    20,
+     109,    48,   175,   160,     0,   100
 };
 
-static const yytype_uint8 yycheck[] =
+static const yytype_int16 yycheck[] =
 {
-      46,    22,    23,    25,    32,    81,    12,    65,     7,    24,
-      25,    88,    89,    14,    41,     4,    22,    44,    43,    95,
-      21,    46,     0,   100,   101,    19,    22,    10,    11,    50,
-      88,    89,    47,    16,    17,    18,    19,    20,    21,    15,
-      39,     3,   100,   101,    50,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,    50,     5,   102,    19,   134,    87,
-      43,    44,    19,    22,    23,    41,    49,    50,    44,    31,
-      32,    33,    34,    19,    31,    32,    33,    34,    20,    21,
-      39,    40,    31,    32,    33,    34,    45,    43,    45,    15,
-      46,    46,   113,    48,   122,   116,    44,   119,    22,    23,
-     158,     8,     9,    10,    11,    19,    44,   153,   154,    16,
-      17,    18,    19,    20,    21,    39,    40,    31,    32,    33,
-      34,    45,    10,    11,    31,    32,    33,    34,    35,    36,
-      37,    45,    45,    46,    41,    42,    43,    44,     8,     9,
-      10,    11,    49,    50,    15,    44,    16,    17,    18,    19,
-      20,    21,    12,    13,    14,    26,    27,    28,    29,    30,
-      44,    31,    32,    33,    34,    35,    36,    37,    45,    46,
-      44,    41,    42,    43,    44,    10,    11,    19,    43,    49,
-      50,    16,    17,    18,    19,    20,    21,    10,    11,    31,
-      32,    33,    34,    16,    17,    18,    19,    20,    21,    43,
-      35,    36,    37,   107,   108,    15,    41,    44,    43,    44,
-      19,    22,    23,    40,    49,    50,    26,    27,    28,    29,
-      30,    44,   155,   156,    45,    46,    49,    50,    39,    40,
-      45,    46,    15,   166,   167,   103,   104,   105,   106,    45,
-      46,    45,    46,    45,    46,     6,    19,    44,    44,    38,
-       9,    50,    29,   158,   116,   113
+      26,    46,    70,    89,    14,    11,    56,    20,    21,    46,
+       4,    14,    41,    50,    20,    41,     9,    10,    43,   105,
+     106,    46,    15,    16,    17,    18,    52,    20,    21,    19,
+      14,    41,   118,   119,    47,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,    47,    74,    27,     0,    74,    39,
+      43,    44,   120,    34,   104,    22,    23,    41,    51,    52,
+      44,    24,    25,    47,    74,    43,    18,   112,    46,     9,
+      10,   139,    39,    40,    44,    15,    16,    17,    18,    41,
+      20,    21,   168,   133,     5,    46,    49,    48,    15,     7,
+       8,     9,    10,    18,   162,   163,    18,    15,    16,    17,
+      18,   146,    20,    21,    44,   131,    31,    32,    33,    34,
+      14,    51,    52,    31,    32,    33,    34,    35,    36,    37,
+      45,    45,    46,    41,    42,    43,    44,     7,     8,     9,
+      10,    18,    18,    51,    52,    15,    16,    17,    18,    40,
+      20,    21,    45,    46,    31,    32,    33,    34,    11,    12,
+      13,    31,    32,    33,    34,    35,    36,    37,    45,     9,
+      10,    41,    42,    43,    44,    22,    23,     9,    10,    45,
+      46,    51,    52,    15,    16,    17,    18,     3,    20,    21,
+      45,    46,    39,    40,    31,    32,    33,    34,    45,    48,
+     164,   165,    18,    35,    36,    37,    18,    22,    23,    41,
+      44,    43,    44,   177,   178,    31,    32,    33,    34,    51,
+      52,    14,    45,    46,    39,    40,    14,    45,    46,    43,
+      45,    18,    43,    26,    27,    28,    29,    30,    26,    27,
+      28,    29,    30,    44,    31,    32,    33,    34,   105,   106,
+     121,   122,   123,   124,    45,    46,   125,   126,    44,    44,
+      44,   118,   119,    44,     6,    44,    44,    38,     9,     9,
+      74,    33,   168,   131,    -1,    52
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
-       0,     3,    19,    31,    32,    33,    34,    52,    53,    54,
-      55,    61,    65,    83,    85,     4,     0,    55,    19,    66,
-      67,    85,    41,    44,    57,     7,    39,    68,    43,    46,
-      57,     8,     9,    10,    11,    16,    17,    18,    19,    20,
-      21,    35,    36,    37,    42,    43,    44,    49,    50,    57,
-      58,    59,    60,    61,    62,    63,    64,    65,    69,    72,
-      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-      84,    85,    19,    45,    65,    86,    87,    88,    53,     5,
-      56,    15,    19,    67,    44,    19,    73,    44,    44,    44,
-      74,    42,    59,    43,    43,    46,    20,    21,    70,    77,
-      24,    25,    47,    22,    23,    39,    40,    10,    11,    12,
-      13,    14,    43,    44,    19,    45,    46,    45,    46,    40,
-      69,     6,    73,    77,    80,    80,    45,    69,    15,    26,
-      27,    28,    29,    30,    71,    80,    80,    74,    81,    81,
-      81,    81,    82,    82,    77,    77,    77,    45,    88,    87,
-      19,    53,    45,    46,    73,    45,    45,    69,    48,    45,
-      74,    74,    62,    62,    72,    45,    45,    38,    62,    62
+       0,     3,    18,    31,    32,    33,    34,    54,    55,    56,
+      57,    58,    59,    65,    69,    88,    92,     4,     0,    57,
+      58,    59,    18,    70,    71,    92,    44,    90,    19,    39,
+      47,    72,    43,    46,    89,    18,    45,    69,    93,    94,
+      95,    41,    61,     5,    60,    15,    14,    18,    71,    61,
+      18,    45,    46,    45,    46,     7,     8,     9,    10,    15,
+      16,    17,    18,    20,    21,    35,    36,    37,    42,    43,
+      44,    51,    52,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    73,    76,    77,    78,    79,    80,    82,    83,
+      84,    85,    86,    87,    91,    92,    40,    48,    18,    73,
+      94,    18,    44,    77,    44,    44,    44,    78,    42,    63,
+      43,    43,    46,    20,    21,    47,    74,    82,    24,    25,
+      49,    22,    23,    39,    40,     9,    10,    11,    12,    13,
+      43,    44,     6,    77,    82,    85,    85,    45,    73,    81,
+      14,    26,    27,    28,    29,    30,    75,    85,    85,    78,
+      86,    86,    86,    86,    87,    87,    82,    82,    82,    45,
+      95,    45,    46,    77,    45,    45,    78,    73,    50,    45,
+      78,    78,    66,    66,    48,    76,    45,    45,    38,    66,
+      66
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    51,    52,    53,    53,    53,    54,    54,    55,    55,
-      56,    57,    57,    58,    58,    59,    59,    59,    59,    59,
-      60,    60,    61,    62,    62,    62,    62,    63,    63,    64,
-      64,    65,    65,    65,    65,    66,    66,    68,    67,    67,
-      69,    70,    69,    71,    71,    71,    71,    71,    71,    72,
-      72,    73,    73,    74,    74,    75,    75,    75,    75,    75,
-      76,    76,    76,    77,    77,    78,    78,    78,    78,    78,
-      78,    79,    79,    79,    80,    80,    80,    80,    80,    81,
-      81,    81,    82,    82,    82,    82,    83,    83,    84,    84,
-      85,    85,    85,    85,    86,    86,    87,    87,    88,    88
+       0,    53,    54,    55,    55,    56,    56,    57,    57,    58,
+      58,    59,    59,    60,    61,    61,    62,    62,    63,    63,
+      63,    63,    63,    64,    64,    65,    66,    66,    66,    66,
+      67,    67,    68,    68,    69,    69,    69,    69,    70,    70,
+      72,    71,    71,    71,    73,    74,    73,    75,    75,    75,
+      75,    75,    75,    76,    76,    77,    77,    78,    78,    79,
+      79,    79,    79,    79,    80,    81,    80,    80,    80,    82,
+      82,    83,    83,    83,    83,    83,    83,    84,    84,    84,
+      85,    85,    85,    85,    85,    86,    86,    86,    87,    87,
+      87,    87,    89,    88,    90,    88,    91,    91,    92,    92,
+      92,    92,    93,    93,    94,    94,    95,    95
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
-       0,     2,     1,     6,     4,     1,     1,     2,     1,     1,
-       1,     2,     3,     1,     2,     1,     1,     2,     2,     2,
-       4,     6,     3,     1,     1,     1,     1,     5,     7,     7,
-       5,     1,     1,     1,     1,     1,     3,     0,     4,     1,
-       1,     0,     4,     1,     1,     1,     1,     1,     1,     1,
-       5,     1,     2,     1,     3,     1,     1,     1,     1,     3,
-       1,     2,     2,     1,     2,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     1,     3,     3,     3,     3,     1,
-       3,     3,     1,     3,     3,     3,     3,     2,     4,     3,
-       1,     4,     4,     3,     1,     3,     2,     1,     1,     3
+       0,     2,     1,     2,     1,     1,     2,     5,     3,     1,
+       2,     1,     1,     1,     2,     3,     1,     2,     1,     1,
+       2,     2,     2,     4,     6,     3,     1,     1,     1,     1,
+       5,     7,     7,     5,     1,     1,     1,     1,     1,     3,
+       0,     4,     1,     4,     1,     0,     4,     1,     1,     1,
+       1,     1,     1,     1,     5,     1,     2,     1,     3,     1,
+       1,     1,     1,     3,     1,     0,     5,     2,     2,     1,
+       2,     1,     1,     1,     1,     1,     1,     1,     3,     3,
+       1,     3,     3,     3,     3,     1,     3,     3,     1,     3,
+       3,     3,     0,     4,     0,     3,     4,     3,     1,     4,
+       4,     3,     1,     3,     2,     1,     1,     3
 };
 
 
@@ -1045,6 +1060,32 @@ enum { YYENOMEM = -2 };
    Use YYerror or YYUNDEF. */
 #define YYERRCODE YYUNDEF
 
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1061,6 +1102,63 @@ do {                                            \
 } while (0)
 
 
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
 
 # define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
@@ -1069,7 +1167,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Kind, Value); \
+                  Kind, Value, Location); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -1081,10 +1179,11 @@ do {                                                                      \
 
 static void
 yy_symbol_value_print (FILE *yyo,
-                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
   FILE *yyoutput = yyo;
   YY_USE (yyoutput);
+  YY_USE (yylocationp);
   if (!yyvaluep)
     return;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
@@ -1099,12 +1198,14 @@ yy_symbol_value_print (FILE *yyo,
 
 static void
 yy_symbol_print (FILE *yyo,
-                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
   YYFPRINTF (yyo, "%s %s (",
              yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
   YYFPRINTF (yyo, ")");
 }
 
@@ -1137,7 +1238,7 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
                  int yyrule)
 {
   int yylno = yyrline[yyrule];
@@ -1151,7 +1252,8 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
                        YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
-                       &yyvsp[(yyi + 1) - (yynrhs)]);
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1159,7 +1261,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, Rule); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -1200,9 +1302,10 @@ int yydebug;
 
 static void
 yydestruct (const char *yymsg,
-            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
 {
   YY_USE (yyvaluep);
+  YY_USE (yylocationp);
   if (!yymsg)
     yymsg = "Deleting";
   YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
@@ -1218,6 +1321,12 @@ int yychar;
 
 /* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
+/* Location data for the lookahead symbol.  */
+YYLTYPE yylloc
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
 /* Number of syntax errors so far.  */
 int yynerrs;
 
@@ -1251,6 +1360,11 @@ yyparse (void)
     YYSTYPE *yyvs = yyvsa;
     YYSTYPE *yyvsp = yyvs;
 
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
   int yyn;
   /* The return value of yyparse.  */
   int yyresult;
@@ -1259,10 +1373,14 @@ yyparse (void)
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
 
 
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
@@ -1272,6 +1390,7 @@ yyparse (void)
 
   yychar = YYEMPTY; /* Cause a token to be read.  */
 
+  yylsp[0] = yylloc;
   goto yysetstate;
 
 
@@ -1310,6 +1429,7 @@ yysetstate:
            memory.  */
         yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
@@ -1318,9 +1438,11 @@ yysetstate:
         yyoverflow (YY_("memory exhausted"),
                     &yyss1, yysize * YYSIZEOF (*yyssp),
                     &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
         yyss = yyss1;
         yyvs = yyvs1;
+        yyls = yyls1;
       }
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
@@ -1339,6 +1461,7 @@ yysetstate:
           YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
 #  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
@@ -1347,6 +1470,7 @@ yysetstate:
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
 
       YY_IGNORE_USELESS_CAST_BEGIN
       YYDPRINTF ((stderr, "Stack size increased to %ld\n",
@@ -1400,6 +1524,7 @@ yybackup:
          loop in error recovery. */
       yychar = YYUNDEF;
       yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
       goto yyerrlab1;
     }
   else
@@ -1433,6 +1558,7 @@ yybackup:
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
 
   /* Discard the shifted token.  */
   yychar = YYEMPTY;
@@ -1466,38 +1592,66 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
   case 2: /* S: program  */
-#line 118 "ast.y"
+#line 98 "ast.y"
             {
+                trace_begin("sema");
+                sema_check(tree_top, pch_loaded_roots());
+                diag_flush();
+                trace_end();
+                trace_begin("cleansymbol");
+                perf_phase_begin(PERF_PHASE_CLEANSYMBOL);
+                alloc_set_phase(ALLOC_PHASE_CLEANSYMBOL);
                 cleansymbol();	
-                printsymtable();
+                alloc_set_phase(ALLOC_PHASE_PARSE);
+                perf_phase_end(PERF_PHASE_CLEANSYMBOL);
+                trace_end();
+                if(pch_out == NULL && !embedded){
+                    trace_begin("printsymtable");
+                    printsymtable();
+                    trace_end();
+                    trace_begin("symtab_write");
+                    if(symtab_out != NULL)
+                        symtab_write(symtab_out, first);
+                    if(xref_out != NULL)
+                        xref_write(xref_out, first);
+                    trace_end();
+                }
                 return 0;
             }
-#line 1481 "y.tab.c"
+#line 1629 "y.tab.c"
+    break;
+
+  case 8: /* include: HASH INCLUDE HEADER_LITERAL  */
+#line 137 "ast.y"
+                                                { include_header((yyvsp[0].string), (yylsp[0])); }
+#line 1635 "y.tab.c"
     break;
 
-  case 14: /* block_item_list: block_item_list block_item  */
-#line 153 "ast.y"
+  case 17: /* block_item_list: block_item_list block_item  */
+#line 162 "ast.y"
             {
-                create_node("stmt", 0);
+                create_node("stmt", 0, (yyloc));
             }
-#line 1489 "y.tab.c"
+#line 1643 "y.tab.c"
     break;
 
-  case 18: /* block_item: RETURN expression_statement  */
-#line 163 "ast.y"
+  case 21: /* block_item: RETURN expression_statement  */
+#line 172 "ast.y"
             {
-                create_node("return", 1);
+                create_node("return", 1, (yylsp[-1]));
             }
-#line 1497 "y.tab.c"
+#line 1651 "y.tab.c"
     break;
 
-  case 23: /* statement: compound_statement  */
-#line 179 "ast.y"
+  case 26: /* statement: compound_statement  */
+#line 188 "ast.y"
                          {
                         struct node *ftp;
                         ftp = first;
@@ -1509,106 +1663,114 @@ yyreduce:
                         }
                         scope--;
                     }
-#line 1513 "y.tab.c"
+#line 1667 "y.tab.c"
     break;
 
-  case 27: /* condition_statement: IF '(' relational_expression ')' statement  */
-#line 198 "ast.y"
+  case 30: /* condition_statement: IF '(' relational_expression ')' statement  */
+#line 207 "ast.y"
         {
             // AST: if (cond, then)
             Node *then_stmt = pop_tree();
             Node *cond = pop_tree();
-            Node *if_node = (Node*)malloc(sizeof(Node));
+            Node *if_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(if_node->token, "if");
             if_node->left = cond;
             if_node->right = then_stmt;
             if_node->val = NULL; // No else branch
+            if_node->body = NULL;
+            if_node->offset = (yylsp[-4]);
+            if_node->type = -1;
             push_tree(if_node);
         }
-#line 1529 "y.tab.c"
+#line 1686 "y.tab.c"
     break;
 
-  case 28: /* condition_statement: IF '(' relational_expression ')' statement ELSE statement  */
-#line 210 "ast.y"
+  case 31: /* condition_statement: IF '(' relational_expression ')' statement ELSE statement  */
+#line 222 "ast.y"
         {
             // AST: if (cond, then, else)
             Node *else_stmt = pop_tree();
             Node *then_stmt = pop_tree();
             Node *cond = pop_tree();
-            Node *if_node = (Node*)malloc(sizeof(Node));
+            Node *if_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(if_node->token, "if");
             if_node->left = cond;
             if_node->right = then_stmt;
             if_node->val = else_stmt; // Attach else as third child
+            if_node->body = NULL;
+            if_node->offset = (yylsp[-6]);
+            if_node->type = -1;
             push_tree(if_node);
         }
-#line 1546 "y.tab.c"
+#line 1706 "y.tab.c"
     break;
 
-  case 29: /* iteration_statement: FOR '(' expression_statement expression_statement expression ')' statement  */
-#line 228 "ast.y"
+  case 32: /* iteration_statement: FOR '(' expression_statement expression_statement expression ')' statement  */
+#line 243 "ast.y"
         {
             // Pop in reverse order: body, increment, condition, init
             Node *body = pop_tree();
             Node *incr = pop_tree();
             Node *cond = pop_tree();
             Node *init = pop_tree();
-            Node *for_node = (Node*)malloc(sizeof(Node));
+            Node *for_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(for_node->token, "for");
             for_node->left = init;
             for_node->right = cond;
             for_node->val = incr;
             for_node->body = body;
+            for_node->offset = (yylsp[-6]);
+            for_node->type = -1;
             push_tree(for_node);
         }
-#line 1565 "y.tab.c"
+#line 1727 "y.tab.c"
     break;
 
-  case 30: /* iteration_statement: WHILE '(' relational_expression ')' statement  */
-#line 243 "ast.y"
+  case 33: /* iteration_statement: WHILE '(' relational_expression ')' statement  */
+#line 260 "ast.y"
             {
-                create_node("while", 0); 
+                create_node("while", 0, (yylsp[-4])); 
             }
-#line 1573 "y.tab.c"
+#line 1735 "y.tab.c"
     break;
 
-  case 31: /* type_specifier: VOID  */
-#line 249 "ast.y"
+  case 34: /* type_specifier: VOID  */
+#line 266 "ast.y"
                 {	datatype = (yyvsp[0].ival); }
-#line 1579 "y.tab.c"
+#line 1741 "y.tab.c"
     break;
 
-  case 32: /* type_specifier: CHAR  */
-#line 250 "ast.y"
+  case 35: /* type_specifier: CHAR  */
+#line 267 "ast.y"
                 {	datatype = (yyvsp[0].ival); }
-#line 1585 "y.tab.c"
+#line 1747 "y.tab.c"
     break;
 
-  case 33: /* type_specifier: INT  */
-#line 251 "ast.y"
+  case 36: /* type_specifier: INT  */
+#line 268 "ast.y"
                 {	datatype = (yyvsp[0].ival); }
-#line 1591 "y.tab.c"
+#line 1753 "y.tab.c"
     break;
 
-  case 34: /* type_specifier: FLOAT  */
-#line 252 "ast.y"
+  case 37: /* type_specifier: FLOAT  */
+#line 269 "ast.y"
             {	datatype = (yyvsp[0].ival); }
-#line 1597 "y.tab.c"
+#line 1759 "y.tab.c"
     break;
 
-  case 37: /* $@1: %empty  */
-#line 261 "ast.y"
-                 { create_node((yyvsp[0].ptr)->name, 1); }
-#line 1603 "y.tab.c"
+  case 40: /* $@1: %empty  */
+#line 278 "ast.y"
+                 { create_node((yyvsp[0].ptr)->name, 1, (yylsp[0])); type_leaf(datatype); }
+#line 1765 "y.tab.c"
     break;
 
-  case 38: /* init_declarator: IDENTIFIER $@1 '=' assignment_expression  */
-#line 262 "ast.y"
+  case 41: /* init_declarator: IDENTIFIER $@1 '=' assignment_expression  */
+#line 279 "ast.y"
                     {	
                         if((yyvsp[-3].ptr)->dtype !=- 1 && (yyvsp[-3].ptr)->scope < scope && (yyvsp[-3].ptr)->valid == 1){
 																		
 							struct node *ftp, *nnode;
-							nnode = (struct node *)malloc(sizeof(struct node));
+							nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 							ftp = first;
 							while(ftp->link!=NULL){
 								ftp = ftp->link;
@@ -1617,111 +1779,64 @@ yyreduce:
 							ftp->link = nnode;
 							nnode->link = NULL;
 							(yyvsp[-3].ptr) = nnode;
+							(yyvsp[-3].ptr)->offset = (yylsp[-3]);
 
 							if (datatype == 0){	
 								
 								addInt((yyvsp[-3].ptr), 0, (yyvsp[0].fval));
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'int\' \n\n");
-								}
 							}
 							else if(datatype == 1){
 								
 								addFloat((yyvsp[-3].ptr), 1, (yyvsp[0].fval));
-								if(assigntype == 2){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'char\' to \'float\' \n\n");
-								}
 							}
 							else if(datatype == 2){
 								float tempf = (float)(yyvsp[0].fval);
 								addChar((yyvsp[-3].ptr), 2, (int)tempf);
-
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'char\' \n\n");
-								}
 							}
 							x = datatype;
 							
-							create_node("=", 0);
+							create_node("=", 0, (yylsp[-1]));
 
 						}
 
 						
 						else if((yyvsp[-3].ptr)->dtype !=- 1){
 
-								printf("Line:%d: ", line);
-								printf("\033[1;31m");
-								printf("error: ");
-								printf("\033[0m");
-								printf("redefinition of \'%s\' \n",  (yyvsp[-3].ptr)->name);
+								diag_report((yylsp[-3]), DIAG_ERROR, "redefinition of \'%s\' \n",  (yyvsp[-3].ptr)->name);
 						}
 						else{
 							
 							
-							create_node("=", 0);
+							create_node("=", 0, (yylsp[-1]));
 
 							if (datatype == 0){	
 								
 								addInt((yyvsp[-3].ptr), 0, (yyvsp[0].fval));
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'int\' \n\n");
-								}
 							}
 							else if(datatype == 1){
 								
 								addFloat((yyvsp[-3].ptr), 1, (yyvsp[0].fval));
-								if(assigntype == 2){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'char\' to \'float\' \n\n");
-								}
 							}
 							else if(datatype == 2){
 								float tempf = (float)(yyvsp[0].fval);
 								addChar((yyvsp[-3].ptr), 2, (int)tempf);
-
-								if(assigntype == 1){
-									printf("Line:%d: ", line);
-									printf("\033[1;35m"); 
-									printf("warning: ");
-									printf("\033[0m");
-									printf("implicit conversion from \'float\' to \'char\' \n\n");
-								}
 							}
 							x = datatype;
 							
 						}
 					}
-#line 1714 "y.tab.c"
+#line 1829 "y.tab.c"
     break;
 
-  case 39: /* init_declarator: IDENTIFIER  */
-#line 369 "ast.y"
+  case 42: /* init_declarator: IDENTIFIER  */
+#line 339 "ast.y"
                         {	//previous. a , dtype = 1(int)
 						// printf("type = %d\nscope = %d\nvalid = %d", $1->dtype, $1->scope, $1->valid);
 						if((yyvsp[0].ptr)->dtype !=- 1 && (yyvsp[0].ptr)->scope < scope && (yyvsp[0].ptr)->valid == 1){
 							// printf("case 1 \n" );
 																		
 							struct node *ftp, *nnode;
-							nnode = (struct node *)malloc(sizeof(struct node));
+							nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 							ftp = first;
 							while(ftp->link!=NULL){
 								ftp = ftp->link;
@@ -1730,6 +1845,7 @@ yyreduce:
 							ftp->link = nnode;
 							nnode->link = NULL;							
 							(yyvsp[0].ptr) = nnode;
+							(yyvsp[0].ptr)->offset = (yylsp[0]);
 							
 							if (datatype == 0){	
 								addInt((yyvsp[0].ptr), 0, INT_MIN);
@@ -1746,15 +1862,12 @@ yyreduce:
 							char buff[20];
 							strcpy(buff, "Dc ");
 							strcat(buff, (yyvsp[0].ptr)->name);
-							create_node(buff, 1);
+							create_node(buff, 1, (yylsp[0]));
+							type_leaf(datatype);
 
 						}
 						else if((yyvsp[0].ptr)->dtype !=- 1 ){
-							printf("Line:%d: ", line);
-							printf("\033[1;31m");
-							printf("error: ");
-							printf("\033[0m");
-							printf("redefinition of \'%s\' \n", (yyvsp[0].ptr)->name);
+							diag_report((yylsp[0]), DIAG_ERROR, "redefinition of \'%s\' \n", (yyvsp[0].ptr)->name);
 						
 						}else{
 							
@@ -1774,60 +1887,82 @@ yyreduce:
 							char buff[20];
 							strcpy(buff, "Dc ");
 							strcat(buff, (yyvsp[0].ptr)->name);
-							create_node(buff, 1);
+							create_node(buff, 1, (yylsp[0]));
+							type_leaf(datatype);
 						
 						}
 					}
-#line 1782 "y.tab.c"
+#line 1896 "y.tab.c"
+    break;
+
+  case 43: /* init_declarator: IDENTIFIER '[' INTEGER_LITERAL ']'  */
+#line 402 "ast.y"
+                                        {
+						if((yyvsp[-3].ptr)->dtype != -1 && !((yyvsp[-3].ptr)->scope < scope && (yyvsp[-3].ptr)->valid == 1)){
+							diag_report((yylsp[-3]), DIAG_ERROR, "redefinition of \'%s\' \n", (yyvsp[-3].ptr)->name);
+						}
+						else if((yyvsp[-1].ival) <= 0){
+							diag_report((yylsp[-1]), DIAG_ERROR, "array \'%s\' must have a positive size \n", (yyvsp[-3].ptr)->name);
+						}
+						else{
+							//shadows a symbol of an outer scope
+							if((yyvsp[-3].ptr)->dtype != -1){
+								struct node *ftp, *nnode;
+								nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
+								ftp = first;
+								while(ftp->link!=NULL){
+									ftp = ftp->link;
+								}
+								addsymbol(nnode,(yyvsp[-3].ptr)->name);
+								ftp->link = nnode;
+								nnode->link = NULL;
+								(yyvsp[-3].ptr) = nnode;
+								(yyvsp[-3].ptr)->offset = (yylsp[-3]);
+							}
+							addArray((yyvsp[-3].ptr), datatype, (yyvsp[-1].ival));
+							x = datatype;
+
+							//"Dc a[100]", so the dump carries the size
+							char buff[48];
+							snprintf(buff, sizeof(buff), "Dc %s[%d]", (yyvsp[-3].ptr)->name, (yyvsp[-1].ival));
+							create_node(buff, 1, (yylsp[-3]));
+							type_leaf(datatype);
+						}
+					}
+#line 1933 "y.tab.c"
     break;
 
-  case 40: /* assignment_expression: conditional_expression  */
-#line 436 "ast.y"
+  case 44: /* assignment_expression: conditional_expression  */
+#line 438 "ast.y"
                                 {	(yyval.fval) = (yyvsp[0].fval); }
-#line 1788 "y.tab.c"
+#line 1939 "y.tab.c"
     break;
 
-  case 41: /* $@2: %empty  */
-#line 437 "ast.y"
+  case 45: /* $@2: %empty  */
+#line 439 "ast.y"
                         { crt = lhs; }
-#line 1794 "y.tab.c"
+#line 1945 "y.tab.c"
     break;
 
-  case 42: /* assignment_expression: unary_expression $@2 assignment_operator assignment_expression  */
-#line 438 "ast.y"
-            {							
-				switch(assignop){
+  case 46: /* assignment_expression: unary_expression $@2 assignment_operator assignment_expression  */
+#line 440 "ast.y"
+            {
+				//an element's value is not tracked: only its node is made
+				if(idcheck == 1 && crt != NULL && strcmp(crt->token, "array") == 0){
+					create_node((char*)assign_tokens[assignop], 0, (yylsp[-1]));
+					crt = NULL;
+				}
+				else switch(assignop){
 					case 0: if(idcheck == 1){
-								create_node("=", 0);
+								create_node("=", 0, (yylsp[-1]));
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)(yyvsp[0].fval);
 									
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = (yyvsp[0].fval);
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)(yyvsp[0].fval));
 								}
 							}
@@ -1838,35 +1973,14 @@ yyreduce:
 							break;
 
 					case 1: if(idcheck == 1){
-								create_node("+=", 0);
+								create_node("+=", 0, (yylsp[-1]));
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)(yyvsp[-3].fval) + (int)(yyvsp[0].fval);
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = (yyvsp[-3].fval)+ (yyvsp[0].fval);
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)(yyvsp[-3].fval) + (int)(yyvsp[0].fval));
 								}
 							}
@@ -1877,35 +1991,14 @@ yyreduce:
 							break;
 
 					case 2:	if(idcheck == 1){
-							create_node("-=", 0);
+							create_node("-=", 0, (yylsp[-1]));
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)(yyvsp[-3].fval) - (int)(yyvsp[0].fval);
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = (yyvsp[-3].fval) - (yyvsp[0].fval);
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)(yyvsp[-3].fval) - (int)(yyvsp[0].fval));
 								}
 							}
@@ -1916,35 +2009,14 @@ yyreduce:
 							break;
 
 					case 3:	if(idcheck == 1){
-								create_node("*=", 0);
+								create_node("*=", 0, (yylsp[-1]));
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)(yyvsp[-3].fval) * (int)(yyvsp[0].fval);
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = (yyvsp[-3].fval) * (yyvsp[0].fval);
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)(yyvsp[-3].fval) * (int)(yyvsp[0].fval));
 								}
 							}
@@ -1955,35 +2027,14 @@ yyreduce:
 							break;
 
 					case 4:	if(idcheck == 1){
-								create_node("/=", 0);
+								create_node("/=", 0, (yylsp[-1]));
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)(yyvsp[-3].fval) / (int)(yyvsp[0].fval);
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = (yyvsp[-3].fval) / (yyvsp[0].fval);
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)(yyvsp[-3].fval) / (int)(yyvsp[0].fval));
 								}
 							}
@@ -1994,35 +2045,14 @@ yyreduce:
 							break;
 
 					case 5:	if(idcheck == 1){
-								create_node("%=", 0);
+								create_node("%=", 0, (yylsp[-1]));
 								if(crt->dtype == 0){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'int\' \n\n");
-									}
 									crt->val.i = (int)(yyvsp[-3].fval) % (int)(yyvsp[0].fval);
 								}
 								else if(crt->dtype == 1){
-									if(assigntype == 2){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'char\' to \'float\' \n\n");
-									}
 									crt->val.f = (int)(yyvsp[-3].fval) % (int)(yyvsp[0].fval);
 								}
 								else if(crt->dtype == 2){
-									if(assigntype == 1){
-										printf("Line:%d: ", line);
-										printf("\033[1;35m"); 
-										printf("warning: ");
-										printf("\033[0m");
-										printf("implicit conversion from \'float\' to \'char\' \n\n");
-									}
 									crt->val.c = (char)((int)(yyvsp[-3].fval) % (int)(yyvsp[0].fval));
 								}
 							}
@@ -2037,63 +2067,66 @@ yyreduce:
 				assignop = -1;
 				assigntype = -1;
 			}
-#line 2041 "y.tab.c"
+#line 2071 "y.tab.c"
     break;
 
-  case 43: /* assignment_operator: '='  */
-#line 686 "ast.y"
+  case 47: /* assignment_operator: '='  */
+#line 567 "ast.y"
                                 {	assignop = 0;	}
-#line 2047 "y.tab.c"
+#line 2077 "y.tab.c"
     break;
 
-  case 44: /* assignment_operator: ADD_ASSIGN  */
-#line 687 "ast.y"
+  case 48: /* assignment_operator: ADD_ASSIGN  */
+#line 568 "ast.y"
                         {	assignop = 1;	}
-#line 2053 "y.tab.c"
+#line 2083 "y.tab.c"
     break;
 
-  case 45: /* assignment_operator: SUB_ASSIGN  */
-#line 688 "ast.y"
+  case 49: /* assignment_operator: SUB_ASSIGN  */
+#line 569 "ast.y"
                         {	assignop = 2;	}
-#line 2059 "y.tab.c"
+#line 2089 "y.tab.c"
     break;
 
-  case 46: /* assignment_operator: MUL_ASSIGN  */
-#line 689 "ast.y"
+  case 50: /* assignment_operator: MUL_ASSIGN  */
+#line 570 "ast.y"
                         {	assignop = 3;	}
-#line 2065 "y.tab.c"
+#line 2095 "y.tab.c"
     break;
 
-  case 47: /* assignment_operator: DIV_ASSIGN  */
-#line 690 "ast.y"
+  case 51: /* assignment_operator: DIV_ASSIGN  */
+#line 571 "ast.y"
                         {	assignop = 4;	}
-#line 2071 "y.tab.c"
+#line 2101 "y.tab.c"
     break;
 
-  case 48: /* assignment_operator: MOD_ASSIGN  */
-#line 691 "ast.y"
+  case 52: /* assignment_operator: MOD_ASSIGN  */
+#line 572 "ast.y"
                         {	assignop = 5;	}
-#line 2077 "y.tab.c"
+#line 2107 "y.tab.c"
     break;
 
-  case 49: /* conditional_expression: equality_expression  */
-#line 696 "ast.y"
+  case 53: /* conditional_expression: equality_expression  */
+#line 577 "ast.y"
                                 {	(yyval.fval) = (yyvsp[0].fval);	}
-#line 2083 "y.tab.c"
+#line 2113 "y.tab.c"
     break;
 
-  case 50: /* conditional_expression: equality_expression '?' expression ':' conditional_expression  */
-#line 698 "ast.y"
+  case 54: /* conditional_expression: equality_expression '?' expression ':' conditional_expression  */
+#line 579 "ast.y"
         {
             // AST: if (cond, then, else)
             Node *else_expr = pop_tree();
             Node *then_expr = pop_tree();
             Node *cond = pop_tree();
-            Node *if_node = (Node*)malloc(sizeof(Node));
+            Node *if_node = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
             strcpy(if_node->token, "if");
             if_node->left = cond;
             if_node->right = then_expr;
             if_node->val = else_expr;
+            if_node->body = NULL;
+            if_node->offset = (yylsp[-3]);
+            if_node->type = -1;
             push_tree(if_node);
 
             if((yyvsp[-4].fval) == 1){
@@ -2102,46 +2135,42 @@ yyreduce:
                 (yyval.fval) = (yyvsp[0].fval);
             }
         }
-#line 2106 "y.tab.c"
+#line 2139 "y.tab.c"
     break;
 
-  case 51: /* expression_statement: ';'  */
-#line 720 "ast.y"
+  case 55: /* expression_statement: ';'  */
+#line 604 "ast.y"
                                         {				}
-#line 2112 "y.tab.c"
+#line 2145 "y.tab.c"
     break;
 
-  case 52: /* expression_statement: expression ';'  */
-#line 721 "ast.y"
+  case 56: /* expression_statement: expression ';'  */
+#line 605 "ast.y"
                         {				}
-#line 2118 "y.tab.c"
+#line 2151 "y.tab.c"
     break;
 
-  case 53: /* expression: assignment_expression  */
-#line 725 "ast.y"
+  case 57: /* expression: assignment_expression  */
+#line 609 "ast.y"
                                         {		}
-#line 2124 "y.tab.c"
+#line 2157 "y.tab.c"
     break;
 
-  case 54: /* expression: expression ',' assignment_expression  */
-#line 726 "ast.y"
+  case 58: /* expression: expression ',' assignment_expression  */
+#line 610 "ast.y"
                                            {		}
-#line 2130 "y.tab.c"
+#line 2163 "y.tab.c"
     break;
 
-  case 55: /* primary_expression: IDENTIFIER  */
-#line 731 "ast.y"
+  case 59: /* primary_expression: IDENTIFIER  */
+#line 615 "ast.y"
                 {					
                     idcheck = 1;
                     lhs = (yyvsp[0].ptr);
 
                     if((yyvsp[0].ptr)->dtype == -1 && check_un == 0){
 
-						printf("Line:%d: ", line);
-						printf("\033[1;31m");
-						printf("error: ");
-						printf("\033[0m");
-						printf("use of undeclared identifier \'%s\' \n\n", (yyvsp[0].ptr)->name);
+						diag_report((yylsp[0]), DIAG_ERROR, "use of undeclared identifier \'%s\' \n\n", (yyvsp[0].ptr)->name);
 
 						check_un = 0;		// set check_un = -1
 
@@ -2149,284 +2178,310 @@ yyreduce:
 					else if((yyvsp[0].ptr)->dtype == 0){
 						(yyval.fval) = (yyvsp[0].ptr)->val.i;
 						assigntype = 0;
-						create_node((yyvsp[0].ptr)->name, 1);
+						create_node((yyvsp[0].ptr)->name, 1, (yylsp[0]));
+						type_leaf((yyvsp[0].ptr)->dtype);
+						xref_add((yyvsp[0].ptr), (yylsp[0]));
 					}
 					else if((yyvsp[0].ptr)->dtype == 1){
 						(yyval.fval) = (yyvsp[0].ptr)->val.f;
 						assigntype = 1;
-						create_node((yyvsp[0].ptr)->name, 1);
+						create_node((yyvsp[0].ptr)->name, 1, (yylsp[0]));
+						type_leaf((yyvsp[0].ptr)->dtype);
+						xref_add((yyvsp[0].ptr), (yylsp[0]));
 					}
 					else if((yyvsp[0].ptr)->dtype == 2){
 						(yyval.fval) = (yyvsp[0].ptr)->val.c;
 						assigntype = 2;
-						create_node((yyvsp[0].ptr)->name, 1);
+						create_node((yyvsp[0].ptr)->name, 1, (yylsp[0]));
+						type_leaf((yyvsp[0].ptr)->dtype);
+						xref_add((yyvsp[0].ptr), (yylsp[0]));
 					}
 						
 									
 				}
-#line 2168 "y.tab.c"
+#line 2203 "y.tab.c"
     break;
 
-  case 56: /* primary_expression: INTEGER_LITERAL  */
-#line 765 "ast.y"
+  case 60: /* primary_expression: INTEGER_LITERAL  */
+#line 651 "ast.y"
                                 {
 					(yyval.fval) = (yyvsp[0].ival);
 					assigntype = 0;
 				
 					sprintf(tempStr, "%d", (int)(yyvsp[0].ival));
-					create_node(tempStr, 1);
+					create_node(tempStr, 1, (yylsp[0]));
+					type_leaf(0);
 				}
-#line 2180 "y.tab.c"
+#line 2216 "y.tab.c"
     break;
 
-  case 57: /* primary_expression: FLOAT_LITERAL  */
-#line 774 "ast.y"
+  case 61: /* primary_expression: FLOAT_LITERAL  */
+#line 661 "ast.y"
                                 {	
 					assigntype = 1;
 					sprintf(tempStr, "%f", (yyvsp[0].fval));
-					create_node(tempStr, 1);
+					create_node(tempStr, 1, (yylsp[0]));
+					type_leaf(1);
 				}
-#line 2190 "y.tab.c"
+#line 2227 "y.tab.c"
     break;
 
-  case 58: /* primary_expression: CHARACTER_LITERAL  */
-#line 780 "ast.y"
+  case 62: /* primary_expression: CHARACTER_LITERAL  */
+#line 668 "ast.y"
                                 {	
+					(yyval.fval) = (yyvsp[0].cval);
 					assigntype = 2;
-					sprintf(tempStr, "%c", (yyvsp[0].cval));
-					create_node(tempStr, 1);
+					//its code, so the dump cannot mistake it for an identifier
+					sprintf(tempStr, "%d", (int)(yyvsp[0].cval));
+					create_node(tempStr, 1, (yylsp[0]));
+					type_leaf(2);
 				}
-#line 2200 "y.tab.c"
+#line 2240 "y.tab.c"
     break;
 
-  case 59: /* primary_expression: '(' expression ')'  */
-#line 786 "ast.y"
+  case 63: /* primary_expression: '(' expression ')'  */
+#line 677 "ast.y"
                                 {
 					(yyval.fval) = (yyvsp[-1].fval);
 				}
-#line 2208 "y.tab.c"
+#line 2248 "y.tab.c"
     break;
 
-  case 60: /* postfix_expression: primary_expression  */
-#line 792 "ast.y"
+  case 64: /* postfix_expression: primary_expression  */
+#line 683 "ast.y"
                                         {	(yyval.fval) = (yyvsp[0].fval);	}
-#line 2214 "y.tab.c"
+#line 2254 "y.tab.c"
+    break;
+
+  case 65: /* @3: %empty  */
+#line 684 "ast.y"
+                                 { (yyval.ptr) = lhs; }
+#line 2260 "y.tab.c"
+    break;
+
+  case 66: /* postfix_expression: postfix_expression '[' @3 expression ']'  */
+#line 685 "ast.y"
+                                {
+					//the index's identifiers set lhs; an assignment is to the array
+					lhs = (yyvsp[-2].ptr);
+					(yyval.fval) = 0;
+					create_node("[]", 0, (yylsp[-3]));
+				}
+#line 2271 "y.tab.c"
     break;
 
-  case 61: /* postfix_expression: postfix_expression INC_OP  */
-#line 793 "ast.y"
-                                        {	(yyvsp[-1].fval)++; (yyval.fval) = (yyvsp[-1].fval);	create_node("++", 0); }
-#line 2220 "y.tab.c"
+  case 67: /* postfix_expression: postfix_expression INC_OP  */
+#line 691 "ast.y"
+                                        {	(yyvsp[-1].fval)++; (yyval.fval) = (yyvsp[-1].fval);	create_node("++", 0, (yylsp[0])); }
+#line 2277 "y.tab.c"
     break;
 
-  case 62: /* postfix_expression: postfix_expression DEC_OP  */
-#line 794 "ast.y"
-                                    {	(yyvsp[-1].fval)--; (yyval.fval) = (yyvsp[-1].fval);	create_node("--", 0); }
-#line 2226 "y.tab.c"
+  case 68: /* postfix_expression: postfix_expression DEC_OP  */
+#line 692 "ast.y"
+                                    {	(yyvsp[-1].fval)--; (yyval.fval) = (yyvsp[-1].fval);	create_node("--", 0, (yylsp[0])); }
+#line 2283 "y.tab.c"
     break;
 
-  case 63: /* unary_expression: postfix_expression  */
-#line 798 "ast.y"
+  case 69: /* unary_expression: postfix_expression  */
+#line 696 "ast.y"
                                 {	(yyval.fval) = (yyvsp[0].fval);	}
-#line 2232 "y.tab.c"
+#line 2289 "y.tab.c"
     break;
 
-  case 64: /* unary_expression: unary_operator unary_expression  */
-#line 800 "ast.y"
+  case 70: /* unary_expression: unary_operator unary_expression  */
+#line 698 "ast.y"
                                 {
 					switch(unaryop){
-						case 1:	(yyval.fval) = (yyvsp[0].fval); create_node("'+'", 0); break;
-						case 2:	(yyval.fval) = -(yyvsp[0].fval); create_node("'-'", 0); break;
-						case 3:	(yyval.fval) = !(yyvsp[0].fval); create_node("!", 0); break;
-						case 4:	(yyval.fval) = ~((int)(yyvsp[0].fval)); create_node("~", 0); break;	
-						case 5:	(yyval.fval) = ++(yyvsp[0].fval); create_node("++", 0); break;
-						case 6:	(yyval.fval) = --(yyvsp[0].fval); create_node("--", 0); break;		
+						case 1:	(yyval.fval) = (yyvsp[0].fval); create_node("'+'", 0, (yylsp[-1])); break;
+						case 2:	(yyval.fval) = -(yyvsp[0].fval); create_node("'-'", 0, (yylsp[-1])); break;
+						case 3:	(yyval.fval) = !(yyvsp[0].fval); create_node("!", 0, (yylsp[-1])); break;
+						case 4:	(yyval.fval) = ~((int)(yyvsp[0].fval)); create_node("~", 0, (yylsp[-1])); break;	
+						case 5:	(yyval.fval) = ++(yyvsp[0].fval); create_node("++", 0, (yylsp[-1])); break;
+						case 6:	(yyval.fval) = --(yyvsp[0].fval); create_node("--", 0, (yylsp[-1])); break;		
 					}
 					unaryop = -1;
 				}
-#line 2248 "y.tab.c"
+#line 2305 "y.tab.c"
     break;
 
-  case 65: /* unary_operator: '+'  */
-#line 815 "ast.y"
+  case 71: /* unary_operator: '+'  */
+#line 713 "ast.y"
                         {	unaryop = 1;	}
-#line 2254 "y.tab.c"
+#line 2311 "y.tab.c"
     break;
 
-  case 66: /* unary_operator: '-'  */
-#line 816 "ast.y"
+  case 72: /* unary_operator: '-'  */
+#line 714 "ast.y"
                         {	unaryop = 2;	}
-#line 2260 "y.tab.c"
+#line 2317 "y.tab.c"
     break;
 
-  case 67: /* unary_operator: '!'  */
-#line 817 "ast.y"
+  case 73: /* unary_operator: '!'  */
+#line 715 "ast.y"
                         {	unaryop = 3;	}
-#line 2266 "y.tab.c"
+#line 2323 "y.tab.c"
     break;
 
-  case 68: /* unary_operator: '~'  */
-#line 818 "ast.y"
+  case 74: /* unary_operator: '~'  */
+#line 716 "ast.y"
                         {	unaryop = 4;	}
-#line 2272 "y.tab.c"
+#line 2329 "y.tab.c"
     break;
 
-  case 69: /* unary_operator: INC_OP  */
-#line 819 "ast.y"
+  case 75: /* unary_operator: INC_OP  */
+#line 717 "ast.y"
                 {	unaryop = 5;	}
-#line 2278 "y.tab.c"
+#line 2335 "y.tab.c"
     break;
 
-  case 70: /* unary_operator: DEC_OP  */
-#line 820 "ast.y"
+  case 76: /* unary_operator: DEC_OP  */
+#line 718 "ast.y"
                 {	unaryop = 6;	}
-#line 2284 "y.tab.c"
+#line 2341 "y.tab.c"
     break;
 
-  case 71: /* equality_expression: relational_expression  */
-#line 824 "ast.y"
+  case 77: /* equality_expression: relational_expression  */
+#line 722 "ast.y"
                             {	(yyval.fval) = (yyvsp[0].fval);	}
-#line 2290 "y.tab.c"
+#line 2347 "y.tab.c"
     break;
 
-  case 72: /* equality_expression: equality_expression EQ_OP relational_expression  */
-#line 826 "ast.y"
+  case 78: /* equality_expression: equality_expression EQ_OP relational_expression  */
+#line 724 "ast.y"
                 { 
-                    create_node("==", 0);
+                    create_node("==", 0, (yylsp[-1]));
                     (yyval.fval) = ((yyvsp[-2].fval) == (yyvsp[0].fval)) ? 1 : 0;
                 }
-#line 2299 "y.tab.c"
+#line 2356 "y.tab.c"
     break;
 
-  case 73: /* equality_expression: equality_expression NE_OP relational_expression  */
-#line 831 "ast.y"
+  case 79: /* equality_expression: equality_expression NE_OP relational_expression  */
+#line 729 "ast.y"
                 { 
-                    create_node("!=", 0);
+                    create_node("!=", 0, (yylsp[-1]));
                     (yyval.fval) = ((yyvsp[-2].fval) != (yyvsp[0].fval)) ? 1 : 0;
                 }
-#line 2308 "y.tab.c"
+#line 2365 "y.tab.c"
     break;
 
-  case 74: /* relational_expression: additive_expression  */
-#line 838 "ast.y"
+  case 80: /* relational_expression: additive_expression  */
+#line 736 "ast.y"
                                 {	(yyval.fval) = (yyvsp[0].fval);	}
-#line 2314 "y.tab.c"
+#line 2371 "y.tab.c"
     break;
 
-  case 75: /* relational_expression: relational_expression '<' additive_expression  */
-#line 840 "ast.y"
+  case 81: /* relational_expression: relational_expression '<' additive_expression  */
+#line 738 "ast.y"
                 { 
-                    create_node("<", 0);
+                    create_node("<", 0, (yylsp[-1]));
                     (yyval.fval) = ((yyvsp[-2].fval) < (yyvsp[0].fval)) ? 1 : 0;
                 }
-#line 2323 "y.tab.c"
+#line 2380 "y.tab.c"
     break;
 
-  case 76: /* relational_expression: relational_expression '>' additive_expression  */
-#line 845 "ast.y"
+  case 82: /* relational_expression: relational_expression '>' additive_expression  */
+#line 743 "ast.y"
                 { 
-                    create_node(">", 0);
+                    create_node(">", 0, (yylsp[-1]));
                     (yyval.fval) = ((yyvsp[-2].fval) > (yyvsp[0].fval)) ? 1 : 0;
                 }
-#line 2332 "y.tab.c"
+#line 2389 "y.tab.c"
     break;
 
-  case 77: /* relational_expression: relational_expression LE_OP additive_expression  */
-#line 850 "ast.y"
+  case 83: /* relational_expression: relational_expression LE_OP additive_expression  */
+#line 748 "ast.y"
                 { 
-                    create_node("<=", 0);
+                    create_node("<=", 0, (yylsp[-1]));
                     (yyval.fval) = ((yyvsp[-2].fval) <= (yyvsp[0].fval)) ? 1 : 0;
                 }
-#line 2341 "y.tab.c"
+#line 2398 "y.tab.c"
     break;
 
-  case 78: /* relational_expression: relational_expression GE_OP additive_expression  */
-#line 855 "ast.y"
+  case 84: /* relational_expression: relational_expression GE_OP additive_expression  */
+#line 753 "ast.y"
                 { 
-                    create_node(">=", 0);
+                    create_node(">=", 0, (yylsp[-1]));
                     (yyval.fval) = ((yyvsp[-2].fval) >= (yyvsp[0].fval)) ? 1 : 0;
                 }
-#line 2350 "y.tab.c"
+#line 2407 "y.tab.c"
     break;
 
-  case 79: /* additive_expression: multiplicative_expression  */
-#line 862 "ast.y"
+  case 85: /* additive_expression: multiplicative_expression  */
+#line 760 "ast.y"
                                 {	(yyval.fval) = (yyvsp[0].fval);	}
-#line 2356 "y.tab.c"
+#line 2413 "y.tab.c"
     break;
 
-  case 80: /* additive_expression: additive_expression '+' multiplicative_expression  */
-#line 864 "ast.y"
+  case 86: /* additive_expression: additive_expression '+' multiplicative_expression  */
+#line 762 "ast.y"
             {	
-                create_node("+", 0);
+                create_node("+", 0, (yylsp[-1]));
                 (yyval.fval) = (yyvsp[-2].fval) + (yyvsp[0].fval);	
             }
-#line 2365 "y.tab.c"
+#line 2422 "y.tab.c"
     break;
 
-  case 81: /* additive_expression: additive_expression '-' multiplicative_expression  */
-#line 869 "ast.y"
+  case 87: /* additive_expression: additive_expression '-' multiplicative_expression  */
+#line 767 "ast.y"
             {	
-                create_node("-", 0);
+                create_node("-", 0, (yylsp[-1]));
                 (yyval.fval) = (yyvsp[-2].fval) - (yyvsp[0].fval);	
             }
-#line 2374 "y.tab.c"
+#line 2431 "y.tab.c"
     break;
 
-  case 82: /* multiplicative_expression: unary_expression  */
-#line 876 "ast.y"
+  case 88: /* multiplicative_expression: unary_expression  */
+#line 774 "ast.y"
                                         {	(yyval.fval) = (yyvsp[0].fval);	}
-#line 2380 "y.tab.c"
+#line 2437 "y.tab.c"
     break;
 
-  case 83: /* multiplicative_expression: multiplicative_expression '*' unary_expression  */
-#line 878 "ast.y"
+  case 89: /* multiplicative_expression: multiplicative_expression '*' unary_expression  */
+#line 776 "ast.y"
                     {	
-                        create_node("*", 0);	
+                        create_node("*", 0, (yylsp[-1]));	
                         (yyval.fval) = (yyvsp[-2].fval) * (yyvsp[0].fval);	
                     }
-#line 2389 "y.tab.c"
+#line 2446 "y.tab.c"
     break;
 
-  case 84: /* multiplicative_expression: multiplicative_expression '/' unary_expression  */
-#line 883 "ast.y"
+  case 90: /* multiplicative_expression: multiplicative_expression '/' unary_expression  */
+#line 781 "ast.y"
                     {	
                         if((yyvsp[0].fval) == 0){
-                            printf("Line:%d: ", line);
-                            printf("\033[1;35m"); 
-                            printf("warning: ");
-                            printf("\033[0m");
-                            printf("division by zero is undefined\n\n");
+                            diag_report((yylsp[0]), DIAG_WARNING, "division by zero is undefined\n\n");
                             (yyval.fval) = INT_MAX;		//junk value in real
                         }else{
                             (yyval.fval) = (yyvsp[-2].fval) / (yyvsp[0].fval);	
-                            create_node("/", 0);
+                            create_node("/", 0, (yylsp[-1]));
                         }
                     }
-#line 2407 "y.tab.c"
+#line 2460 "y.tab.c"
     break;
 
-  case 85: /* multiplicative_expression: multiplicative_expression '%' unary_expression  */
-#line 897 "ast.y"
+  case 91: /* multiplicative_expression: multiplicative_expression '%' unary_expression  */
+#line 791 "ast.y"
                     {	
                         if(assigntype == 1){
-                            printf("Line:%d: ", line);
-                            printf("\033[1;31m");
-                            printf("error: ");
-                            printf("\033[0m");
-                            printf("invalid operands to binary expression (\'float\' and \'float\') \n\n");
+                            diag_report((yylsp[-1]), DIAG_ERROR, "invalid operands to binary expression (\'float\' and \'float\') \n\n");
                         }else{								
                             (yyval.fval) = (int)(yyvsp[-2].fval) % (int)(yyvsp[0].fval);	
-                            create_node("%", 0);
+                            create_node("%", 0, (yylsp[-1]));
                         }
                     }
-#line 2424 "y.tab.c"
+#line 2473 "y.tab.c"
     break;
 
-  case 86: /* function_definition: type_specifier declarator compound_statement  */
-#line 913 "ast.y"
+  case 92: /* $@4: %empty  */
+#line 802 "ast.y"
+                                { trace_begin((yyvsp[0].string)); }
+#line 2479 "y.tab.c"
+    break;
+
+  case 93: /* function_definition: type_specifier declarator $@4 compound_statement  */
+#line 803 "ast.y"
                 {
-                    create_node((yyvsp[-1].string), 3);
+                    create_node((yyvsp[-2].string), 3, (yylsp[-2]));
                     struct node *ftp;
                     ftp = first;
                     while(ftp!=NULL){
@@ -2439,19 +2494,22 @@ yyreduce:
                         ftp=ftp->link;
                     }
                     scope--;
+                    trace_end();
                 }
-#line 2444 "y.tab.c"
+#line 2500 "y.tab.c"
     break;
 
-  case 87: /* function_definition: declarator compound_statement  */
-#line 929 "ast.y"
+  case 94: /* $@5: %empty  */
+#line 819 "ast.y"
+                 { trace_begin((yyvsp[0].string)); }
+#line 2506 "y.tab.c"
+    break;
+
+  case 95: /* function_definition: declarator $@5 compound_statement  */
+#line 820 "ast.y"
                 {	
-                    create_node((yyvsp[-1].string), 3);
-                    printf("Line:%d: ", line);
-                    printf("\033[1;35m"); 
-                    printf("warning: ");
-                    printf("\033[0m");
-                    printf("type specifier missing, defaults to \'int\' \n");
+                    create_node((yyvsp[-2].string), 3, (yylsp[-2]));
+                    diag_report((yylsp[-2]), DIAG_WARNING, "type specifier missing, defaults to \'int\' \n");
 
                     struct node *ftp;
                     ftp = first;
@@ -2465,75 +2523,76 @@ yyreduce:
                         ftp=ftp->link;
                     }
                     scope--;
+                    trace_end();
                 }
-#line 2470 "y.tab.c"
+#line 2529 "y.tab.c"
     break;
 
-  case 90: /* declarator: IDENTIFIER  */
-#line 960 "ast.y"
+  case 98: /* declarator: IDENTIFIER  */
+#line 848 "ast.y"
                 {	
                     addfunc((yyvsp[0].ptr), datatype, "function");	
                     strcpy((yyval.string), (yyvsp[0].ptr)->name); 								
                 }
-#line 2479 "y.tab.c"
+#line 2538 "y.tab.c"
     break;
 
-  case 91: /* declarator: declarator '(' parameter_list ')'  */
-#line 964 "ast.y"
+  case 99: /* declarator: declarator '(' parameter_list ')'  */
+#line 852 "ast.y"
                                                 { }
-#line 2485 "y.tab.c"
+#line 2544 "y.tab.c"
     break;
 
-  case 92: /* declarator: declarator '(' identifier_list ')'  */
-#line 965 "ast.y"
+  case 100: /* declarator: declarator '(' identifier_list ')'  */
+#line 853 "ast.y"
                                                 { }
-#line 2491 "y.tab.c"
+#line 2550 "y.tab.c"
     break;
 
-  case 93: /* declarator: declarator '(' ')'  */
-#line 966 "ast.y"
+  case 101: /* declarator: declarator '(' ')'  */
+#line 854 "ast.y"
                                                                 { }
-#line 2497 "y.tab.c"
+#line 2556 "y.tab.c"
     break;
 
-  case 94: /* parameter_list: parameter_declaration  */
-#line 970 "ast.y"
+  case 102: /* parameter_list: parameter_declaration  */
+#line 858 "ast.y"
                                                                         {}
-#line 2503 "y.tab.c"
+#line 2562 "y.tab.c"
     break;
 
-  case 95: /* parameter_list: parameter_list ',' parameter_declaration  */
-#line 971 "ast.y"
+  case 103: /* parameter_list: parameter_list ',' parameter_declaration  */
+#line 859 "ast.y"
                                                 {}
-#line 2509 "y.tab.c"
+#line 2568 "y.tab.c"
     break;
 
-  case 96: /* parameter_declaration: type_specifier IDENTIFIER  */
-#line 975 "ast.y"
+  case 104: /* parameter_declaration: type_specifier IDENTIFIER  */
+#line 863 "ast.y"
                                         {	addfunc((yyvsp[0].ptr), datatype, "param");	}
-#line 2515 "y.tab.c"
+#line 2574 "y.tab.c"
     break;
 
-  case 97: /* parameter_declaration: type_specifier  */
-#line 976 "ast.y"
+  case 105: /* parameter_declaration: type_specifier  */
+#line 864 "ast.y"
                                                 {}
-#line 2521 "y.tab.c"
+#line 2580 "y.tab.c"
     break;
 
-  case 98: /* identifier_list: IDENTIFIER  */
-#line 980 "ast.y"
+  case 106: /* identifier_list: IDENTIFIER  */
+#line 868 "ast.y"
                                                                 {		}
-#line 2527 "y.tab.c"
+#line 2586 "y.tab.c"
     break;
 
-  case 99: /* identifier_list: identifier_list ',' IDENTIFIER  */
-#line 981 "ast.y"
+  case 107: /* identifier_list: identifier_list ',' IDENTIFIER  */
+#line 869 "ast.y"
                                         {		}
-#line 2533 "y.tab.c"
+#line 2592 "y.tab.c"
     break;
 
 
-#line 2537 "y.tab.c"
+#line 2596 "y.tab.c"
 
       default: break;
     }
@@ -2554,6 +2613,7 @@ yyreduce:
   yylen = 0;
 
   *++yyvsp = yyval;
+  *++yylsp = yyloc;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
@@ -2583,6 +2643,7 @@ yyerrlab:
       yyerror (YY_("syntax error"));
     }
 
+  yyerror_range[1] = yylloc;
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2597,7 +2658,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval);
+                      yytoken, &yylval, &yylloc);
           yychar = YYEMPTY;
         }
     }
@@ -2651,9 +2712,9 @@ yyerrlab1:
       if (yyssp == yyss)
         YYABORT;
 
-
+      yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2663,6 +2724,9 @@ yyerrlab1:
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
   YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
@@ -2706,7 +2770,7 @@ yyreturnlab:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
+                  yytoken, &yylval, &yylloc);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -2715,7 +2779,7 @@ yyreturnlab:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -2726,32 +2790,94 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 984 "ast.y"
+#line 872 "ast.y"
 
 
 
 void yyerror(const char *str){
-	fflush(stdout);
-	printf("Line:%d: ", line);
-	printf("\033[1;31m");
-	printf("error: ");
-	printf("\033[0m");
-	printf("%s\n", str);
+	diag_report(yylloc, DIAG_ERROR, "%s\n", str);
 }
 
 
-int main(){
-	yyout = fopen("output.c", "w");
+#ifndef FRONTEND_NO_MAIN
+int main(int argc, char *argv[]){
+	int counters = 0;
+
+	//headers missing from the cache are parsed by this program itself
+	pch_set_builder("/proc/self/exe");
+	for(int i = 1; i < argc; i++){
+		if(strncmp(argv[i], "--trace=", 8) == 0){
+			if(trace_open(argv[i] + 8) != 0)
+				return 1;
+		}
+		else if(strcmp(argv[i], "--counters") == 0){
+			counters = 1;
+		}
+		else if(strcmp(argv[i], "--alloc-stats") == 0){
+			alloc_enable();
+		}
+		else if(strncmp(argv[i], "-I", 2) == 0 && argv[i][2] != '\0'){
+			pch_add_include_dir(argv[i] + 2);
+		}
+		else if(strncmp(argv[i], "--pch-dir=", 10) == 0){
+			pch_set_cache_dir(argv[i] + 10);
+		}
+		else if(strncmp(argv[i], "--emit-pch=", 11) == 0){
+			pch_out = argv[i] + 11;
+		}
+		else if(strncmp(argv[i], "--pch-including=", 16) == 0){
+			pch_set_including(argv[i] + 16);
+		}
+		else if(strncmp(argv[i], "--symtab=", 9) == 0){
+			symtab_out = argv[i] + 9;
+		}
+		else if(strncmp(argv[i], "--xref=", 7) == 0){
+			xref_out = argv[i] + 7;
+		}
+		else if(strncmp(argv[i], "--jobs=", 7) == 0){
+			sema_set_jobs(atoi(argv[i] + 7));
+		}
+		else{
+			fprintf(stderr, "usage: %s [--trace=out.json] [--counters] [--alloc-stats] [-Idir] [--pch-dir=dir] [--symtab=symtab.bin] [--xref=xref.bin] [--jobs=n] < input.cpp\n", argv[0]);
+			return 1;
+		}
+	}
+
+	yyout = fopen(pch_out ? "/dev/null" : "output.c", "w");
+	lines_reset();
+
+	//read the whole input up front so file I/O is its own phase
+	trace_begin("read");
+	size_t srclen;
+	char *src = read_input(stdin, &srclen);
+	yyin = fmemopen(src, srclen, "r");
+	trace_end();
 
+	if(counters)
+		perf_open();
 
-	tree_top = (tree_stack*)malloc(sizeof(tree_stack));
+	tree_top = (tree_stack*)xmalloc(sizeof(tree_stack), ALLOC_TREE_STACK);
 	tree_top->node = NULL;
 	tree_top->next = NULL;
 	struct Node *root;
 
-	printf("\n");
-	yyparse();
+	//a header being precompiled: its symbols and trees go to the cache file
+	if(pch_out != NULL){
+		int status = frontend_parse() == 0 && !pch_include_failed() ? pch_write(pch_out, first, tree_top) : 1;
+		fclose(yyout);
+		return status == 0 ? 0 : 1;
+	}
 
+	printf("\n");
+	trace_begin("yyparse");
+	perf_phase_begin(PERF_PHASE_PARSE);
+	frontend_parse();
+	perf_phase_end(PERF_PHASE_PARSE);
+	trace_end();
+
+	trace_begin("preorder");
+	perf_phase_begin(PERF_PHASE_PREORDER);
+	alloc_set_phase(ALLOC_PHASE_PREORDER);
 	root = pop_tree();
 	get_levels(root, 1);
 
@@ -2761,10 +2887,72 @@ int main(){
 	preorder(root);
 	printf("\n\nPreorder Traversal\n\n");
 	printf("%s\n", preBuf);
+	perf_phase_end(PERF_PHASE_PREORDER);
+	trace_end();
 
+	//stderr, so the GUIs' parsing of stdout is unaffected
+	perf_report(stderr, srclen);
+	perf_close();
+	alloc_report(stderr);
+
+	fclose(yyin);
+	free(src);
 	fclose(yyout);
+	trace_close();
 	return 0;
 }
+#endif
+
+
+//yyparse, with the diagnostics printed either way: after a syntax error the
+//S action never ran, so the trees built before it are checked here
+int frontend_parse(void){
+	int status = yyparse();
+	if(status != 0){
+		trace_begin("sema");
+		sema_check(tree_top, pch_loaded_roots());
+		diag_flush();
+		trace_end();
+	}
+	return status;
+}
+
+
+//back to the state before the first parse; the caller frees the old trees and symbols
+void frontend_reset(void){
+	x = 0;
+	scope = 0;
+	unaryop = -1;
+	assignop = -1;
+	datatype = -1;
+	assigntype = -1;
+	idcheck = -1;
+	check_un = 0;
+	first = tmp = crt = lhs = NULL;
+	preBuf[0] = '\0';
+
+	tree_top = (tree_stack*)xmalloc(sizeof(tree_stack), ALLOC_TREE_STACK);
+	tree_top->node = NULL;
+	tree_top->next = NULL;
+	lines_reset();
+	pch_reset();
+	diag_reset();
+}
+
+
+char *read_input(FILE *fp, size_t *len){
+	size_t cap = 4096, n = 0, got;
+	char *buf = (char*)malloc(cap);
+	while((got = fread(buf + n, 1, cap - n, fp)) > 0){
+		n += got;
+		if(n == cap){
+			cap *= 2;
+			buf = (char*)realloc(buf, cap);
+		}
+	}
+	*len = n;
+	return buf;
+}
 
 
 void addfunc(struct node *t,int type, char *s){
@@ -2794,6 +2982,16 @@ void addFloat(struct node *t,int type,float val) {
 }
 
 
+//an array of size elements; the size is kept as its value
+void addArray(struct node *t, int type, int size) {
+	if(t->dtype == -1) {
+		t->dtype = type;
+		t->val.i = size;
+		strcpy(t->token, "array");
+	}
+}
+
+
 void addChar(struct node *t,int type, char val) {
    	if(t->dtype == -1) {
    	    t->dtype = type;
@@ -2825,7 +3023,7 @@ struct node * checksym(char *vname) {
 	struct node *same;
 	
 	if(first == NULL) {
-		nnode = (struct node *)malloc(sizeof(struct node));
+		nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 		addsymbol(nnode,vname);
 	    first = nnode;
 	}
@@ -2857,7 +3055,7 @@ struct node * checksym(char *vname) {
 	        rp = ftp;
 	        ftp = ftp->link;
 	    }
-	    nnode = (struct node *)malloc(sizeof(struct node));
+	    nnode = (struct node *)xmalloc(sizeof(struct node), ALLOC_SYMBOL);
 		addsymbol(nnode,vname);
 
 	    rp->link = nnode;
@@ -2868,11 +3066,13 @@ struct node * checksym(char *vname) {
 
 void addsymbol(struct node *tp, char *vname) {
     strcpy(tp->name,vname);
+    tp->token[0] = '\0';
     tp->dtype = -1;
     tp->link = NULL;
     tp->scope = scope;
     tp->valid = 1;
-    tp->lineno = line;
+    tp->uses = 0;
+    tp->offset = yylloc;		//checksym runs inside the lexer, so this is the identifier's token
 }
 
 
@@ -2884,11 +3084,13 @@ void cleansymbol(){
  
         if (entry->dtype == -1  ) { 
             *pp = entry->link; 
-            free(entry); 
+            xref_release(entry);
+            xfree(entry); 
         }
         else if(strcmp(entry->name,"main")== 0 && strcmp(entry->token, "function")==0){	//remove main entry from symbol table
         	*pp = entry->link; 
-            free(entry); 
+            xref_release(entry);
+            xfree(entry); 
         }
         // Else move to next 
         else
@@ -2917,9 +3119,12 @@ void printsymtable(){
         if(ftp->dtype==3)
         	strcpy(data_type,"void");
 
-        printf("%11s\t%12s\t%6s\t\t%d\t\t%d\t\t",ftp->token, ftp->name, data_type, ftp->scope, ftp->lineno);
+        printf("%11s\t%12s\t%6s\t\t%d\t\t%d\t\t",ftp->token, ftp->name, data_type, ftp->scope, srcpos_line(ftp->offset));
 
-        if(ftp->dtype == 0){
+        if(strcmp(ftp->token, "array") == 0){
+        	printf("[%d]\n", ftp->val.i);
+        }
+        else if(ftp->dtype == 0){
         	if(ftp->val.i == INT_MIN)
         		printf("-\n");
         	else
@@ -2946,7 +3151,7 @@ void printsymtable(){
 }
 
 
-void create_node(char *token, int leaf) {
+void create_node(char *token, int leaf, srcpos offset) {
 	Node *l;
 	Node *r;
 	if(leaf==0) {
@@ -2963,16 +3168,32 @@ void create_node(char *token, int leaf) {
 		r = NULL;
 	}
 
-	Node *newnode = (Node*)malloc(sizeof(Node));
+	Node *newnode = (Node*)xmalloc(sizeof(Node), ALLOC_NODE);
 	strcpy(newnode->token, token);
 	newnode->left = l;
 	newnode->right = r;
+	newnode->val = NULL;
+	newnode->body = NULL;
+	newnode->offset = offset;
+	newnode->type = -1;
 	push_tree(newnode);
 }
 
 
+//the type sema.c gives the leaf just created
+void type_leaf(int dtype){
+	tree_top->node->type = dtype;
+}
+
+
+const char *leaf_type_name(const Node *n){
+	static const char *const names[] = {"int", "float", "char"};
+	return n->type >= 0 && n->type < 3 ? names[n->type] : NULL;
+}
+
+
 void push_tree(Node *newnode){
-	tree_stack *temp= (tree_stack*)malloc(sizeof(tree_stack));
+	tree_stack *temp= (tree_stack*)xmalloc(sizeof(tree_stack), ALLOC_TREE_STACK);
 	temp->node = newnode;
 	temp->next = tree_top;
 	tree_top = temp;
@@ -2980,11 +3201,15 @@ void push_tree(Node *newnode){
 
 
 Node* pop_tree(){
+	//never pop the sentinel: after an error has dropped a leaf (an undeclared
+	//identifier, a header that failed to load) the stack can run short
+	if(tree_top == NULL || tree_top->next == NULL)
+		return NULL;
 	tree_stack *temp = tree_top;
 	tree_top = tree_top->next;
 	Node *retnode = temp->node;
 	if(temp != NULL)
-		free(temp);
+		xfree(temp);
 	return retnode;
 }
 
@@ -3047,6 +3272,12 @@ void preorder(Node * node){
     if(node->left || node->right || node->val || node->body)
         strcat(preBuf, " ( ");
     strcat(preBuf, node->token);
+    //typed leaves carry their type to the ICG
+    const char *type = leaf_type_name(node);
+    if(type != NULL){
+        strcat(preBuf, ":");
+        strcat(preBuf, type);
+    }
     strcat(preBuf, " ");
 
     if(node->left) preorder(node->left);
@@ -3076,3 +3307,19 @@ void get_levels(Node *root, int level){
 		get_levels(root->right, level+1);
 	}
 }
+
+
+#undef yylex
+static int traced_yylex(void){
+	if(!trace_enabled() && !perf_enabled() && yylex_hook == NULL)
+		return yylex();
+
+	long long start = trace_now();
+	perf_phase_begin(PERF_PHASE_LEX);
+	int tok = yylex();
+	perf_phase_end(PERF_PHASE_LEX);
+	trace_complete("yylex", TRACE_TID_LEXER, start, trace_now());
+	if(yylex_hook != NULL)
+		yylex_hook(tok, yylloc);
+	return tok;
+}
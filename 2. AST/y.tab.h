@@ -58,13 +58,13 @@ extern int yydebug;
     INCLUDE = 259,                 /* INCLUDE  */
     IOSTREAM = 260,                /* IOSTREAM  */
     STRING_LITERAL = 261,          /* STRING_LITERAL  */
-    HEADER_LITERAL = 262,          /* HEADER_LITERAL  */
-    PRINT = 263,                   /* PRINT  */
-    RETURN = 264,                  /* RETURN  */
-    INTEGER_LITERAL = 265,         /* INTEGER_LITERAL  */
-    CHARACTER_LITERAL = 266,       /* CHARACTER_LITERAL  */
-    FLOAT_LITERAL = 267,           /* FLOAT_LITERAL  */
-    IDENTIFIER = 268,              /* IDENTIFIER  */
+    PRINT = 262,                   /* PRINT  */
+    RETURN = 263,                  /* RETURN  */
+    INTEGER_LITERAL = 264,         /* INTEGER_LITERAL  */
+    CHARACTER_LITERAL = 265,       /* CHARACTER_LITERAL  */
+    FLOAT_LITERAL = 266,           /* FLOAT_LITERAL  */
+    IDENTIFIER = 267,              /* IDENTIFIER  */
+    HEADER_LITERAL = 268,          /* HEADER_LITERAL  */
     INC_OP = 269,                  /* INC_OP  */
     DEC_OP = 270,                  /* DEC_OP  */
     LE_OP = 271,                   /* LE_OP  */
@@ -96,13 +96,13 @@ extern int yydebug;
 #define INCLUDE 259
 #define IOSTREAM 260
 #define STRING_LITERAL 261
-#define HEADER_LITERAL 262
-#define PRINT 263
-#define RETURN 264
-#define INTEGER_LITERAL 265
-#define CHARACTER_LITERAL 266
-#define FLOAT_LITERAL 267
-#define IDENTIFIER 268
+#define PRINT 262
+#define RETURN 263
+#define INTEGER_LITERAL 264
+#define CHARACTER_LITERAL 265
+#define FLOAT_LITERAL 266
+#define IDENTIFIER 267
+#define HEADER_LITERAL 268
 #define INC_OP 269
 #define DEC_OP 270
 #define LE_OP 271
@@ -127,7 +127,7 @@ extern int yydebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 84 "ast.y"
+#line 63 "ast.y"
 
     int ival;
     float fval;
@@ -143,9 +143,23 @@ typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
 
-extern YYSTYPE yylval;
 
+extern YYSTYPE yylval;
+extern YYLTYPE yylloc;
 
 int yyparse (void);
 
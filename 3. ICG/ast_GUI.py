@@ -5,8 +5,15 @@ from tkinter.scrolledtext import ScrolledText
 from ttkthemes import ThemedStyle
 from program_converter import (
     ProgramConverter,
+    format_tac,
 )
 
+SCRIPT_DIR = os.path.dirname(__file__)
+AST_PATH = os.path.join(SCRIPT_DIR, "..", "2. AST", "ast_output.txt")
+ICG_PATH = os.path.join(SCRIPT_DIR, "icg_output.txt")
+# how often to look for files rewritten by driver.py --watch
+REFRESH_MS = 500
+
 
 class TACGeneratorGUI:
     def __init__(self, root):
@@ -66,6 +73,9 @@ class TACGeneratorGUI:
         self.load_ast_input()
         self.highlight_syntax()
 
+        self.mtimes = {path: self.mtime(path) for path in (AST_PATH, ICG_PATH)}
+        self.root.after(REFRESH_MS, self.refresh_from_files)
+
     def create_menu(self):
         menubar = tk.Menu(self.root)
         self.root.config(menu=menubar)
@@ -79,8 +89,7 @@ class TACGeneratorGUI:
 
     def load_ast_input(self):
         try:
-            script_dir = os.path.dirname(__file__)
-            ast_path = os.path.join(script_dir, "..", "2. AST", "ast_output.txt")
+            ast_path = AST_PATH
             if os.path.exists(ast_path):
                 with open(ast_path, "r") as f:
                     content = f.read().strip()
@@ -92,6 +101,31 @@ class TACGeneratorGUI:
         except Exception as e:
             messagebox.showerror("Error", f"Error loading AST: {e}")
 
+    @staticmethod
+    def mtime(path):
+        try:
+            return os.path.getmtime(path)
+        except OSError:
+            return None
+
+    def refresh_from_files(self):
+        """Show the AST and TAC files again whenever something rewrites them."""
+        widgets = {AST_PATH: self.input_text, ICG_PATH: self.output_text}
+        for path, widget in widgets.items():
+            mtime = self.mtime(path)
+            if mtime is None or mtime == self.mtimes[path]:
+                continue
+            self.mtimes[path] = mtime
+            try:
+                with open(path, "r") as f:
+                    content = f.read().strip()
+            except OSError:
+                continue
+            widget.delete("1.0", tk.END)
+            widget.insert("1.0", content)
+            self.update_status(f"Reloaded: {path}")
+        self.root.after(REFRESH_MS, self.refresh_from_files)
+
     def load_file_dialog(self):
         file_path = filedialog.askopenfilename(filetypes=[("Text Files", "*.txt")])
         if file_path:
@@ -177,37 +211,8 @@ class TACGeneratorGUI:
             converter = ProgramConverter()
             tac = converter.convert(s_expr)
 
-            script_dir = os.path.dirname(__file__)
-            icg_path = os.path.join(script_dir, "icg_output.txt")
-            lines = []
-
-            for instruction in tac:
-                op = instruction[0]
-                if op == "ASSIGN":
-                    line = f"{instruction[3]} = {instruction[1]}"
-                elif op in [
-                    "ADD",
-                    "SUB",
-                    "MUL",
-                    "DIV",
-                    ">",
-                    "<",
-                    "<=",
-                    ">=",
-                    "==",
-                    "!=",
-                ]:
-                    symbols = {"ADD": "+", "SUB": "-", "MUL": "*", "DIV": "/"}
-                    line = f"{instruction[3]} = {instruction[1]} {symbols.get(op, op)} {instruction[2]}"
-                elif op == "IF_FALSE":
-                    line = f"ifFalse {instruction[1]} goto {instruction[3]}"
-                elif op == "GOTO":
-                    line = f"goto {instruction[1]}"
-                elif op == "LABEL":
-                    line = f"{instruction[1]}:"
-                else:
-                    line = f"UNHANDLED_INSTRUCTION: {instruction}"
-                lines.append(line)
+            icg_path = ICG_PATH
+            lines = format_tac(tac)
 
             with open(icg_path, "w") as f:
                 f.write("\n".join(lines))
@@ -1,17 +1,33 @@
 import re
 import os
 
+TYPES = ("int", "float", "char")
+NAME = re.compile(r"^[A-Za-z_]")
+# the declaration of an array, "a[100]" in the dump's "Dc a[100]:int"
+ARRAY = re.compile(r"^([A-Za-z_]\w*)\[(\d+)\]$")
+# compound assignments, and the operation each one does
+COMPOUND = {"+=": "ADD", "-=": "SUB", "*=": "MUL", "/=": "DIV"}
+
 
 class ProgramConverter:
     """
     A class to convert a LISP-like S-expression string into 3-address code.
     It handles assignments, arithmetic operations, for loops, and if-else statements.
+    The code starts with a DECLARE of every name it mentions, in order of first
+    mention: variables have the type of their leaves (x:int in the dump),
+    temporaries the type of the value they hold, and a name with no type is an int.
+    An array is declared with its size, and its elements are read and written by
+    LOAD (t = a[i]) and STORE (a[i] = x), with the type of its elements. Each of
+    them is preceded by a CHECK (check a[i]), which stops the program if the index
+    is outside the array.
     """
 
     def __init__(self):
         self.temp_count = 0
         self.label_count = 0
         self.three_address_code = []
+        self.types = {}
+        self.sizes = {}
 
     def new_temp(self):
         self.temp_count += 1
@@ -23,7 +39,11 @@ class ProgramConverter:
 
     def emit(self, op, arg1=None, arg2=None, result=None):
         if op in [
+            "DECLARE",
             "ASSIGN",
+            "LOAD",
+            "STORE",
+            "CHECK",
             "ADD",
             "SUB",
             "MUL",
@@ -51,7 +71,35 @@ class ProgramConverter:
 
     def tokenize(self, s_expr_str):
         s_expr_str = s_expr_str.replace("(", " ( ").replace(")", " ) ")
-        return s_expr_str.split()
+        tokens = []
+        for token in s_expr_str.split():
+            atom, _, type_name = token.rpartition(":")
+            if atom and type_name in TYPES:
+                token = atom
+                array = ARRAY.match(atom)
+                if array:
+                    self.set_type(array.group(1), type_name)
+                    self.sizes.setdefault(array.group(1), array.group(2))
+                elif NAME.match(atom):
+                    self.set_type(atom, type_name)
+            tokens.append(token)
+        return tokens
+
+    def set_type(self, name, type_name):
+        # a name keeps the type it is first given
+        self.types.setdefault(name, type_name)
+
+    def type_of(self, atom):
+        if atom is None:
+            return "int"
+        if not NAME.match(atom):
+            return "float" if "." in atom else "int"
+        return self.types.get(atom, "int")
+
+    @staticmethod
+    def arith_type(a, b):
+        # usual arithmetic conversions: char becomes int
+        return "float" if "float" in (a, b) else "int"
 
     def parse_s_expression(self, token_list):
         sexpr = []
@@ -72,7 +120,15 @@ class ProgramConverter:
             return None
 
         op = expr[0]
-        if op == "=":
+        if op == "=" and isinstance(expr[1], list) and expr[1][0] == "[]":
+            array = expr[1][1]
+            index = self.convert_expression(expr[1][2])
+            value = self.convert_expression(expr[2])
+            self.emit("CHECK", array, index)
+            self.emit("STORE", value, index, array)
+            return value
+
+        elif op == "=":
             target = expr[1]
             value_expr = expr[2]
             value = (
@@ -83,38 +139,85 @@ class ProgramConverter:
             self.emit("ASSIGN", value, None, target)
             return target
 
+        elif op in COMPOUND and isinstance(expr[1], list) and expr[1][0] == "[]":
+            # a[i] op= x loads, operates and stores back at one index
+            array = expr[1][1]
+            index = self.convert_expression(expr[1][2])
+            value = self.convert_expression(expr[2])
+            self.emit("CHECK", array, index)
+            old = self.new_temp()
+            self.emit("LOAD", array, index, old)
+            self.set_type(old, self.type_of(array))
+            temp = self.new_temp()
+            self.emit(COMPOUND[op], old, value, temp)
+            kind = self.arith_type(self.type_of(old), self.type_of(value))
+            self.set_type(temp, kind)
+            self.emit("STORE", temp, index, array)
+            return temp
+
+        elif op in COMPOUND:
+            # x op= y is x = x op y
+            target = expr[1]
+            value = self.convert_expression(expr[2])
+            temp = self.new_temp()
+            self.emit(COMPOUND[op], target, value, temp)
+            kind = self.arith_type(self.type_of(target), self.type_of(value))
+            self.set_type(temp, kind)
+            self.emit("ASSIGN", temp, None, target)
+            return target
+
         elif op in ["+", "-", "*", "/", ">", "<", "<=", ">=", "==", "!="]:
             arg1 = self.convert_expression(expr[1])
             arg2 = self.convert_expression(expr[2])
             temp = self.new_temp()
             op_map = {"+": "ADD", "-": "SUB", "*": "MUL", "/": "DIV"}
             self.emit(op_map.get(op, op), arg1, arg2, temp)
+            # comparisons are ints, as in C
+            if op in op_map:
+                type_name = self.arith_type(self.type_of(arg1), self.type_of(arg2))
+            else:
+                type_name = "int"
+            self.set_type(temp, type_name)
+            return temp
+
+        elif op == "[]":
+            array = expr[1]
+            index = self.convert_expression(expr[2])
+            temp = self.new_temp()
+            self.emit("CHECK", array, index)
+            self.emit("LOAD", array, index, temp)
+            self.set_type(temp, self.type_of(array))
             return temp
 
         elif op == "++":
             var = expr[-1]
             temp = self.new_temp()
+            self.set_type(temp, self.arith_type(self.type_of(var), "int"))
             self.emit("ADD", var, "1", temp)
             self.emit("ASSIGN", temp, None, var)
             return var
 
         elif op == "if":
             condition_expr = expr[1]
-            true_branch_val = self.convert_expression(expr[2])
-            false_branch_val = (
-                self.convert_expression(expr[3]) if len(expr) > 3 else None
-            )
             result_temp = self.new_temp()
             label_false = self.new_label()
             label_end = self.new_label()
             cond_result = self.convert_expression(condition_expr)
             self.emit("IF_FALSE", cond_result, None, label_false)
+            # each branch is evaluated only on its own path
+            true_branch_val = self.convert_expression(expr[2])
+            result_type = self.type_of(true_branch_val)
             self.emit("ASSIGN", true_branch_val, None, result_temp)
             self.emit("GOTO", label_end)
             self.emit("LABEL", label_false)
-            if false_branch_val is not None:
+            if len(expr) > 3:
+                false_branch_val = self.convert_expression(expr[3])
+                result_type = self.arith_type(
+                    result_type, self.type_of(false_branch_val)
+                )
                 self.emit("ASSIGN", false_branch_val, None, result_temp)
             self.emit("LABEL", label_end)
+            self.set_type(result_temp, result_type)
             return result_temp
 
         else:
@@ -163,11 +266,74 @@ class ProgramConverter:
             and parsed_ast[0][0] == "main"
         ):
             self.convert_statement(parsed_ast[0])
+            self.declare()
         else:
             print("Error: Input does not start with a 'main' block or is malformed.")
         return self.three_address_code
 
 
+    def declare(self):
+        """Put a DECLARE of each name the code mentions in front of it."""
+        declared = {}
+        for instruction in self.three_address_code:
+            op = instruction[0]
+            if op in ("GOTO", "LABEL"):
+                continue
+            if op == "IF_FALSE":
+                names = [instruction[1]]
+            else:
+                names = [instruction[3], instruction[1], instruction[2]]
+            for name in names:
+                if name is not None and NAME.match(name) and name not in declared:
+                    self.set_type(name, "int")
+                    size = self.sizes.get(name)
+                    declared[name] = ["DECLARE", self.types[name], size, name]
+        self.three_address_code = list(declared.values()) + self.three_address_code
+
+
+def format_tac(three_address_code):
+    """Render instructions from ProgramConverter.convert as icg_output.txt lines."""
+    lines = []
+    for instruction in three_address_code:
+        op = instruction[0]
+        if op == "DECLARE":
+            line = f"{instruction[1]} {instruction[3]}"
+            if instruction[2] is not None:
+                line += f"[{instruction[2]}]"
+        elif op == "ASSIGN":
+            line = f"{instruction[3]} = {instruction[1]}"
+        elif op == "LOAD":
+            line = f"{instruction[3]} = {instruction[1]}[{instruction[2]}]"
+        elif op == "STORE":
+            line = f"{instruction[3]}[{instruction[2]}] = {instruction[1]}"
+        elif op == "CHECK":
+            line = f"check {instruction[1]}[{instruction[2]}]"
+        elif op in [
+            "ADD",
+            "SUB",
+            "MUL",
+            "DIV",
+            ">",
+            "<",
+            "<=",
+            ">=",
+            "==",
+            "!=",
+        ]:
+            symbols = {"ADD": "+", "SUB": "-", "MUL": "*", "DIV": "/"}
+            line = f"{instruction[3]} = {instruction[1]} {symbols.get(op, op)} {instruction[2]}"
+        elif op == "IF_FALSE":
+            line = f"ifFalse {instruction[1]} goto {instruction[3]}"
+        elif op == "GOTO":
+            line = f"goto {instruction[1]}"
+        elif op == "LABEL":
+            line = f"{instruction[1]}:"
+        else:
+            line = f"UNHANDLED_INSTRUCTION: {instruction}"
+        lines.append(line)
+    return lines
+
+
 if __name__ == "__main__":
     script_dir = os.path.dirname(__file__)
     ast_output_path = os.path.join(script_dir, "..", "2. AST", "ast_output.txt")
@@ -191,32 +357,7 @@ if __name__ == "__main__":
 
     try:
         with open(icg_output_path, "w") as outfile:
-            for instruction in three_address_code:
-                op = instruction[0]
-                if op == "ASSIGN":
-                    line = f"{instruction[3]} = {instruction[1]}"
-                elif op in [
-                    "ADD",
-                    "SUB",
-                    "MUL",
-                    "DIV",
-                    ">",
-                    "<",
-                    "<=",
-                    ">=",
-                    "==",
-                    "!=",
-                ]:
-                    symbols = {"ADD": "+", "SUB": "-", "MUL": "*", "DIV": "/"}
-                    line = f"{instruction[3]} = {instruction[1]} {symbols.get(op, op)} {instruction[2]}"
-                elif op == "IF_FALSE":
-                    line = f"ifFalse {instruction[1]} goto {instruction[3]}"
-                elif op == "GOTO":
-                    line = f"goto {instruction[1]}"
-                elif op == "LABEL":
-                    line = f"{instruction[1]}:"
-                else:
-                    line = f"UNHANDLED_INSTRUCTION: {instruction}"
+            for line in format_tac(three_address_code):
                 outfile.write(line + "\n")
         print(f"Successfully generated 3-address code and saved to '{icg_output_path}'")
     except Exception as e:
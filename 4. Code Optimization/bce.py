@@ -0,0 +1,100 @@
+import tac_types
+from peephole import to_text
+from vectorize import counted_loop
+from vrp import Ranges
+
+# Bounds-check elimination. The ICG puts a check a[i] in front of every load
+# and store, which stops the program if i is outside a; this pass removes
+# the ones that cannot fail, in two steps.
+#
+# Hoisting: in a counted loop (vectorize.py) stepping by 1, a check of the counter that
+# runs on every iteration, before any label or jump in the body, sees each
+# value the counter takes from its value on entry up to the bound. One check
+# a[i..n] in front of the loop covers them all (it passes if the loop does
+# not run), and the checks of a in the body go. The program then stops
+# before the loop rather than in the iteration that would go out of bounds.
+#
+# Proof: value ranges (vrp.py) give the interval of each index before each
+# check, narrowed by the guards that dominate it and by earlier checks of
+# the same index, and a check whose indices all lie inside the array is
+# removed. After hoisting this also applies to the check in front of the
+# loop, whose bounds are often known when the body's index was not.
+
+
+def eliminate_bounds_checks(code, log=None, types=None):
+    """Rewrite a list of (kind, fields...) tuples; returns the new list."""
+    types = types or {}
+    checks = sum(1 for t in code if t[0] == "check")
+    if not checks:
+        return code
+    code, hoisted = hoist(code, log, types)
+    ranges = Ranges(code, types)
+    out = []
+    for i, t in enumerate(code):
+        env = ranges.before[i]
+        if t[0] == "check" and env is not None and safe(ranges, env, t):
+            if log is not None:
+                log.append(
+                    f"Bounds check: '{to_text(t)}' cannot fail, removed "
+                    f"in instruction {i + 1}"
+                )
+            continue
+        out.append(t)
+    if log is not None:
+        left = sum(1 for t in out if t[0] == "check")
+        log.append(
+            f"Bounds check: {left} of {checks} checks left, "
+            f"{hoisted} hoisted out of loops"
+        )
+    return out
+
+
+def safe(ranges, env, t):
+    """Whether check t passes whatever the values allowed by env."""
+    size = tac_types.array_size(ranges.types.get(t[1]))
+    if size is None:
+        return False
+    first, last = ranges.value(env, t[2]), ranges.value(env, t[3])
+    if first.lo > last.hi:
+        # no index at all
+        return True
+    if not (first.integral and last.integral):
+        return False
+    return first.lo >= 0 and last.hi <= size - 1
+
+
+def hoist(code, log, types):
+    """code with the checks of each counted loop's counter in front of it;
+    returns it and the number of checks taken out of loops."""
+    before = {}
+    dropped = set()
+    for h, t in enumerate(code):
+        loop = counted_loop(code, h, types)
+        if loop is None or loop.step != 1:
+            continue
+        i = loop.index
+        arrays = []
+        for u in loop.body:
+            if u[0] in ("label", "goto", "ifFalse"):
+                break
+            if u[0] == "check" and u[2] == u[3] == i and u[1] not in arrays:
+                arrays.append(u[1])
+        before[h] = [("check", array, i, loop.bound) for array in arrays]
+        # the loop's other checks of those arrays, wherever they are in it
+        for j in range(loop.start, loop.start + len(loop.body)):
+            u = code[j]
+            if u[0] == "check" and u[1] in arrays and u[2] == u[3] == i:
+                dropped.add(j)
+
+    out = []
+    for h, t in enumerate(code):
+        for new in before.get(h, []):
+            if log is not None:
+                log.append(
+                    f"Bounds check: '{new[1]}[{new[2]}]' checked once as "
+                    f"'{to_text(new)}' before the loop at '{t[1]}:'"
+                )
+            out.append(new)
+        if h not in dropped:
+            out.append(t)
+    return out, len(dropped)
@@ -0,0 +1,279 @@
+import argparse
+import glob
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+# Dynamic instruction counts of the benchmark programs: each is compiled to
+# TAC, optimized with and without lazy code motion, and run in tac_vm.py,
+# which also checks that every version ends with the same variables. Besides
+# all instructions, the arithmetic and comparisons executed ("ops") are
+# counted, since those are what code motion saves; an evaluation it removes
+# can leave a copy behind. The branches column is the conditional branches
+# left in the optimized code out of those the ICG emitted, and the checks
+# column the bounds checks the optimized code executes out of the ICG's.
+#
+# With --vector-width both optimized versions vectorize their loops, and with
+# --native the LCM version is also built by the C backend and run, and must
+# end with the same variables as in the VM. --threads 1,2,4 then also times
+# the native program (best of RUNS) with OpenMP limited to each number of
+# threads, for the loops parallel.py marks. With --x86 the LCM version is
+# also built by the x86-64 backend with each register allocator, checked
+# against the VM, and reported as stack slots / instructions reaching them
+# and as its best time in ms. --link times building the LCM version's
+# assembly into a program, with as and ld and with the backend's own encoder
+# and ELF writer (best of RUNS, in ms), and checks both programs against the
+# VM.
+
+OPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(OPT_DIR)
+sys.path.insert(0, ROOT_DIR)
+sys.path.insert(0, os.path.join(ROOT_DIR, "5. Code Generation"))
+
+import build  # noqa: E402
+import c_backend  # noqa: E402
+import driver  # noqa: E402
+import tac_vm  # noqa: E402
+import x86_backend  # noqa: E402
+from code_optimizer import optimize_code  # noqa: E402
+from lcm import TEMP  # noqa: E402
+from program_converter import ProgramConverter, format_tac  # noqa: E402
+
+RUNS = 5
+
+CORPUS = sorted(glob.glob(os.path.join(OPT_DIR, "benchmarks", "*.cpp"))) + [
+    os.path.join(ROOT_DIR, "main_input.cpp")
+]
+
+
+def program_state(env):
+    """The source program's variables, without the temporaries."""
+    return {name: v for name, v in env.items() if not TEMP.match(name)}
+
+
+def run_native(text, threads=()):
+    """The final variables of text built by the C backend and run, and its
+    time in ms at each number of threads."""
+    source, flags = c_backend.translate(text)
+    with tempfile.TemporaryDirectory() as folder:
+        exe = os.path.join(folder, "program")
+        c_backend.compile_c(source, flags, exe)
+        state = program_state(c_backend.run_program(exe))
+        return state, [time_program(exe, n) for n in threads]
+
+
+def run_x86(text):
+    """The final variables of text built by the x86-64 backend with each
+    register allocator, with its statistics and its time in ms."""
+    results = []
+    for allocator in x86_backend.ALLOCATORS:
+        source, stats = x86_backend.translate(text, allocator)
+        with tempfile.TemporaryDirectory() as folder:
+            exe = os.path.join(folder, "program")
+            x86_backend.compile_program(source, exe)
+            state = program_state(c_backend.run_program(exe))
+            results.append((state, stats, time_program(exe, 1)))
+    return results
+
+
+def time_builds(text):
+    """The final variables of text's x86-64 program built with as and ld and
+    with the builtin assembler, each with its best build time in ms."""
+    source, _ = x86_backend.translate(text)
+    results = []
+    for assembler in ("gnu", "builtin"):
+        with tempfile.TemporaryDirectory() as folder:
+            exe = os.path.join(folder, "program")
+            best = None
+            for _ in range(RUNS):
+                start = time.perf_counter()
+                x86_backend.compile_program(source, exe, assembler)
+                elapsed = 1000 * (time.perf_counter() - start)
+                best = elapsed if best is None else min(best, elapsed)
+            state = program_state(c_backend.run_program(exe))
+            results.append((state, best))
+    return results
+
+
+def time_program(exe, threads):
+    """The best wall time in ms of RUNS runs of exe on that many threads."""
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    best = None
+    for _ in range(RUNS):
+        start = time.perf_counter()
+        subprocess.run([exe], env=env, capture_output=True, check=True)
+        elapsed = 1000 * (time.perf_counter() - start)
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def measure(path, vector_width=0, native=False, threads=(), x86=False, link=False):
+    """The counts of the ICG, no LCM and LCM versions, the native times of
+    the LCM one at each number of threads, its x86-64 builds' statistics
+    and times, and the times to build its program with as and ld and
+    in-process."""
+    ast_text = driver.extract_preorder(driver.run_frontend(path))
+    icg = "\n".join(format_tac(ProgramConverter().convert(ast_text.strip())))
+    versions = [
+        ("ICG", icg),
+        ("no LCM", optimize_code(icg, lcm=False, vector_width=vector_width)[0]),
+        ("LCM", optimize_code(icg, vector_width=vector_width)[0]),
+    ]
+    counts = []
+    expected = None
+    for name, text in versions:
+        code, types = tac_vm.parse(text)
+        env, executed = tac_vm.run(code, types=types)
+        state = program_state(env)
+        if expected is None:
+            expected = state
+        elif state != expected:
+            raise tac_vm.VMError(f"{name} ends with {state}, ICG with {expected}")
+        branches = sum(1 for t in code if t[0] == "ifFalse")
+        counts.append(
+            (sum(executed.values()), executed["binop"], branches, executed["check"])
+        )
+    times = []
+    if native:
+        state, times = run_native(versions[-1][1], threads)
+        if state != expected:
+            raise tac_vm.VMError(f"native code ends with {state}, ICG with {expected}")
+    builds = []
+    if x86:
+        for state, stats, ms in run_x86(versions[-1][1]):
+            if state != expected:
+                raise tac_vm.VMError(
+                    f"x86-64 code ends with {state}, ICG with {expected}"
+                )
+            builds.append((stats.get("spilled", 0), stats.get("spill accesses", 0), ms))
+    links = []
+    if link:
+        for state, ms in time_builds(versions[-1][1]):
+            if state != expected:
+                raise tac_vm.VMError(
+                    f"x86-64 code ends with {state}, ICG with {expected}"
+                )
+            links.append(ms)
+    return counts, times, builds, links
+
+
+def row(name, counts, times=(), builds=(), links=()):
+    icg, _, emitted, checked = counts[0]
+    before, before_ops, _, _ = counts[1]
+    after, after_ops, left, checks = counts[2]
+    saved = 100 * (before - after) / before
+    saved_ops = 100 * (before_ops - after_ops) / before_ops
+    return (
+        f"{name:<18}{icg:>8}{before:>8}{after:>8}{saved:>7.1f}%"
+        f"{before_ops:>8}{after_ops:>8}{saved_ops:>7.1f}%{f'{left}/{emitted}':>10}"
+        f"{f'{checks}/{checked}':>12}"
+        + "".join(f"{ms:>9.2f}" for ms in times)
+        + "".join(f"{f'{slots}/{refs}':>14}" for slots, refs, _ in builds)
+        + "".join(f"{ms:>11.2f}" for _, _, ms in builds)
+        + "".join(f"{ms:>12.2f}" for ms in links)
+    )
+
+
+def thread_counts(text):
+    """'1,2,4' as [1, 2, 4]."""
+    try:
+        counts = [int(n) for n in text.split(",")]
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"not a list of numbers: '{text}'")
+    if any(n < 1 for n in counts):
+        raise argparse.ArgumentTypeError("thread counts start at 1")
+    return counts
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Count the TAC instructions the benchmark programs execute."
+    )
+    parser.add_argument(
+        "sources", nargs="*", metavar="FILE", help="programs (default: the corpus)"
+    )
+    parser.add_argument(
+        "--vector-width",
+        type=int,
+        default=0,
+        metavar="N",
+        help="vectorize loops N iterations at a time (default 0, off)",
+    )
+    parser.add_argument(
+        "--native",
+        action="store_true",
+        help="also check the LCM version built with the C backend against the VM",
+    )
+    parser.add_argument(
+        "--x86",
+        action="store_true",
+        help="also build the LCM version with the x86-64 backend, with each "
+        "register allocator",
+    )
+    parser.add_argument(
+        "--link",
+        action="store_true",
+        help="time building the LCM version into an x86-64 program with as and "
+        "ld and in-process (ms)",
+    )
+    parser.add_argument(
+        "--threads",
+        type=thread_counts,
+        default=[],
+        metavar="N,...",
+        help="with --native, time the program on each number of threads (ms)",
+    )
+    args = parser.parse_args()
+    if args.threads and not args.native:
+        parser.error("--threads needs --native")
+    try:
+        build.ensure(["frontend"])
+    except build.BuildError as e:
+        if not os.path.isfile(driver.FRONTEND):
+            print(f"Error: a.out not built: {e}", file=sys.stderr)
+            return 1
+        print(f"warning: using the existing a.out: {e}", file=sys.stderr)
+
+    allocators = list(x86_backend.ALLOCATORS) if args.x86 else []
+    print(f"{'':<26}{'instructions':>24}{'ops':>20}")
+    print(
+        f"{'program':<18}{'ICG':>8}{'no LCM':>8}{'LCM':>8}{'saved':>8}"
+        f"{'no LCM':>8}{'LCM':>8}{'saved':>8}{'branches':>10}{'checks':>12}"
+        + "".join(f"{f'{n} thr':>9}" for n in args.threads)
+        + "".join(f"{f'{a} spill':>14}" for a in allocators)
+        + "".join(f"{f'{a} ms':>11}" for a in allocators)
+        + (f"{'as+ld ms':>12}{'builtin ms':>12}" if args.link else "")
+    )
+    totals = [(0, 0, 0, 0)] * 3
+    time_totals = [0.0] * len(args.threads)
+    build_totals = [(0, 0, 0.0)] * len(allocators)
+    link_totals = [0.0, 0.0] if args.link else []
+    for path in args.sources or CORPUS:
+        try:
+            counts, times, builds, links = measure(
+                path, args.vector_width, args.native, args.threads, args.x86, args.link
+            )
+        except (
+            OSError,
+            RuntimeError,
+            subprocess.CalledProcessError,
+            tac_vm.VMError,
+            c_backend.BackendError,
+        ) as e:
+            print(f"Error: {os.path.basename(path)}: {e}", file=sys.stderr)
+            return 1
+        totals = [tuple(map(sum, zip(t, c))) for t, c in zip(totals, counts)]
+        time_totals = [t + ms for t, ms in zip(time_totals, times)]
+        build_totals = [
+            tuple(map(sum, zip(t, b))) for t, b in zip(build_totals, builds)
+        ]
+        link_totals = [t + ms for t, ms in zip(link_totals, links)]
+        print(row(os.path.basename(path), counts, times, builds, links))
+    print(row("total", totals, time_totals, build_totals, link_totals))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
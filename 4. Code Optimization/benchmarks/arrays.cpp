@@ -0,0 +1,33 @@
+int main()
+{
+    float x[1000];
+    float y[1000];
+    float z[1000];
+    int p[1000];
+    int q[1000];
+    int i;
+    int n = 999;
+    float a = 2.5;
+    int k = 3;
+
+    for (i = 0; i <= n; i++)
+    {
+        x[i] = i;
+        y[i] = i * 0.5;
+        p[i] = i * 7;
+        q[i] = n - i;
+    }
+
+    for (i = 0; i <= n; i++)
+    {
+        z[i] = a * x[i] + y[i];
+    }
+
+    for (i = 0; i <= n; i++)
+    {
+        q[i] = p[i] * k - q[i];
+    }
+
+    float first = z[0] + z[n];
+    int last = q[n];
+}
@@ -0,0 +1,34 @@
+int main()
+{
+    float x[1000];
+    float y[1000];
+    int h[1000];
+    int i;
+    int j;
+    int n = 0;
+    float a = 0.5;
+
+    for (j = 1; j <= 40; j++)
+    {
+        n = n + 25;
+    }
+
+    for (i = 0; i <= n - 1; i++)
+    {
+        x[i] = i;
+        h[i] = i * 3;
+    }
+
+    for (i = 0; i <= n - 1; i++)
+    {
+        y[i] = x[i] * a + y[i];
+    }
+
+    for (i = 1; i <= 998; i++)
+    {
+        h[i] = h[i - 1] + h[i + 1];
+    }
+
+    float last = y[n - 1];
+    int middle = h[500];
+}
@@ -0,0 +1,24 @@
+int main()
+{
+    int w = 0;
+    int h = 5;
+    int m = 400;
+    int area = 0;
+    int i;
+
+    for (i = 1; i <= 12; i++)
+    {
+        w = w + 1;
+    }
+
+    for (i = 1; i <= m; i++)
+    {
+        if (i > w + h)
+        {
+            area = area + w * h;
+        }
+        area = area + w * h - i;
+    }
+
+    int edge = w + h;
+}
@@ -0,0 +1,17 @@
+int main()
+{
+    int s = 0;
+    int i;
+
+    for (i = 1; i <= 60; i++)
+    {
+        if (i > 0)
+        {
+            s = s + i;
+        }
+        int c = (i > 100) ? 100 : i;
+        s = s + c;
+    }
+
+    int done = (i > 60) ? 1 : 0;
+}
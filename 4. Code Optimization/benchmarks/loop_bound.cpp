@@ -0,0 +1,20 @@
+int main()
+{
+    int n = 0;
+    int a = 3;
+    int b = 7;
+    int s = 0;
+    int i;
+
+    for (i = 1; i <= 40; i++)
+    {
+        n = n + 10;
+    }
+
+    for (i = 1; i <= n * a - b; i++)
+    {
+        s = s + i * 2;
+    }
+
+    int k = n * a - b;
+}
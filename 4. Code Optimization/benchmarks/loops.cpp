@@ -0,0 +1,26 @@
+int main()
+{
+    int n = 0;
+    int step = 3;
+    int x = 0;
+    int y = 0;
+    int i;
+    int j;
+
+    for (i = 1; i <= 25; i++)
+    {
+        n = n + 4;
+    }
+
+    for (i = 0; i <= n / step; i++)
+    {
+        x = x + i;
+    }
+
+    for (j = 0; j <= n / step + 10; j++)
+    {
+        y = (j > n / step) ? y + j : y - 1;
+    }
+
+    int z = x + y;
+}
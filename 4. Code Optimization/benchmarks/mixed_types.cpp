@@ -0,0 +1,21 @@
+int main()
+{
+    int n = 7;
+    int half = n / 2;
+    float f = 7.0;
+    float g = f / 2;
+    char c = 'a';
+    float sum = 0.0;
+    int whole = 0;
+    int i;
+
+    for (i = 1; i <= 50; i++)
+    {
+        sum = sum + g;
+        whole = whole + i / 4;
+        c = c + 1;
+    }
+
+    int q = (whole > half) ? whole / 3 : half;
+    float r = sum / 4;
+}
@@ -0,0 +1,39 @@
+int main()
+{
+    int a[1000];
+    int b[1000];
+    int c[1000];
+    int i;
+    int n = 999;
+    int d = 0;
+    int s = 0;
+    int hits = 0;
+    int last = 0;
+
+    for (i = 0; i <= n; i++)
+    {
+        a[i] = i * 7;
+        b[i] = n - i;
+    }
+
+    for (i = 0; i <= n; i++)
+    {
+        d = a[i] - b[i];
+        c[i] = d * d + a[i];
+        last = d;
+    }
+
+    for (i = 0; i <= n; i++)
+    {
+        s += c[i];
+        if (c[i] > 100000)
+        {
+            hits += 1;
+        }
+    }
+
+    for (i = 1; i <= n; i++)
+    {
+        b[i] = b[i - 1] + a[i];
+    }
+}
@@ -0,0 +1,39 @@
+int main()
+{
+    int w1 = 11;
+    int w2 = 12;
+    int w3 = 13;
+    int w4 = 14;
+    int w5 = 15;
+    int w6 = 16;
+    int w7 = 17;
+    int w8 = 18;
+    int w9 = 19;
+    int w10 = 20;
+    int w11 = 21;
+    int w12 = 22;
+    int n = 3000;
+    int i;
+    int s1 = 0;
+    int s2 = 1;
+    int s3 = 2;
+    int s4 = 3;
+    int s5 = 4;
+    int s6 = 5;
+    int s7 = 6;
+    int s8 = 7;
+
+    for (i = 0; i <= n; i++)
+    {
+        s1 = s1 + i;
+        s2 = s2 + s1 * 3;
+        s3 = s3 - s2 * 7;
+        s4 = s4 + s3 * s1;
+        s5 = s5 * 5 + s4;
+        s6 = s6 + s5 - s8;
+        s7 = s7 - s6 + s1;
+        s8 = s8 + s7 * 2 - s2;
+    }
+
+    int total = w1 + w2 + w3 + w4 + w5 + w6 + w7 + w8 + w9 + w10 + w11 + w12;
+}
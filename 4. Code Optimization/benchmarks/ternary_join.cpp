@@ -0,0 +1,15 @@
+int main()
+{
+    int a = 6;
+    int b = 9;
+    int s = 0;
+    int i;
+
+    for (i = 1; i <= 300; i++)
+    {
+        int c = (i > 150) ? a * b : i;
+        int d = a * b + c;
+        s = s + d;
+        a = a + 1;
+    }
+}
@@ -0,0 +1,61 @@
+# Control flow graph of TAC in the (kind, fields...) form of peephole.py,
+# for the global passes. Every instruction is a node; blocks group them into
+# basic blocks for anything that wants the coarser view.
+
+
+class CFG:
+    def __init__(self, code):
+        self.code = code
+        n = len(code)
+        self.labels = {t[1]: i for i, t in enumerate(code) if t[0] == "label"}
+        self.succ = [[] for _ in range(n)]
+        self.pred = [[] for _ in range(n)]
+        # instructions that can leave the program by running off its end
+        self.exits = []
+        for i, t in enumerate(code):
+            targets = []
+            if t[0] == "goto":
+                targets.append(self.labels[t[1]])
+            else:
+                if t[0] == "ifFalse":
+                    targets.append(self.labels[t[2]])
+                if i + 1 < n:
+                    targets.append(i + 1)
+                else:
+                    self.exits.append(i)
+            for j in dict.fromkeys(targets):
+                self.succ[i].append(j)
+                self.pred[j].append(i)
+
+        # basic blocks as [start, end) ranges
+        leaders = {0} if n else set()
+        for i, t in enumerate(code):
+            if t[0] == "label":
+                leaders.add(i)
+            elif t[0] in ("goto", "ifFalse") and i + 1 < n:
+                leaders.add(i + 1)
+        starts = sorted(leaders)
+        self.blocks = list(zip(starts, starts[1:] + [n]))
+
+    def falls_through(self, i):
+        """Whether control can go from instruction i to the one after it."""
+        return self.code[i][0] != "goto"
+
+    def reverse_postorder(self):
+        """Reachable instructions, each before its successors except along back edges."""
+        order = []
+        seen = set()
+        stack = [(0, iter(self.succ[0]))] if self.code else []
+        if self.code:
+            seen.add(0)
+        while stack:
+            node, it = stack[-1]
+            for s in it:
+                if s not in seen:
+                    seen.add(s)
+                    stack.append((s, iter(self.succ[s])))
+                    break
+            else:
+                stack.pop()
+                order.append(node)
+        return order[::-1]
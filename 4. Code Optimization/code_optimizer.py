@@ -1,5 +1,14 @@
 import re
 import os
+from contextlib import nullcontext
+
+import tac_types
+from bce import eliminate_bounds_checks
+from lcm import lazy_code_motion
+from parallel import parallelize
+from peephole import DEFAULT_WINDOW, Peephole, parallel_text, to_text, to_tuple
+from vectorize import vectorize
+from vrp import value_ranges
 
 
 class Instruction:
@@ -11,8 +20,12 @@ class Instruction:
         self.operator = None
         self.op2 = None
         self.label = None
+        self.data_type = None
+        self.array = None
+        self.index = None
         self.condition_var = None
         self.jump_target = None
+        self.clauses = None
         self.is_removed = False
         self._parse()
 
@@ -23,6 +36,29 @@ class Instruction:
             self.type = "label"
             self.label = match.group(1)
             return
+        match = re.match(r"^parallel (L\d+)((?: \w+\([^)]*\))*)$", line)
+        if match:
+            # a loop marked parallel: (private, lastprivate, reductions)
+            self.type = "parallel"
+            self.label = match.group(1)
+            clauses = {"private": (), "lastprivate": (), "reduction": ()}
+            for name, args in re.findall(r"(\w+)\(([^)]*)\)", match.group(2)):
+                if name == "reduction":
+                    op, _, names = args.partition(":")
+                    found = tuple((op.strip(), v.strip()) for v in names.split(","))
+                    clauses[name] += found
+                elif name in clauses:
+                    clauses[name] += tuple(v.strip() for v in args.split(","))
+                else:
+                    raise ValueError(f"Unknown clause '{name}' in: {line}")
+            self.clauses = tuple(clauses.values())
+            return
+        match = tac_types.DECLARATION.match(line)
+        if match:
+            self.type = "declaration"
+            self.data_type = tac_types.declared_type(match)
+            self.target = match.group(3)
+            return
         match = re.match(r"^ifFalse (\w+) goto (L\d+)$", line)
         if match:
             self.type = "ifFalse"
@@ -35,7 +71,7 @@ class Instruction:
             self.jump_target = match.group(1)
             return
         match = re.match(
-            r"^(\w+)\s*=\s*([a-zA-Z_][\w]*|\d+(?:\.\d+)?|True|False)\s*([+\-*/]|<=|>)\s*([a-zA-Z_][\w]*|\d+(?:\.\d+)?|True|False)$",
+            r"^(\w+)\s*=\s*([a-zA-Z_][\w]*|-?\d+(?:\.\d+)?|True|False)\s*([+\-*/]|<=|>)\s*([a-zA-Z_][\w]*|-?\d+(?:\.\d+)?|True|False)$",
             line,
         )
         if match:
@@ -45,8 +81,36 @@ class Instruction:
             self.operator = match.group(3)
             self.op2 = match.group(4)
             return
+        match = re.match(r"^(\w+)\s*=\s*([a-zA-Z_]\w*)\[([a-zA-Z_]\w*|-?\d+)\]$", line)
+        if match:
+            self.type = "array_load"
+            self.target = match.group(1)
+            self.array = match.group(2)
+            self.index = match.group(3)
+            return
         match = re.match(
-            r"^(\w+)\s*=\s*([a-zA-Z_][\w]*|\d+(?:\.\d+)?|True|False)$", line
+            r"^([a-zA-Z_]\w*)\[([a-zA-Z_]\w*|-?\d+)\]\s*=\s*([a-zA-Z_][\w]*|-?\d+(?:\.\d+)?|True|False)$",
+            line,
+        )
+        if match:
+            self.type = "array_store"
+            self.array = match.group(1)
+            self.index = match.group(2)
+            self.op1 = match.group(3)
+            return
+        match = re.match(
+            r"^check ([a-zA-Z_]\w*)\[([a-zA-Z_]\w*|-?\d+)(?:\.\.([a-zA-Z_]\w*|-?\d+))?\]$",
+            line,
+        )
+        if match:
+            # check a[i], or check a[i..n] for every index from i to n
+            self.type = "bounds_check"
+            self.array = match.group(1)
+            self.index = match.group(2)
+            self.op1 = match.group(3) or match.group(2)
+            return
+        match = re.match(
+            r"^(\w+)\s*=\s*([a-zA-Z_][\w]*|-?\d+(?:\.\d+)?|True|False)$", line
         )
         if match:
             self.type = "simple_assignment"
@@ -60,6 +124,18 @@ class Instruction:
             return ""
         if self.type == "label":
             return f"{self.label}:"
+        if self.type == "declaration":
+            return tac_types.declaration(self.target, self.data_type)
+        if self.type == "array_load":
+            return f"{self.target} = {self.array}[{self.index}]"
+        if self.type == "array_store":
+            return f"{self.array}[{self.index}] = {self.op1}"
+        if self.type == "bounds_check":
+            if self.op1 == self.index:
+                return f"check {self.array}[{self.index}]"
+            return f"check {self.array}[{self.index}..{self.op1}]"
+        if self.type == "parallel":
+            return parallel_text(("parallel", self.label) + self.clauses)
         if self.type == "ifFalse":
             return f"ifFalse {self.condition_var} goto {self.jump_target}"
         if self.type == "goto":
@@ -79,58 +155,79 @@ def is_numeric(value):
         return False
 
 
-def evaluate_expression(op1, operator, op2):
-    try:
-        val1 = (
-            float(op1)
-            if is_numeric(op1)
-            else (True if op1 == "True" else (False if op1 == "False" else None))
-        )
-        val2 = (
-            float(op2)
-            if is_numeric(op2)
-            else (True if op2 == "True" else (False if op2 == "False" else None))
-        )
-        if val1 is None or val2 is None:
-            return None
-        if operator == "+":
-            return str(val1 + val2)
-        if operator == "-":
-            return str(val1 - val2)
-        if operator == "*":
-            return str(val1 * val2)
-        if operator == "/":
-            if val2 == 0:
-                return None
-            return str(val1 / val2)
-        if operator == "<=":
-            return str(val1 <= val2)
-        if operator == ">":
-            return str(val1 > val2)
+def evaluate_expression(op1, operator, op2, target_type=None):
+    """
+    The literal op1 operator op2 stores into a name of target_type, computed
+    exactly in the operands' types (int division truncates), or None.
+    """
+    val1 = tac_types.value_of(op1)
+    val2 = tac_types.value_of(op2)
+    if val1 is None or val2 is None:
         return None
-    except Exception:
+    result = tac_types.evaluate(val1, operator, val2)
+    if result is None:
         return None
+    if operator in tac_types.COMPARISONS:
+        return str(result)
+    return convert_constant(tac_types.literal(result), target_type)
 
 
-def optimize_code(code_string):
-    lines = [line.strip() for line in code_string.strip().split("\n") if line.strip()]
-    instructions = [Instruction(line) for line in lines]
-    optimization_log = []
-    constant_propagation_map = {}
-    copy_propagation_map = {}
+def convert_constant(value, target_type):
+    """The literal value as stored into a name of target_type, or None."""
+    if value is None or value in ("True", "False"):
+        return value
+    converted = tac_types.convert(tac_types.value_of(value), target_type)
+    return None if converted is None else tac_types.literal(converted)
+
+
+def same_type(a, b, types):
+    # a copy between names of different types converts, so it is no copy
+    return tac_types.operand_type(a, types) == tac_types.operand_type(b, types)
+
+
+def find_mutable_vars(instructions):
     # Times variables are assigned to detect mutability
     assign_counts = {}
-    # First pass: count assignments per variable
     for instr in instructions:
-        if instr.type in ("simple_assignment", "expression_assignment"):
+        if instr.type in ("simple_assignment", "expression_assignment", "array_load"):
             assign_counts[instr.target] = assign_counts.get(instr.target, 0) + 1
     # Variables assigned more than once are mutable, so can't be constants
-    mutable_vars = {var for var, count in assign_counts.items() if count > 1}
+    return {var for var, count in assign_counts.items() if count > 1}
+
+
+def propagate_and_fold(instructions, mutable_vars, optimization_log, types=None):
+    types = types or {}
+    constant_propagation_map = {}
+    copy_propagation_map = {}
+
+    def substitute(operand, i):
+        # the constant or copied name operand is known to hold, if any
+        if operand in constant_propagation_map and operand not in mutable_vars:
+            new = constant_propagation_map[operand]
+            kind = "Constant"
+        elif operand in copy_propagation_map:
+            new = copy_propagation_map[operand]
+            kind = "Copy"
+        else:
+            return operand
+        optimization_log.append(
+            f"{kind} propagated: '{operand}' -> '{new}' in instruction {i+1}"
+        )
+        return new
+
     for i, instr in enumerate(instructions):
         if instr.is_removed:
             continue
         # Propagate constants or copies for operands before processing
-        if instr.type == "expression_assignment":
+        if instr.type == "array_load":
+            instr.index = substitute(instr.index, i)
+            # the element is not known, so the target holds a value of its own
+            constant_propagation_map.pop(instr.target, None)
+            copy_propagation_map.pop(instr.target, None)
+        elif instr.type in ("array_store", "bounds_check"):
+            instr.index = substitute(instr.index, i)
+            instr.op1 = substitute(instr.op1, i)
+        elif instr.type == "expression_assignment":
             if instr.op1 in constant_propagation_map and instr.op1 not in mutable_vars:
                 old = instr.op1
                 instr.op1 = constant_propagation_map[instr.op1]
@@ -161,7 +258,9 @@ def optimize_code(code_string):
                 and (is_numeric(instr.op2) or instr.op2 in ("True", "False"))
                 and instr.target not in mutable_vars
             ):
-                result = evaluate_expression(instr.op1, instr.operator, instr.op2)
+                result = evaluate_expression(
+                    instr.op1, instr.operator, instr.op2, types.get(instr.target)
+                )
                 if result is not None:
                     optimization_log.append(
                         f"Constant folded: '{instr.op1} {instr.operator} {instr.op2}' -> '{result}' in instruction {i+1}"
@@ -175,6 +274,13 @@ def optimize_code(code_string):
                         del copy_propagation_map[instr.target]
                     continue
         elif instr.type == "simple_assignment":
+            if tac_types.NUMBER.match(instr.op1):
+                converted = convert_constant(instr.op1, types.get(instr.target))
+                if converted is not None and converted != instr.op1:
+                    optimization_log.append(
+                        f"Constant converted: '{instr.op1}' -> '{converted}' for '{instr.target}' in instruction {i+1}"
+                    )
+                    instr.op1 = converted
             original_op1 = instr.op1
             # Only treat as constant if source is constant and target is not mutable
             if (
@@ -190,14 +296,26 @@ def optimize_code(code_string):
                 original_op1 in constant_propagation_map
                 and original_op1 not in mutable_vars
                 and instr.target not in mutable_vars
+                and convert_constant(
+                    constant_propagation_map[original_op1], types.get(instr.target)
+                )
+                is not None
             ):
-                instr.op1 = constant_propagation_map[original_op1]
+                instr.op1 = convert_constant(
+                    constant_propagation_map[original_op1], types.get(instr.target)
+                )
                 constant_propagation_map[instr.target] = instr.op1
                 optimization_log.append(
                     f"Constant propagated: '{original_op1}' -> '{instr.op1}' for '{instr.target}' in instruction {i+1}"
                 )
                 if instr.target in copy_propagation_map:
                     del copy_propagation_map[instr.target]
+            elif not same_type(instr.target, original_op1, types):
+                # a conversion: the target holds a value of its own
+                if instr.target in constant_propagation_map:
+                    del constant_propagation_map[instr.target]
+                if instr.target in copy_propagation_map:
+                    del copy_propagation_map[instr.target]
             elif (
                 original_op1 in copy_propagation_map
                 and instr.target not in mutable_vars
@@ -241,7 +359,7 @@ def optimize_code(code_string):
                     f"Copy propagated: '{orig_var}' -> '{instr.condition_var}' in instruction {i+1}"
                 )
         # Invalidate const/copy if assigned var is mutable or re-assigned non-constant
-        if instr.type in ("expression_assignment", "simple_assignment"):
+        if instr.type in ("expression_assignment", "simple_assignment", "array_load"):
             if instr.target in mutable_vars:
                 if instr.target in constant_propagation_map:
                     del constant_propagation_map[instr.target]
@@ -253,9 +371,68 @@ def optimize_code(code_string):
                     optimization_log.append(
                         f"Variable '{instr.target}' marked mutable; copy invalidated at instruction {i+1}"
                     )
-    optimized_code = "\n".join(
-        str(instr) for instr in instructions if not instr.is_removed
-    )
+
+
+def optimize_code(
+    code_string,
+    span=None,
+    window=DEFAULT_WINDOW,
+    lcm=True,
+    ranges=True,
+    bounds=True,
+    vector_width=0,
+    parallel=True,
+):
+    """
+    Run the optimization passes over TAC text.
+    span, if given, is called with each pass name and must return a context
+    manager; the driver uses it to record a trace span per pass.
+    window is the peephole pass's window in instructions; 0 skips the pass.
+    lcm=False skips partial redundancy elimination, ranges=False the
+    value range analysis and bounds=False bounds-check elimination. A
+    vector_width of 2 or more runs the element-wise loops that many
+    iterations at a time on vectors. parallel=False leaves loops whose
+    iterations are independent unmarked.
+    """
+    span = span or (lambda name: nullcontext())
+    optimization_log = []
+    with span("parse TAC"):
+        lines = [
+            line.strip() for line in code_string.strip().split("\n") if line.strip()
+        ]
+        instructions = [Instruction(line) for line in lines]
+        # the declarations are kept aside; every pass reads them
+        types = {
+            instr.target: instr.data_type
+            for instr in instructions
+            if instr.type == "declaration"
+        }
+        instructions = [instr for instr in instructions if instr.type != "declaration"]
+    with span("find mutable vars"):
+        mutable_vars = find_mutable_vars(instructions)
+    with span("constant/copy propagation"):
+        propagate_and_fold(instructions, mutable_vars, optimization_log, types)
+    code = [to_tuple(instr) for instr in instructions if not instr.is_removed]
+    if ranges:
+        with span("value ranges"):
+            code = value_ranges(code, optimization_log, types)
+    if lcm:
+        with span("lazy code motion"):
+            code = lazy_code_motion(code, optimization_log, types)
+    if window > 0:
+        with span("peephole"):
+            code = Peephole(window=window).run(code, optimization_log, types)
+    if bounds:
+        with span("bounds checks"):
+            code = eliminate_bounds_checks(code, optimization_log, types)
+    if vector_width > 1:
+        with span("vectorize"):
+            code = vectorize(code, vector_width, optimization_log, types)
+    if parallel:
+        with span("parallel loops"):
+            code = parallelize(code, optimization_log, types)
+    lines = tac_types.declarations(code, types) + [to_text(t) for t in code]
+    optimized_code = "\n".join(lines)
     return optimized_code, optimization_log
 
 
@@ -0,0 +1,310 @@
+import re
+
+import tac_types
+from cfg import CFG
+from peephole import reads, rename, to_text, writes
+
+# Partial redundancy elimination by lazy code motion (Knoop, Ruthing and
+# Steffen), in the four-pass form of the Dragon Book, 9.5: anticipated and
+# available expressions give the earliest safe places for each computation,
+# postponable expressions push them down to the latest ones, and used
+# expressions drop insertions nobody reads. Every instruction is a node, and
+# each edge into an instruction with several predecessors gets a node of its
+# own, so a computation can be added on one path into a join. Sets of
+# expressions are bit masks in Python ints.
+#
+# Motion is lexical: after n * a is hoisted out of a loop, the t2 = t1 - b
+# that read its old temporary still reads a name assigned in the loop. So a
+# round of motion is followed by forwarding such copies into their uses, and
+# rounds repeat until nothing moves, one level of a nested expression each.
+#
+# A new temporary holding a computation is declared with the computation's
+# type, which its operands decide; the copy that replaces the computation
+# converts to the destination's type as the computation's store did.
+
+TEMP = re.compile(r"^t(\d+)$")
+LABEL = re.compile(r"^L(\d+)$")
+
+
+def fresh(pattern, prefix, code):
+    """Names prefix1, prefix2... that do not clash with any in code."""
+    used = [
+        int(m.group(1))
+        for t in code
+        for field in t[1:]
+        if (m := pattern.match(field))
+    ]
+    n = max(used, default=0)
+    while True:
+        n += 1
+        yield f"{prefix}{n}"
+
+
+def lazy_code_motion(code, log=None, types=None):
+    """
+    Rewrite a list of (kind, fields...) tuples; returns the new list. The
+    temporaries it adds are declared in types.
+    """
+    types = {} if types is None else types
+    while True:
+        moved = motion(code, log, types)
+        if moved is code:
+            return code
+        code = forward_copies(moved, types)
+
+
+def forward_copies(code, types):
+    """
+    Drop each temporary that is assigned once, by a copy of a name of its
+    type, and read only later in the same basic block while the copied name is
+    unchanged, reading the copied name instead.
+    """
+    defs = {}
+    uses = {}
+    for i, t in enumerate(code):
+        for v in writes(t):
+            defs.setdefault(v, []).append(i)
+        for v in reads(t):
+            uses.setdefault(v, []).append(i)
+    cfg = CFG(code)
+    block_of = [0] * len(code)
+    for k, (start, end) in enumerate(cfg.blocks):
+        block_of[start:end] = [k] * (end - start)
+
+    source_of = {}
+    dropped = set()
+    for name, where in defs.items():
+        if not TEMP.match(name) or len(where) != 1 or name not in uses:
+            continue
+        i = where[0]
+        if code[i][0] != "copy":
+            continue
+        source = code[i][2]
+        if source in source_of:
+            continue
+        if tac_types.operand_type(source, types) != types.get(name, "int"):
+            continue
+        last = uses[name][-1]
+        if any(j <= i or block_of[j] != block_of[i] for j in uses[name]):
+            continue
+        if any(source in writes(code[j]) for j in range(i + 1, last)):
+            continue
+        source_of[name] = source
+        dropped.add(i)
+    if not source_of:
+        return code
+
+    def resolve(v):
+        while v in source_of:
+            v = source_of[v]
+        return v
+
+    out = []
+    for i, t in enumerate(code):
+        if i not in dropped:
+            out.append(rename(t, resolve))
+    return out
+
+
+def motion(code, log, types):
+    """One round of lazy code motion; returns code itself if nothing moved."""
+    exprs = {}
+    for t in code:
+        if t[0] == "binop":
+            exprs.setdefault((t[2], t[3], t[4]), len(exprs))
+    if not exprs:
+        return code
+    full = (1 << len(exprs)) - 1
+    # expressions that an assignment to each name kills
+    reading = {}
+    for (a, _, b), bit in exprs.items():
+        for v in (a, b):
+            reading[v] = reading.get(v, 0) | 1 << bit
+
+    cfg = CFG(code)
+    n = len(code)
+    succ = [list(s) for s in cfg.succ]
+    pred = [list(p) for p in cfg.pred]
+    exits = set(cfg.exits)
+    # edge nodes are n, n + 1, ...; None as the source is the program entry
+    edges = []
+    order = []
+    for v in range(n):
+        sources = pred[v] + ([None] if v == 0 else [])
+        if len(sources) > 1:
+            pred[v] = []
+            for u in sources:
+                e = n + len(edges)
+                edges.append((u, v))
+                succ.append([v])
+                pred.append([] if u is None else [u])
+                pred[v].append(e)
+                if u is not None:
+                    succ[u][succ[u].index(v)] = e
+                order.append(e)
+        order.append(v)
+    size = len(succ)
+
+    use = [0] * size
+    kill = [0] * size
+    for i, t in enumerate(code):
+        if t[0] == "binop":
+            use[i] = 1 << exprs[(t[2], t[3], t[4])]
+        for v in writes(t):
+            kill[i] |= reading.get(v, 0)
+
+    def meet_succ(values, b):
+        if b in exits or not succ[b]:
+            return 0
+        out = full
+        for s in succ[b]:
+            out &= values[s]
+        return out
+
+    def meet_pred(values, b):
+        if not pred[b]:
+            return 0
+        out = full
+        for p in pred[b]:
+            out &= values[p]
+        return out
+
+    def solve(values, nodes, transfer):
+        changed = True
+        while changed:
+            changed = False
+            for b in nodes:
+                new = transfer(b)
+                if new != values[b]:
+                    values[b] = new
+                    changed = True
+
+    backward = order[::-1]
+    anticipated = [full] * size
+    solve(
+        anticipated,
+        backward,
+        lambda b: use[b] | (meet_succ(anticipated, b) & ~kill[b]),
+    )
+    available = [full] * size
+    solve(
+        available,
+        order,
+        lambda b: (anticipated[b] | meet_pred(available, b)) & ~kill[b],
+    )
+    earliest = [anticipated[b] & ~meet_pred(available, b) for b in range(size)]
+    postponable = [full] * size
+    solve(
+        postponable,
+        order,
+        lambda b: (earliest[b] | meet_pred(postponable, b)) & ~use[b],
+    )
+    start = [earliest[b] | meet_pred(postponable, b) for b in range(size)]
+    latest = [
+        start[b] & (use[b] | ~meet_succ(start, b) & full) for b in range(size)
+    ]
+    used = [0] * size
+
+    def used_out(b):
+        # the exit uses nothing, so unlike the meets above it adds nothing
+        out = 0
+        for s in succ[b]:
+            out |= used[s]
+        return out
+
+    solve(used, backward, lambda b: (use[b] | used_out(b)) & ~latest[b])
+
+    # code no path reaches is left alone: around an unreachable loop every
+    # expression looks available
+    reached = set(cfg.reverse_postorder())
+    reached.update(n + k for k, (u, _) in enumerate(edges) if u is None or u in reached)
+    insert = [latest[b] & used_out(b) if b in reached else 0 for b in range(size)]
+    replace = [
+        use[i] & (~latest[i] | used_out(i)) if i in reached else 0 for i in range(n)
+    ]
+    if not any(insert) and not any(replace):
+        return code
+
+    by_bit = {bit: e for e, bit in exprs.items()}
+    temps = fresh(TEMP, "t", code)
+    inserted = 0
+    for mask in insert:
+        inserted |= mask
+    holder = {bit: next(temps) for bit in range(len(exprs)) if inserted >> bit & 1}
+    for bit, name in holder.items():
+        types[name] = tac_types.expression_type(*by_bit[bit], types)
+
+    def computations(mask, where):
+        out = []
+        bit = 0
+        while mask:
+            if mask & 1:
+                a, op, b = by_bit[bit]
+                out.append(("binop", holder[bit], a, op, b))
+                if log is not None:
+                    log.append(
+                        f"Partial redundancy: '{a} {op} {b}' computed into "
+                        f"'{holder[bit]}' {where}"
+                    )
+            mask >>= 1
+            bit += 1
+        return out
+
+    # insertions on each edge, by source and target instruction
+    on_edge = {}
+    for k, (u, v) in enumerate(edges):
+        if insert[n + k]:
+            where = f"on the edge into instruction {v + 1}"
+            on_edge[(u, v)] = computations(insert[n + k], where)
+
+    labels = fresh(LABEL, "L", code)
+    out = on_edge.get((None, 0), [])
+    trampolines = []
+    parked = None
+    for i, t in enumerate(code):
+        at_node = computations(insert[i], f"before instruction {i + 1}")
+        if t[0] == "label":
+            out.append(t)
+            out.extend(at_node)
+        else:
+            out.extend(at_node)
+            if replace[i]:
+                e = (t[2], t[3], t[4])
+                new = ("copy", t[1], holder[exprs[e]])
+                if log is not None:
+                    log.append(
+                        f"Partial redundancy: '{to_text(t)}' -> '{to_text(new)}' "
+                        f"in instruction {i + 1}"
+                    )
+                t = new
+            if t[0] == "goto":
+                out.extend(on_edge.get((i, cfg.labels[t[1]]), []))
+                out.append(t)
+            elif t[0] == "ifFalse":
+                target = cfg.labels[t[2]]
+                taken = on_edge.get((i, target), [])
+                if taken and target == i + 1:
+                    # both ways lead to the next instruction
+                    out.extend(taken)
+                    out.append(t)
+                elif taken:
+                    label = next(labels)
+                    trampolines += [("label", label)] + taken + [("goto", t[2])]
+                    out.append(("ifFalse", t[1], label))
+                else:
+                    out.append(t)
+            else:
+                out.append(t)
+        if i + 1 < n and cfg.falls_through(i):
+            if not (t[0] == "ifFalse" and cfg.labels[t[2]] == i + 1):
+                out.extend(on_edge.get((i, i + 1), []))
+        if t[0] == "goto" and parked is None:
+            parked = len(out)
+    if trampolines:
+        # after an unconditional jump nothing falls into them
+        if parked is not None:
+            out[parked:parked] = trampolines
+        else:
+            end = next(labels)
+            out += [("goto", end)] + trampolines + [("label", end)]
+    return out
@@ -9,6 +9,8 @@ SCRIPT_DIR = os.path.dirname(__file__)
 ICG_PATH = os.path.join(SCRIPT_DIR, "..", "3. ICG", "icg_output.txt")
 OPTIMIZED_PATH = os.path.join(SCRIPT_DIR, "optimized_code.txt")
 LOG_PATH = os.path.join(SCRIPT_DIR, "optimization_log.txt")
+# how often to look for files rewritten by driver.py --watch
+REFRESH_MS = 500
 
 
 class OptimizerGUI:
@@ -24,6 +26,11 @@ class OptimizerGUI:
         self.create_widgets()
         self.load_input_code()
 
+        self.mtimes = {
+            path: self.mtime(path) for path in (ICG_PATH, OPTIMIZED_PATH, LOG_PATH)
+        }
+        self.root.after(REFRESH_MS, self.refresh_from_files)
+
     def setup_style(self):
         """Configure styles for light/dark mode"""
         self.style = ttk.Style()
@@ -174,6 +181,35 @@ class OptimizerGUI:
         except Exception as e:
             messagebox.showerror("Error", f"Failed to load input file:\n{e}")
 
+    @staticmethod
+    def mtime(path):
+        try:
+            return os.path.getmtime(path)
+        except OSError:
+            return None
+
+    def refresh_from_files(self):
+        """Reload the ICG input and optimizer output when something rewrites them."""
+        widgets = {
+            ICG_PATH: self.input_text,
+            OPTIMIZED_PATH: self.optimized_tab,
+            LOG_PATH: self.log_tab,
+        }
+        for path, widget in widgets.items():
+            mtime = self.mtime(path)
+            if mtime is None or mtime == self.mtimes[path]:
+                continue
+            self.mtimes[path] = mtime
+            try:
+                with open(path, "r") as f:
+                    content = f.read()
+            except OSError:
+                continue
+            widget.delete("1.0", tk.END)
+            widget.insert("1.0", content)
+            self.status_bar.config(text=f"Reloaded: {os.path.basename(path)}")
+        self.root.after(REFRESH_MS, self.refresh_from_files)
+
     def run_optimization_in_thread(self):
         threading.Thread(target=self.run_optimization).start()
 
@@ -0,0 +1,205 @@
+import tac_types
+from lcm import TEMP
+from peephole import reads, to_text, writes
+from vectorize import counted_loop
+
+# Parallel loops. A counted loop (vectorize.py) whose iterations do not
+# depend on each other gets a marker in front of its header,
+#
+#     parallel L1 private(i, t4, t5) lastprivate(x) reduction(+: s)
+#
+# that the C backend turns into an OpenMP parallel for; the VM skips it. The
+# dependence test is conservative:
+#
+#   - arrays: an array the body stores to is loaded and stored only at index
+#     i, so iteration k touches only its own element of it (its own lanes, in
+#     a vector loop, whose counter steps by the width). Arrays the body only
+#     loads are read by every iteration alike.
+#   - scalars: a name the body assigns is either
+#       - a reduction, an int updated once by s = s + e or s = s * e (or
+#         through a temporary, t = s + e; s = t) and read nowhere else in the
+#         body but by copies nothing reads. Wrapping int + and * are
+#         associative and commutative, so the partial results of the threads
+#         combine to the sequential value; float ones are left alone, as
+#         reordering them changes the rounding.
+#       - or private, assigned on every path through the body before anything
+#         there reads it, so no value flows from one iteration into the next.
+#         A temporary nothing outside the loop reads needs no value after it;
+#         any other name must be assigned on every path to the step, and is
+#         lastprivate: it ends with the value of the last iteration.
+#     The counter is private too; the backend works out its value on exit.
+#   - control: jumps in the body go to labels in the body, and nothing outside
+#     the loop jumps into it.
+#
+# Only the outermost of nested parallel loops is marked.
+
+OPERATORS = ("+", "*")
+JUMPS = ("goto", "ifFalse")
+
+
+def parallelize(code, log=None, types=None):
+    """Rewrite a list of (kind, fields...) tuples; returns the new list."""
+    types = types or {}
+    code = [t for t in code if t[0] != "parallel"]
+    markers = {}
+    inside = -1
+    for h, t in enumerate(code):
+        if h <= inside:
+            continue
+        loop = counted_loop(code, h, types)
+        if loop is None:
+            continue
+        marker = independent(code, loop, types)
+        if marker is None:
+            continue
+        markers[h] = marker
+        inside = loop.start + len(loop.body)
+        if log is not None:
+            log.append(
+                f"Parallel: iterations of the loop at '{t[1]}:' are independent, "
+                f"marked '{to_text(marker)}' before instruction {h + 1}"
+            )
+
+    out = []
+    for h, t in enumerate(code):
+        if h in markers:
+            out.append(markers[h])
+        out.append(t)
+    return out
+
+
+def independent(code, loop, types):
+    """The marker for loop, or None if its iterations may depend on each
+    other."""
+    i, body = loop.index, loop.body
+    kinds = ("load", "store", "binop", "copy", "check", "label") + JUMPS
+    if any(u[0] not in kinds for u in body):
+        return None
+    labels = {u[1] for u in body if u[0] == "label"}
+    if any(u[0] in JUMPS and u[-1] not in labels for u in body):
+        return None
+    end = loop.start + len(body)
+    while code[end] != ("goto", loop.header):
+        end += 1
+    outside = code[: loop.start - 3] + code[end + 1 :]
+    if any(u[0] in JUMPS and u[-1] in labels for u in outside):
+        return None
+
+    stored = {u[1] for u in body if u[0] == "store"}
+    for u in body:
+        if u[0] == "store":
+            index, value = u[2], u[3]
+        elif u[0] == "load" and u[2] in stored:
+            index, value = u[3], u[1]
+        else:
+            continue
+        # a vector moves its lanes from i on, which must not reach i + step
+        lanes = tac_types.vector_width(types.get(value)) or 1
+        if index != i or lanes > loop.step:
+            return None
+
+    # in the order the body assigns them
+    assigned = [v for u in body if u[0] != "store" for v in writes(u)]
+    assigned = list(dict.fromkeys(assigned))
+    # the loop's own names besides the body's: its test and step
+    control = loop.written - set(assigned) - stored - {i}
+    if any(v in control for u in body for v in reads(u)):
+        return None
+    read_outside = {v for u in outside for v in reads(u)}
+    if any(v in read_outside for v in control if v != code[loop.start - 2][1]):
+        return None
+
+    # temporaries nothing reads, such as the value the ICG gives an if
+    unread = {v for v in assigned if TEMP.match(v)} - {
+        v for u in code for v in reads(u)
+    }
+    reductions = []
+    for s in assigned:
+        op = reduction(body, s, types, unread)
+        if op is not None:
+            reductions.append((op, s))
+    reduced = {s for _, s in reductions}
+
+    before, at_end = definitions(body)
+    private, last = [i], []
+    for v in [v for v in assigned if v not in reduced]:
+        if any(v in reads(u) and v not in before[k] for k, u in enumerate(body)):
+            return None
+        if TEMP.match(v) and v not in read_outside:
+            private.append(v)
+        elif v in at_end:
+            last.append(v)
+        else:
+            return None
+    return ("parallel", loop.header, tuple(private), tuple(last), tuple(reductions))
+
+
+def reduction(body, s, types, unread):
+    """The operator of s's reduction in body, or None if s is not one. A
+    copy of s into one of the unread temporaries does not count as a use."""
+    if types.get(s, "int") != "int":
+        return None
+    updates = [k for k, u in enumerate(body) if s in writes(u)]
+    uses = [
+        k
+        for k, u in enumerate(body)
+        if s in reads(u) and not (u[0] == "copy" and u[1] in unread)
+    ]
+    if len(updates) != 1 or len(uses) != 1:
+        return None
+    k = updates[0]
+    u = body[k]
+    if u[0] == "binop" and uses == [k]:
+        # s = s op e
+        return operator(u, s)
+    if u[0] != "copy" or not TEMP.match(u[2]):
+        return None
+    # t = s op e; s = t, with t read only by the copy
+    t = u[2]
+    defs = [j for j, w in enumerate(body) if t in writes(w)]
+    reads_t = [j for j, w in enumerate(body) if t in reads(w)]
+    if len(defs) != 1 or reads_t != [k] or uses != defs or defs[0] > k:
+        return None
+    if any(w[0] in ("label",) + JUMPS for w in body[defs[0] : k]):
+        return None
+    return operator(body[defs[0]], s)
+
+
+def operator(u, s):
+    if u[0] != "binop" or u[3] not in OPERATORS:
+        return None
+    operands = (u[2], u[4])
+    if operands.count(s) != 1:
+        return None
+    return u[3]
+
+
+def definitions(body):
+    """The names assigned on every path through body to each instruction,
+    and to its end."""
+    labels = {u[1]: k for k, u in enumerate(body) if u[0] == "label"}
+    n = len(body)
+
+    def successors(k):
+        u = body[k]
+        if u[0] == "goto":
+            return [labels[u[1]]]
+        following = [k + 1]
+        if u[0] == "ifFalse":
+            following.append(labels[u[2]])
+        return following
+
+    everything = {v for u in body for v in writes(u)}
+    before = [set(everything) for _ in range(n + 1)]
+    before[0] = set()
+    changed = True
+    while changed:
+        changed = False
+        for k in range(n):
+            out = before[k] | set(writes(body[k]))
+            for j in successors(k):
+                # j == n is the end of the body, the step
+                if j != 0 and not before[j] <= out:
+                    before[j] &= out
+                    changed = True
+    return before[:n], before[n]
@@ -0,0 +1,337 @@
+import re
+from collections import Counter
+
+# Peephole pass over TAC, driven by the RULES table below. Each rule is a
+# short run of instruction templates, a replacement that is shorter, and an
+# optional guard. The patterns are compiled into a trie over instruction
+# kinds, walked backwards from the newest instruction: the engine pushes
+# instructions onto an output stack one at a time, matches rules that end at
+# the top, and pushes a replacement back onto the input so it meets its left
+# context again. Every rewrite removes an instruction, so a pass does at most
+# n rewrites and O(n * window) work.
+
+DEFAULT_WINDOW = 3
+
+TEMP = re.compile(r"^t\d+$")
+
+# name, pattern, replacement, guard. {x} is a variable: the same name binds
+# the same operand everywhere in a rule, and a template that is only {x}
+# matches any one instruction. A copy between names of different types
+# converts the value, so the copy rules need both sides of one type.
+RULES = [
+    (
+        "fold copy into expression",
+        ["{t} = {a} {op} {b}", "{x} = {t}"],
+        ["{x} = {a} {op} {b}"],
+        "single_use(t)",
+    ),
+    (
+        "fold copy into load",
+        ["{t} = {a}[{i}]", "{x} = {t}"],
+        ["{x} = {a}[{i}]"],
+        "single_use_as(t, x)",
+    ),
+    (
+        "fold copy into copy",
+        ["{t} = {a}", "{x} = {t}"],
+        ["{x} = {a}"],
+        "single_use_as(t, x)",
+    ),
+    ("self copy", ["{x} = {x}"], [], None),
+    ("redundant store", ["{x} = {y}", "{y} = {x}"], ["{x} = {y}"], "same_type(x, y)"),
+    ("overwritten store", ["{x} = {a}", "{x} = {b}"], ["{x} = {b}"], "differ(b, x)"),
+    ("jump to next", ["goto {L}", "{L}:"], ["{L}:"], None),
+    ("branch to next", ["ifFalse {c} goto {L}", "{L}:"], ["{L}:"], None),
+    ("jump over label", ["goto {L}", "{M}:", "{L}:"], ["{M}:", "{L}:"], None),
+    ("unreachable after jump", ["goto {L}", "{i}"], ["goto {L}"], "not_label(i)"),
+]
+
+# template syntax per kind; fields are in the order of the groups
+TEMPLATES = [
+    ("label", re.compile(r"^\{(\w+)\}:$")),
+    ("ifFalse", re.compile(r"^ifFalse \{(\w+)\} goto \{(\w+)\}$")),
+    ("goto", re.compile(r"^goto \{(\w+)\}$")),
+    ("binop", re.compile(r"^\{(\w+)\} = \{(\w+)\} \{(\w+)\} \{(\w+)\}$")),
+    ("load", re.compile(r"^\{(\w+)\} = \{(\w+)\}\[\{(\w+)\}\]$")),
+    ("store", re.compile(r"^\{(\w+)\}\[\{(\w+)\}\] = \{(\w+)\}$")),
+    ("copy", re.compile(r"^\{(\w+)\} = \{(\w+)\}$")),
+    ("any", re.compile(r"^\{(\w+)\}$")),
+]
+
+KINDS = {
+    "label": "label",
+    "ifFalse": "ifFalse",
+    "goto": "goto",
+    "expression_assignment": "binop",
+    "simple_assignment": "copy",
+    "array_load": "load",
+    "array_store": "store",
+    "bounds_check": "check",
+    "parallel": "parallel",
+}
+
+
+def to_tuple(instr):
+    """code_optimizer.Instruction as (kind, fields...)."""
+    kind = KINDS[instr.type]
+    if kind == "label":
+        return (kind, instr.label)
+    if kind == "ifFalse":
+        return (kind, instr.condition_var, instr.jump_target)
+    if kind == "goto":
+        return (kind, instr.jump_target)
+    if kind == "binop":
+        return (kind, instr.target, instr.op1, instr.operator, instr.op2)
+    if kind == "load":
+        return (kind, instr.target, instr.array, instr.index)
+    if kind in ("store", "check"):
+        return (kind, instr.array, instr.index, instr.op1)
+    if kind == "parallel":
+        return (kind, instr.label) + instr.clauses
+    return (kind, instr.target, instr.op1)
+
+
+def to_text(t):
+    kind = t[0]
+    if kind == "label":
+        return f"{t[1]}:"
+    if kind == "ifFalse":
+        return f"ifFalse {t[1]} goto {t[2]}"
+    if kind == "goto":
+        return f"goto {t[1]}"
+    if kind == "binop":
+        return f"{t[1]} = {t[2]} {t[3]} {t[4]}"
+    if kind == "load":
+        return f"{t[1]} = {t[2]}[{t[3]}]"
+    if kind == "store":
+        return f"{t[1]}[{t[2]}] = {t[3]}"
+    if kind == "check" and t[2] == t[3]:
+        return f"check {t[1]}[{t[2]}]"
+    if kind == "check":
+        return f"check {t[1]}[{t[2]}..{t[3]}]"
+    if kind == "parallel":
+        return parallel_text(t)
+    return f"{t[1]} = {t[2]}"
+
+
+def parallel_text(t):
+    """A parallel marker (parallel.py), as in
+    'parallel L1 private(i, t2) lastprivate(x) reduction(+: s)'."""
+    _, label, private, last, reductions = t
+    clauses = [f"private({', '.join(private)})"] if private else []
+    if last:
+        clauses.append(f"lastprivate({', '.join(last)})")
+    for op in dict.fromkeys(op for op, _ in reductions):
+        names = ", ".join(name for o, name in reductions if o == op)
+        clauses.append(f"reduction({op}: {names})")
+    return " ".join(["parallel", label] + clauses)
+
+
+def reads(t):
+    """Operands an instruction reads. A load reads its array and a store
+    writes it, as a whole; a check reads only the indices."""
+    if t[0] == "binop":
+        return (t[2], t[4])
+    if t[0] == "copy":
+        return (t[2],)
+    if t[0] == "ifFalse":
+        return (t[1],)
+    if t[0] == "load":
+        return (t[2], t[3])
+    if t[0] in ("store", "check"):
+        return (t[2], t[3])
+    return ()
+
+
+def writes(t):
+    if t[0] == "store":
+        return (t[1],)
+    return (t[1],) if t[0] in ("binop", "copy", "load") else ()
+
+
+def rename(t, f):
+    """t reading f(v) for each scalar operand v it reads."""
+    if t[0] == "binop":
+        return (t[0], t[1], f(t[2]), t[3], f(t[4]))
+    if t[0] == "copy":
+        return (t[0], t[1], f(t[2]))
+    if t[0] == "ifFalse":
+        return (t[0], f(t[1]), t[2])
+    if t[0] == "load":
+        return (t[0], t[1], t[2], f(t[3]))
+    if t[0] in ("store", "check"):
+        return (t[0], t[1], f(t[2]), f(t[3]))
+    return t
+
+
+def parse_template(text):
+    for kind, pattern in TEMPLATES:
+        m = pattern.match(text)
+        if m:
+            return (kind,) + m.groups()
+    raise ValueError(f"bad peephole template: {text}")
+
+
+class Rule:
+    def __init__(self, index, name, pattern, replacement, guard):
+        self.index = index
+        self.name = name
+        self.pattern = [parse_template(p) for p in pattern]
+        self.replacement = [parse_template(r) for r in replacement]
+        if len(self.replacement) >= len(self.pattern):
+            raise ValueError(f"peephole rule '{name}' does not shrink the code")
+        # where each variable is first bound, and the other places that must
+        # hold the same operand; field None is the whole instruction
+        self.first = {}
+        self.same = []
+        for i, template in enumerate(self.pattern):
+            if template[0] == "any":
+                places = [(template[1], None)]
+            else:
+                places = [(var, f) for f, var in enumerate(template[1:], 1)]
+            for var, f in places:
+                if var in self.first:
+                    self.same.append((self.first[var], (i, f)))
+                else:
+                    self.first[var] = (i, f)
+        self.guard = None
+        if guard:
+            check, args = re.match(r"^(\w+)\((.*)\)$", guard).groups()
+            self.guard = (check, [a.strip() for a in args.split(",")])
+
+    def bind(self, window):
+        """Variable bindings if window (oldest first) fits the pattern, else None."""
+
+        def at(place):
+            i, f = place
+            return window[i] if f is None else window[i][f]
+
+        for a, b in self.same:
+            if at(a) != at(b):
+                return None
+        return {var: at(place) for var, place in self.first.items()}
+
+    def rewrite(self, env):
+        out = []
+        for template in self.replacement:
+            if template[0] == "any":
+                out.append(env[template[1]])
+            else:
+                out.append((template[0],) + tuple(env[v] for v in template[1:]))
+        return out
+
+
+class Node:
+    __slots__ = ("children", "any", "rules")
+
+    def __init__(self):
+        self.children = {}
+        self.any = None
+        self.rules = []
+
+
+class Peephole:
+    """The rule table compiled into a trie over kinds, last instruction first."""
+
+    def __init__(self, rules=RULES, window=DEFAULT_WINDOW):
+        self.window = window
+        self.root = Node()
+        for index, rule in enumerate(rules):
+            rule = Rule(index, *rule)
+            if len(rule.pattern) > window:
+                continue
+            node = self.root
+            for template in reversed(rule.pattern):
+                if template[0] == "any":
+                    node.any = node.any or Node()
+                    node = node.any
+                else:
+                    node = node.children.setdefault(template[0], Node())
+            node.rules.append(rule)
+
+    def _match(self, out, guards):
+        """The rule to apply to a suffix of out and its bindings, or None.
+        Shorter patterns win, then earlier rules."""
+        nodes = [self.root]
+        for depth in range(1, min(self.window, len(out)) + 1):
+            kind = out[-depth][0]
+            deeper = []
+            for node in nodes:
+                child = node.children.get(kind)
+                if child is not None:
+                    deeper.append(child)
+                if node.any is not None:
+                    deeper.append(node.any)
+            if not deeper:
+                return None
+            nodes = deeper
+            rules = nodes[0].rules
+            if len(nodes) > 1:
+                rules = sorted((r for n in nodes for r in n.rules), key=lambda r: r.index)
+            for rule in rules:
+                env = rule.bind(out[-depth:])
+                if env is not None and guards.check(rule, env):
+                    return rule, env
+        return None
+
+    def run(self, code, log=None, types=None):
+        """Rewrite a list of (kind, fields...) tuples; returns the new list.
+        types maps names to their declared types."""
+        guards = Guards(code, types)
+        out = []
+        todo = code[::-1]
+        while todo:
+            out.append(todo.pop())
+            found = self._match(out, guards)
+            if found is None:
+                continue
+            rule, env = found
+            n = len(rule.pattern)
+            old = out[-n:]
+            del out[-n:]
+            new = rule.rewrite(env)
+            guards.replace(old, new)
+            todo.extend(reversed(new))
+            if log is not None:
+                before = ", ".join(f"'{to_text(t)}'" for t in old)
+                after = ", ".join(f"'{to_text(t)}'" for t in new) or "nothing"
+                log.append(f"Peephole {rule.name}: {before} -> {after}")
+        return out
+
+
+class Guards:
+    """Rule guards, with def and use counts of every name kept current."""
+
+    def __init__(self, code, types=None):
+        self.uses = Counter(v for t in code for v in reads(t))
+        self.defs = Counter(v for t in code for v in writes(t))
+        self.types = types or {}
+
+    def replace(self, old, new):
+        for t, step in [(t, -1) for t in old] + [(t, 1) for t in new]:
+            for v in reads(t):
+                self.uses[v] += step
+            for v in writes(t):
+                self.defs[v] += step
+
+    def check(self, rule, env):
+        if rule.guard is None:
+            return True
+        name, args = rule.guard
+        return getattr(self, name)(*(env[a] for a in args))
+
+    def single_use(self, t):
+        # a temporary defined once and read only by the copy being folded
+        return bool(TEMP.match(t)) and self.uses[t] == 1 and self.defs[t] == 1
+
+    def single_use_as(self, t, x):
+        return self.single_use(t) and self.same_type(t, x)
+
+    def same_type(self, a, b):
+        return self.types.get(a) == self.types.get(b)
+
+    def differ(self, a, b):
+        return a != b
+
+    def not_label(self, instr):
+        return instr[0] != "label"
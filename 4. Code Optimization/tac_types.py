@@ -0,0 +1,172 @@
+import math
+import re
+import struct
+
+from peephole import reads, writes
+
+# Types of TAC names and the C semantics of operating on them. The ICG
+# declares every name ("int x"); literals are floats if they have a point and
+# ints otherwise. An operation takes its type from its operands, as in C: int
+# unless one is a float, with chars promoted to int, and comparisons are ints.
+# A store converts the value to the type of the name it writes. A float is
+# C's single precision float: operations on one are rounded to it.
+#
+# An array is declared with its size ("int a[100]") and its type is written
+# "int[100]"; loads and stores move its elements, of the type before the
+# brackets. A vector ("float<8> t9", from vectorize.py) holds that many lanes
+# of its element type and an operation on one works lane by lane, with a
+# scalar operand standing for a vector of copies of it. A Python vector value
+# is a tuple of lane values.
+
+TYPES = ("int", "float", "char")
+DECLARATION = re.compile(r"^(int|float|char)(<\d+>)? (\w+)(\[\d+\])?$")
+ARRAY = re.compile(r"^(int|float|char)\[(\d+)\]$")
+VECTOR = re.compile(r"^(int|float)<(\d+)>$")
+NAME = re.compile(r"^[A-Za-z_]\w*$")
+NUMBER = re.compile(r"^-?\d+(\.\d+)?$")
+
+# value range of the integer types; int arithmetic wraps like the hardware's
+BITS = {"int": 32, "char": 8}
+COMPARISONS = ("<=", ">")
+
+
+def scalar(type_name):
+    """The type of one element of an array or lane of a vector, else type_name."""
+    m = type_name and (ARRAY.match(type_name) or VECTOR.match(type_name))
+    return m.group(1) if m else type_name
+
+
+def array_size(type_name):
+    m = type_name and ARRAY.match(type_name)
+    return int(m.group(2)) if m else None
+
+
+def vector_width(type_name):
+    m = type_name and VECTOR.match(type_name)
+    return int(m.group(2)) if m else None
+
+
+def declared_type(match):
+    """The type a DECLARATION match declares its name with."""
+    return match.group(1) + (match.group(2) or "") + (match.group(4) or "")
+
+
+def declaration(name, type_name):
+    size = array_size(type_name)
+    if size is not None:
+        return f"{scalar(type_name)} {name}[{size}]"
+    return f"{type_name} {name}"
+
+
+def operand_type(operand, types):
+    if NUMBER.match(operand):
+        return "float" if "." in operand else "int"
+    if operand in ("True", "False"):
+        return "int"
+    return types.get(operand, "int")
+
+
+def expression_type(a, op, b, types):
+    if op in COMPARISONS:
+        return "int"
+    operands = (operand_type(a, types), operand_type(b, types))
+    result = "float" if "float" in map(scalar, operands) else "int"
+    width = max(vector_width(t) or 0 for t in operands)
+    return f"{result}<{width}>" if width else result
+
+
+def value_of(operand):
+    """The value of a literal operand, or None for a name."""
+    if NUMBER.match(operand):
+        return float(operand) if "." in operand else int(operand)
+    if operand in ("True", "False"):
+        return operand == "True"
+    return None
+
+
+def wrap(n, bits):
+    n &= (1 << bits) - 1
+    return n - (1 << bits) if n >> (bits - 1) else n
+
+
+def single(x):
+    """x rounded to the nearest single precision float."""
+    try:
+        return struct.unpack("f", struct.pack("f", x))[0]
+    except OverflowError:
+        return math.copysign(math.inf, x)
+
+
+def lanes(value, width):
+    return value if isinstance(value, tuple) else (value,) * width
+
+
+def convert(value, type_name):
+    """value stored in a name of type_name (None: undeclared, unchanged)."""
+    width = vector_width(type_name)
+    if width:
+        out = tuple(convert(v, scalar(type_name)) for v in lanes(value, width))
+        return None if None in out else out
+    if type_name == "float":
+        value = single(float(value))
+        return value if math.isfinite(value) else None
+    if type_name in BITS:
+        if isinstance(value, float):
+            if not math.isfinite(value):
+                return None
+            value = math.trunc(value)
+        return wrap(int(value), BITS[type_name])
+    return value
+
+
+def evaluate(a, op, b):
+    """a op b on Python values, with C's integer division; None if undefined."""
+    if isinstance(a, tuple) or isinstance(b, tuple):
+        width = len(a) if isinstance(a, tuple) else len(b)
+        pairs = zip(lanes(a, width), lanes(b, width))
+        out = tuple(evaluate(x, op, y) for x, y in pairs)
+        return None if None in out else out
+    if isinstance(a, float) or isinstance(b, float):
+        # in single precision: the operands are converted to it, and one
+        # operation on them done in double and rounded to single is what
+        # single precision gives, a double having over twice the bits
+        a, b = single(a), single(b)
+    if op in COMPARISONS:
+        return a <= b if op == "<=" else a > b
+    if op == "+":
+        result = a + b
+    elif op == "-":
+        result = a - b
+    elif op == "*":
+        result = a * b
+    elif op == "/":
+        if b == 0:
+            return None
+        if isinstance(a, float) or isinstance(b, float):
+            result = a / b
+        else:
+            # truncated towards zero
+            q = abs(a) // abs(b)
+            result = q if (a < 0) == (b < 0) else -q
+    else:
+        return None
+    if isinstance(result, float):
+        result = single(result)
+        return result if math.isfinite(result) else None
+    return wrap(result, BITS["int"])
+
+
+def literal(value):
+    """TAC text for a value, or None if the TAC cannot spell it."""
+    if isinstance(value, bool):
+        return str(value)
+    if isinstance(value, int):
+        return str(value)
+    text = repr(value)
+    return text if NUMBER.match(text) else None
+
+
+def declarations(code, types):
+    """'type name' lines for the names code mentions, in the order of types."""
+    used = {v for t in code for v in reads(t) + writes(t)}
+    return [declaration(v, types[v]) for v in types if v in used]
@@ -0,0 +1,136 @@
+import sys
+from collections import Counter
+
+import tac_types
+from code_optimizer import Instruction
+from peephole import to_tuple
+
+# Interpreter for TAC, to check that optimized code computes what the ICG
+# output does and to count the instructions each executes, by kind. Labels
+# and parallel markers are not counted; every other instruction is one step. Arithmetic follows
+# the declared types (tac_types.py): ints divide with truncation and wrap,
+# and a store converts to the type of its destination. Every declared array
+# is a zeroed list from the start, used or not, and an index outside it stops
+# the program, at a check or at the access itself. A vector instruction is one step that
+# operates on all its lanes as a batch: a load or store of a vector moves
+# that many elements from the index on.
+
+MAX_STEPS = 10_000_000
+
+
+class VMError(Exception):
+    pass
+
+
+def parse(text):
+    """TAC text as a list of (kind, fields...) tuples, and the declared type
+    of each name."""
+    code = []
+    types = {}
+    for line in text.split("\n"):
+        if not line.strip():
+            continue
+        instr = Instruction(line)
+        if instr.type == "declaration":
+            types[instr.target] = instr.data_type
+        else:
+            code.append(to_tuple(instr))
+    return code, types
+
+
+def run(code, max_steps=MAX_STEPS, types=None):
+    """Execute code; returns the final variables and a Counter of the
+    instructions executed by kind."""
+    types = types or {}
+    labels = {t[1]: i for i, t in enumerate(code) if t[0] == "label"}
+    env = {}
+    for name, type_name in types.items():
+        size = tac_types.array_size(type_name)
+        if size is not None:
+            env[name] = [tac_types.convert(0, tac_types.scalar(type_name))] * size
+
+    def value(operand):
+        known = tac_types.value_of(operand)
+        if known is not None:
+            return known
+        return env.get(operand, tac_types.convert(0, types.get(operand)))
+
+    def store(name, v):
+        v = tac_types.convert(v, types.get(name))
+        if v is None:
+            raise VMError(f"'{name}' cannot hold the value")
+        env[name] = v
+
+    def elements(name, index, n):
+        """The array name and the slice of n elements at index in it."""
+        size = tac_types.array_size(types.get(name))
+        if size is None:
+            raise VMError(f"'{name}' is not an array")
+        if isinstance(index, float) or not 0 <= index <= size - n:
+            raise VMError(f"'{name}[{index}]' is outside the array")
+        return env[name], slice(index, index + n)
+
+    counts = Counter()
+    steps = 0
+    pc = 0
+    while pc < len(code):
+        t = code[pc]
+        pc += 1
+        kind = t[0]
+        if kind in ("label", "parallel"):
+            continue
+        steps += 1
+        if steps > max_steps:
+            raise VMError(f"no exit after {max_steps} steps")
+        counts[kind] += 1
+        if kind == "copy":
+            store(t[1], value(t[2]))
+        elif kind == "binop":
+            v = tac_types.evaluate(value(t[2]), t[3], value(t[4]))
+            if v is None:
+                raise VMError(f"undefined result in '{t[1]} = {t[2]} {t[3]} {t[4]}'")
+            store(t[1], v)
+        elif kind == "load":
+            width = tac_types.vector_width(types.get(t[1]))
+            array, at = elements(t[2], value(t[3]), width or 1)
+            store(t[1], tuple(array[at]) if width else array[at.start])
+        elif kind == "store":
+            v = value(t[3])
+            width = len(v) if isinstance(v, tuple) else None
+            array, at = elements(t[1], value(t[2]), width or 1)
+            element = tac_types.scalar(types[t[1]])
+            values = tac_types.lanes(v, width or 1)
+            lanes = [tac_types.convert(x, element) for x in values]
+            if None in lanes:
+                raise VMError(f"'{t[1]}' cannot hold the value")
+            array[at] = lanes
+        elif kind == "check":
+            first, last = value(t[2]), value(t[3])
+            if first <= last:
+                # the first and last index are in the array, so all between are
+                elements(t[1], first, 1)
+                elements(t[1], last, 1)
+        elif kind == "goto":
+            pc = labels[t[1]]
+        elif kind == "ifFalse":
+            if not value(t[1]):
+                pc = labels[t[2]]
+    return env, counts
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("usage: tac_vm.py FILE", file=sys.stderr)
+        return 2
+    with open(sys.argv[1], "r") as f:
+        code, types = parse(f.read())
+    env, counts = run(code, types=types)
+    for name, v in sorted(env.items()):
+        print(f"{name} = {v}")
+    executed = sum(counts.values())
+    print(f"{executed} instructions executed, {counts['binop']} operations")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,251 @@
+import tac_types
+from lcm import LABEL, TEMP, fresh
+from peephole import reads, writes
+
+# Loop vectorization. A loop of the form the ICG gives a for loop
+#
+#     L1:
+#     t1 = i <= n
+#     ifFalse t1 goto L2
+#     ...                  straight-line body
+#     i = i + 1
+#     goto L1
+#     L2:
+#
+# whose body only does the same arithmetic to element i of some arrays gets a
+# copy in front of it that runs width iterations at a time on vectors, while
+# i + width - 1 <= n; the loop itself stays behind it for the iterations
+# left over. A bounds check still in the body (see bce.py) keeps the loop
+# scalar. "Element-wise" is checked conservatively:
+#
+#   - every load and store is at index i, and i is read nowhere else, so
+#     iteration k touches only element k of each array and running
+#     iterations side by side cannot change what any of them reads;
+#   - every name the body assigns is a temporary assigned once there, read
+#     only after that in the body and nowhere outside it, so nothing flows
+#     from one iteration into the next or out of the loop;
+#   - anything else the body reads is a literal or a name the loop does not
+#     assign, which a vector operation uses in every lane;
+#   - the arrays and temporaries all have one type, int or float, and the
+#     operations are + - * (and / for floats), which the native backend has
+#     vector instructions for.
+#
+# The vector code is ordinary TAC on names declared with a vector type
+# (tac_types.py), so t9 = t7 + t8 adds all lanes and t5 = x[i] loads width
+# elements from i on.
+
+ELEMENTS = ("int", "float")
+OPERATORS = {"int": ("+", "-", "*"), "float": ("+", "-", "*", "/")}
+INT_MIN = -(2**31)
+
+
+def vectorize(code, width, log=None, types=None):
+    """
+    Rewrite a list of (kind, fields...) tuples; returns the new list. The
+    names it adds are declared in types.
+    """
+    types = {} if types is None else types
+    if width < 2:
+        return code
+    temps = fresh(TEMP, "t", code)
+    labels = fresh(LABEL, "L", code)
+    out = []
+    for h, t in enumerate(code):
+        loop = counted_loop(code, h, types)
+        if loop is not None and (
+            loop.step != 1
+            or any(u[0] not in ("load", "store", "binop", "copy") for u in loop.body)
+        ):
+            loop = None
+        if loop is not None:
+            vector = rewrite(loop, width, temps, labels, types)
+            if vector is not None:
+                out += vector
+                if log is not None:
+                    log.append(
+                        f"Vectorized: loop at '{t[1]}:' runs {width} iterations "
+                        f"at a time in instruction {h + 1}"
+                    )
+        out.append(t)
+    return out
+
+
+class Loop:
+    def __init__(self, header, index, bound, step, start, body, outside, written):
+        self.header = header
+        self.index = index
+        self.bound = bound
+        # what the step adds to the counter, 1 or more
+        self.step = step
+        # where the body starts in the code
+        self.start = start
+        self.body = body
+        # the instructions that are not the body's
+        self.outside = outside
+        # every name the loop assigns, the test and the step included
+        self.written = written
+
+
+def counted_loop(code, h, types):
+    """
+    The loop whose header label is code[h], if it has the form above: the
+    counter is an int that only the step assigns, the bound an int literal
+    or a name the loop does not assign, and only the loop jumps back to the
+    header. The step may add any positive int literal, as the vector loops
+    this pass makes do. The body is anything between the branch and the step.
+    """
+    if h + 2 >= len(code) or code[h][0] != "label":
+        return None
+    header = code[h][1]
+    test, branch = code[h + 1], code[h + 2]
+    if test[0] != "binop" or test[3] != "<=" or branch[:2] != ("ifFalse", test[1]):
+        return None
+    i, n = test[2], test[4]
+    end = next(
+        (j for j in range(h + 3, len(code) - 1) if code[j] == ("goto", header)), None
+    )
+    if end is None or code[end + 1] != ("label", branch[2]):
+        return None
+    if not tac_types.NAME.match(i) or types.get(i, "int") != "int" or n == i:
+        return None
+    if tac_types.NAME.match(n):
+        if types.get(n, "int") not in ("int", "char"):
+            return None
+    elif not tac_types.NUMBER.match(n) or "." in n:
+        return None
+
+    # the step, i = i + c or through a temporary
+    body = code[h + 3 : end]
+    if body and body[-1][:4] == ("binop", i, i, "+"):
+        step, body = body[-1][4], body[:-1]
+    elif (
+        len(body) >= 2
+        and body[-2][:4] == ("binop", body[-2][1], i, "+")
+        and body[-1] == ("copy", i, body[-2][1])
+        and TEMP.match(body[-2][1])
+    ):
+        step, body = body[-2][4], body[:-2]
+    else:
+        return None
+    if not step.isdigit() or int(step) < 1:
+        return None
+    if not body or any(i in writes(t) for t in body):
+        return None
+    written = {v for t in code[h : end + 2] for v in writes(t)}
+    if n in written:
+        return None
+    # nothing else jumps to the header, so code in front of it runs once
+    others = code[:h] + code[end + 1 :]
+    if any(t[0] in ("goto", "ifFalse") and t[-1] == header for t in others):
+        return None
+    outside = code[: h + 3] + code[h + 3 + len(body) :]
+    return Loop(header, i, n, int(step), h + 3, body, outside, written)
+
+
+def element_type(loop, types):
+    """The one element type of the loop's arrays and values, or None."""
+    found = set()
+    for t in loop.body:
+        if t[0] in ("load", "store"):
+            array = t[2] if t[0] == "load" else t[1]
+            if tac_types.array_size(types.get(array)) is None:
+                return None
+            found.add(tac_types.scalar(types[array]))
+        if t[0] in ("load", "binop", "copy"):
+            found.add(types.get(t[1], "int"))
+        if t[0] == "binop":
+            found.add(tac_types.expression_type(*t[2:], types))
+    if len(found) != 1 or not found <= set(ELEMENTS):
+        return None
+    return found.pop()
+
+
+class NotElementWise(Exception):
+    pass
+
+
+def rewrite(loop, width, temps, labels, types):
+    """The vector loop to put in front of loop, or None if it is not
+    element-wise."""
+    element = element_type(loop, types)
+    if element is None:
+        return None
+    i = loop.index
+    assigned = {v for t in loop.body if t[0] != "store" for v in writes(t)}
+    lanes = {}
+    added = []
+
+    def new_vector():
+        added.append(next(temps))
+        types[added[-1]] = f"{element}<{width}>"
+        return added[-1]
+
+    def operand(v):
+        # a value of the body, or one that is the same in every iteration
+        if v in lanes:
+            return lanes[v]
+        if v in loop.written:
+            raise NotElementWise
+        return v
+
+    vector = []
+    try:
+        if any(not TEMP.match(v) for v in assigned):
+            raise NotElementWise
+        if any(v in assigned for t in loop.outside for v in reads(t)):
+            raise NotElementWise
+        for t in loop.body:
+            if t[0] == "store":
+                if t[2] != i:
+                    raise NotElementWise
+                value = operand(t[3])
+                if value not in lanes.values():
+                    # the same value in every element
+                    splat = new_vector()
+                    vector.append(("copy", splat, value))
+                    value = splat
+                vector.append(("store", t[1], i, value))
+                continue
+            if t[1] in lanes:
+                raise NotElementWise
+            if t[0] == "load":
+                if t[3] != i:
+                    raise NotElementWise
+                new = ("load", new_vector(), t[2], i)
+            elif t[0] == "binop":
+                if t[3] not in OPERATORS[element]:
+                    raise NotElementWise
+                a, b = operand(t[2]), operand(t[4])
+                new = ("binop", new_vector(), a, t[3], b)
+            else:
+                new = ("copy", new_vector(), operand(t[2]))
+            lanes[t[1]] = new[1]
+            vector.append(new)
+
+        # run while the last lane is in range: i <= n - (width - 1)
+        before = []
+        if tac_types.NUMBER.match(loop.bound):
+            limit = int(loop.bound) - (width - 1)
+            if limit < INT_MIN:
+                raise NotElementWise
+            limit = str(limit)
+        else:
+            limit = next(temps)
+            types[limit] = "int"
+            before.append(("binop", limit, loop.bound, "-", str(width - 1)))
+    except NotElementWise:
+        for name in added:
+            del types[name]
+        return None
+    label, test = next(labels), next(temps)
+    types[test] = "int"
+    return (
+        before
+        + [
+            ("label", label),
+            ("binop", test, i, "<=", limit),
+            ("ifFalse", test, loop.header),
+        ]
+        + vector
+        + [("binop", i, i, "+", str(width)), ("goto", label)]
+    )
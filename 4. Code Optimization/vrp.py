@@ -0,0 +1,438 @@
+import heapq
+import math
+import re
+from collections import namedtuple
+
+import tac_types
+from cfg import CFG
+from peephole import reads, to_text, writes
+
+# Value range analysis: abstract interpretation of TAC over intervals. Every
+# instruction gets an environment mapping names to the interval their value
+# lies in before it runs (a name not in it may hold anything). Loop headers
+# widen a bound that keeps growing to infinity; the two edges out of an
+# ifFalse narrow the operands of the comparison that feeds it; and a few
+# descending passes afterwards take back what widening lost (there are only
+# a few, so they can intersect with what flows in and still stop). The pass then
+# folds comparisons whose outcome is known, removes guards that always go
+# the same way and code no path reaches, and logs the integer variables that
+# would fit in a narrower C type than they are declared with. A store
+# converts the interval to the type of the name, as the store converts the
+# value; rounding to single precision is monotonic, so a float's interval is
+# its bounds rounded, and so are the operands of a float operation. Nothing
+# is known of array elements, and a vector's interval holds all its lanes.
+# Past a check a[i] the index is known to be inside the array.
+
+INF = math.inf
+NARROWING_PASSES = 4
+
+TEMP = re.compile(r"^t\d+$")
+NUMBER = re.compile(r"^-?\d+(\.\d+)?$")
+
+# integral is True when every value in it is a whole number
+Interval = namedtuple("Interval", "lo hi integral")
+TOP = Interval(-INF, INF, False)
+TRUE = Interval(1, 1, True)
+FALSE = Interval(0, 0, True)
+BOOL = Interval(0, 1, True)
+
+# C integer types by size, for narrowing
+TYPES = [
+    ("char", -(2**7), 2**7 - 1),
+    ("short", -(2**15), 2**15 - 1),
+    ("int", -(2**31), 2**31 - 1),
+]
+
+
+def constant(operand):
+    if NUMBER.match(operand):
+        v = float(operand)
+        return Interval(v, v, v.is_integer())
+    if operand == "True":
+        return TRUE
+    if operand == "False":
+        return FALSE
+    return None
+
+
+def join(a, b):
+    return Interval(min(a.lo, b.lo), max(a.hi, b.hi), a.integral and b.integral)
+
+
+def widen(old, new):
+    return Interval(
+        old.lo if new.lo >= old.lo else -INF,
+        old.hi if new.hi <= old.hi else INF,
+        new.integral,
+    )
+
+
+def meet(a, b):
+    return Interval(max(a.lo, b.lo), min(a.hi, b.hi), a.integral or b.integral)
+
+
+def whole(r):
+    """r with its bounds rounded inwards if it only holds whole numbers."""
+    if not r.integral:
+        return r
+    lo = math.ceil(r.lo) if r.lo > -INF else r.lo
+    hi = math.floor(r.hi) if r.hi < INF else r.hi
+    return Interval(lo, hi, True)
+
+
+def promoted(r):
+    """r converted to single precision, as an operand of a float operation."""
+    return Interval(tac_types.single(r.lo), tac_types.single(r.hi), r.integral)
+
+
+def stored(r, type_name):
+    """r stored into a name of type_name, or computed in it: truncated and
+    wrapped for the integer types."""
+    type_name = tac_types.scalar(type_name)
+    if type_name == "float":
+        return Interval(tac_types.single(r.lo), tac_types.single(r.hi), False)
+    if type_name not in tac_types.BITS:
+        return r
+    if not r.integral:
+        lo = math.trunc(r.lo) if r.lo > -INF else r.lo
+        hi = math.trunc(r.hi) if r.hi < INF else r.hi
+        r = Interval(lo, hi, True)
+    bits = tac_types.BITS[type_name]
+    low, high = -(2 ** (bits - 1)), 2 ** (bits - 1) - 1
+    if r.lo < low or r.hi > high:
+        # it wraps around, so it can be anything the type holds
+        return Interval(low, high, True)
+    return r
+
+
+def _product(x, y):
+    # 0 * inf is 0 here: the finite side really is 0
+    return 0 if x == 0 or y == 0 else x * y
+
+
+def evaluate(op, a, b):
+    """The interval of a op b."""
+    integral = a.integral and b.integral
+    if op == "+":
+        return Interval(a.lo + b.lo, a.hi + b.hi, integral)
+    if op == "-":
+        return Interval(a.lo - b.hi, a.hi - b.lo, integral)
+    if op == "*":
+        corners = [_product(x, y) for x in (a.lo, a.hi) for y in (b.lo, b.hi)]
+        return Interval(min(corners), max(corners), integral)
+    if op == "/":
+        if b.lo <= 0 <= b.hi:
+            return TOP
+        corners = [x / y for x in (a.lo, a.hi) for y in (b.lo, b.hi)]
+        lo, hi = min(corners), max(corners)
+        if integral:
+            # the quotient is truncated, so it lies between floor and ceiling
+            lo = math.floor(lo) if lo > -INF else lo
+            hi = math.ceil(hi) if hi < INF else hi
+        return Interval(lo, hi, integral)
+    if op == "<=":
+        if a.hi <= b.lo:
+            return TRUE
+        if a.lo > b.hi:
+            return FALSE
+        return BOOL
+    if op == ">":
+        if a.lo > b.hi:
+            return TRUE
+        if a.hi <= b.lo:
+            return FALSE
+        return BOOL
+    return TOP
+
+
+class Ranges:
+    """The environment before each instruction; None where nothing reaches."""
+
+    def __init__(self, code, types=None):
+        self.code = code
+        self.types = types or {}
+        self.cfg = CFG(code)
+        n = len(code)
+        self.before = [None] * n
+        if not n:
+            return
+        order = self.cfg.reverse_postorder()
+        rank = {node: k for k, node in enumerate(order)}
+        # a loop header is the target of an edge that goes back in the order
+        self.headers = {
+            s for i in order for s in self.cfg.succ[i] if rank[s] <= rank[i]
+        }
+
+        self.before[0] = {}
+        pending = [(0, 0)]
+        queued = {0}
+        while pending:
+            _, i = heapq.heappop(pending)
+            queued.discard(i)
+            for s, env in self.edges(i):
+                old = self.before[s]
+                new = env if old is None else self.join(old, env)
+                if old is not None and s in self.headers:
+                    new = {v: widen(old[v], r) for v, r in new.items()}
+                if new != old:
+                    self.before[s] = new
+                    if s not in queued:
+                        queued.add(s)
+                        heapq.heappush(pending, (rank[s], s))
+
+        for _ in range(NARROWING_PASSES):
+            changed = False
+            for s in order:
+                if s == 0:
+                    continue
+                incoming = None
+                for p in self.cfg.pred[s]:
+                    for t, env in self.edges(p):
+                        if t == s:
+                            if incoming is not None:
+                                env = self.join(incoming, env)
+                            incoming = env
+                old = self.before[s]
+                if old is None:
+                    continue
+                new = None
+                if incoming is not None:
+                    new = dict(old)
+                    for v, r in incoming.items():
+                        new[v] = meet(old[v], r) if v in old else r
+                if new != old:
+                    self.before[s] = new
+                    changed = True
+            if not changed:
+                break
+
+    @staticmethod
+    def join(a, b):
+        return {v: join(r, b[v]) for v, r in a.items() if v in b}
+
+    @staticmethod
+    def value(env, operand):
+        known = constant(operand)
+        if known is not None:
+            return known
+        return env.get(operand, TOP)
+
+    def after(self, i):
+        """The environment after instruction i, before any branch is taken."""
+        env = self.before[i]
+        if env is None:
+            return None
+        t = self.code[i]
+        if t[0] in ("binop", "copy", "load"):
+            env = dict(env)
+            if t[0] == "binop":
+                r = evaluate(t[3], *self.operands(env, t))
+                # int arithmetic wraps before the store
+                r = stored(r, tac_types.expression_type(*t[2:], self.types))
+            elif t[0] == "copy":
+                r = self.value(env, t[2])
+            else:
+                r = TOP
+            r = stored(r, self.types.get(t[1]))
+            # every name read through t[1] now sees the new value
+            if r == TOP:
+                env.pop(t[1], None)
+            else:
+                env[t[1]] = r
+        elif t[0] == "check" and t[2] == t[3] and not constant(t[2]):
+            size = tac_types.array_size(self.types.get(t[1]))
+            if size is not None:
+                inside = Interval(0, size - 1, True)
+                r = whole(meet(self.value(env, t[2]), inside))
+                if r.lo <= r.hi:
+                    env = dict(env)
+                    env[t[2]] = r
+        return env
+
+    def floating(self, t):
+        """Whether binop t operates in single precision."""
+        operands = (t[2], t[4])
+        return any(
+            tac_types.scalar(tac_types.operand_type(v, self.types)) == "float"
+            for v in operands
+        )
+
+    def operands(self, env, t):
+        """The intervals binop t operates on."""
+        a, b = self.value(env, t[2]), self.value(env, t[4])
+        if self.floating(t):
+            a, b = promoted(a), promoted(b)
+        return a, b
+
+    def edges(self, i):
+        """(successor, environment on the edge to it) for instruction i."""
+        env = self.after(i)
+        if env is None:
+            return []
+        t = self.code[i]
+        if t[0] != "ifFalse":
+            return [(s, env) for s in self.cfg.succ[i]]
+        target = self.cfg.labels[t[2]]
+        out = []
+        for s in self.cfg.succ[i]:
+            if s == target and s == i + 1:
+                out.append((s, env))
+                continue
+            refined = self.refine(i, env, truth=s != target)
+            if refined is not None:
+                out.append((s, refined))
+        return out
+
+    def refine(self, i, env, truth):
+        """env where the condition of the ifFalse at i is truth, or None if
+        it cannot be."""
+        cond = self.code[i][1]
+        r = truth_of(self.value(env, cond), truth)
+        if r is None:
+            return None
+        env = dict(env)
+        if not constant(cond):
+            env[cond] = r
+        if i == 0:
+            return env
+        t = self.code[i - 1]
+        if t[0] != "binop" or t[1] != cond or t[3] not in ("<=", ">"):
+            return env
+        if cond in (t[2], t[4]):
+            return env
+        a, b = self.operands(env, t)
+        # a <= b, or a > b with the operands swapped
+        le = (t[3] == "<=") == truth
+        if le:
+            small, large, strict = a, b, False
+        else:
+            small, large, strict = b, a, True
+        step = 1 if strict and small.integral and large.integral else 0
+        small = whole(
+            Interval(small.lo, min(small.hi, large.hi - step), small.integral)
+        )
+        large = whole(
+            Interval(max(large.lo, small.lo + step), large.hi, large.integral)
+        )
+        if small.lo > small.hi or large.lo > large.hi:
+            return None
+        names = (t[2], t[4]) if le else (t[4], t[2])
+        for name, r in zip(names, (small, large)):
+            # an int compared with a float was rounded to compare, so what
+            # holds of the rounded value need not hold of the int
+            if self.floating(t) and self.types.get(name, "int") != "float":
+                continue
+            if not constant(name):
+                env[name] = r
+        return env
+
+
+def truth_of(r, truth):
+    """r where the value is nonzero (truth) or zero, or None if it cannot be."""
+    if not truth:
+        return FALSE if r.lo <= 0 <= r.hi else None
+    if r.lo == r.hi == 0:
+        return None
+    if r.integral and r.lo == 0:
+        return Interval(1, r.hi, True)
+    if r.integral and r.hi == 0:
+        return Interval(r.lo, -1, True)
+    return r
+
+
+def narrowest_type(r):
+    if not r.integral:
+        return None
+    for name, lo, hi in TYPES:
+        if lo <= r.lo and r.hi <= hi:
+            return name
+    return None
+
+
+def value_ranges(code, log=None, types=None):
+    """Rewrite a list of (kind, fields...) tuples; returns the new list."""
+    ranges = Ranges(code, types)
+    branches = sum(1 for t in code if t[0] == "ifFalse")
+    removed = 0
+    out = []
+    for i, t in enumerate(code):
+        env = ranges.before[i]
+        if env is None:
+            if t[0] == "label":
+                out.append(t)
+                continue
+            if t[0] == "ifFalse":
+                removed += 1
+            if log is not None:
+                log.append(
+                    f"Value range: unreachable '{to_text(t)}' removed "
+                    f"in instruction {i + 1}"
+                )
+            continue
+        if t[0] == "binop" and t[3] in ("<=", ">"):
+            r = ranges.after(i).get(t[1], TOP)
+            if r in (TRUE, FALSE):
+                new = ("copy", t[1], "True" if r == TRUE else "False")
+                if log is not None:
+                    log.append(
+                        f"Value range: '{t[2]} {t[3]} {t[4]}' is always {new[2]} "
+                        f"in instruction {i + 1}"
+                    )
+                t = new
+        elif t[0] == "ifFalse":
+            r = ranges.value(env, t[1])
+            taken = truth_of(r, False) is not None
+            if taken != (truth_of(r, True) is not None):
+                removed += 1
+                if log is not None:
+                    what = "always" if taken else "never"
+                    log.append(
+                        f"Value range: branch '{to_text(t)}' {what} taken "
+                        f"in instruction {i + 1}"
+                    )
+                if not taken:
+                    continue
+                t = ("goto", t[2])
+        out.append(t)
+
+    # conditions folded above that nothing reads any more, and labels of
+    # the branches removed
+    used = {v for t in out for v in reads(t)}
+    targets = {t[-1] for t in out if t[0] in ("goto", "ifFalse")}
+    out = [
+        t
+        for t in out
+        if not (
+            t[0] == "copy"
+            and TEMP.match(t[1])
+            and t[1] not in used
+            and t[2] in ("True", "False")
+        )
+        and not (t[0] == "label" and t[1] not in targets)
+    ]
+
+    if log is not None:
+        log.append(f"Value range: {removed} of {branches} branches removed")
+        for v, r in variable_ranges(ranges).items():
+            fits = narrowest_type(r)
+            if fits and fits != ranges.types.get(v, "int"):
+                log.append(
+                    f"Value range: '{v}' is in [{int(r.lo)}, {int(r.hi)}] "
+                    f"and fits in {fits}"
+                )
+    return out
+
+
+def variable_ranges(ranges):
+    """The interval of every value assigned to each source variable."""
+    variables = {}
+    for i, t in enumerate(ranges.code):
+        after = ranges.after(i)
+        if after is None:
+            continue
+        for v in writes(t):
+            if TEMP.match(v):
+                continue
+            r = after.get(v, TOP)
+            variables[v] = join(variables[v], r) if v in variables else r
+    return variables
@@ -0,0 +1,376 @@
+import argparse
+import ast
+import os
+import subprocess
+import sys
+
+# C backend: typed three-address code as a C program, for gcc to turn into
+# native code. Every TAC name is a variable of main() of its declared type
+# (arrays are static, so they start zeroed as the VM's do), labels and gotos
+# stay labels and gotos, and at the end the program prints the final value of
+# each variable, in the form tac_vm.py prints them, so a native run can be
+# checked against the VM.
+#
+# A vector name (tac_types.py) becomes an SSE register type for 4 lanes and an
+# AVX2 one for 8, and its operations the matching intrinsics: loads and stores
+# are unaligned, a scalar operand is broadcast with set1, and int lanes
+# multiply with mullo, which keeps the low 32 bits as the VM's wrapping does.
+# Arithmetic on a float is done in float, as the VM does, so float literals an
+# operation reads get an f suffix; a copy converts the literal as written.
+# The program is compiled with -fwrapv so int overflow wraps as in the VM.
+# A bounds check that fails prints the index, as the VM's error does, and
+# exits with status 1.
+#
+# A loop marked parallel (parallel.py) becomes an OpenMP parallel for over a
+# counter of its own, which the body copies into the TAC counter; the marker's
+# clauses carry over as they are. Below PARALLEL_TRIPS iterations the loop
+# runs on one thread, as starting the others costs more than it saves. After
+# the loop the counter and the test get the values the last test left them.
+
+GEN_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(GEN_DIR)
+sys.path.insert(0, os.path.join(ROOT_DIR, "4. Code Optimization"))
+
+import tac_types  # noqa: E402
+import tac_vm  # noqa: E402
+from lcm import TEMP  # noqa: E402
+from vectorize import counted_loop  # noqa: E402
+
+CC = ["gcc", "-O2", "-fwrapv"]
+# gcc's own vectorizer is left out, so scalar TAC stays scalar code
+SCALAR_FLAGS = ["-fno-tree-vectorize"]
+OPENMP_FLAG = "-fopenmp"
+PARALLEL_TRIPS = 4096
+
+# per vector width: the intrinsics' prefix, register bits and gcc flag
+# (SSE4.1 for _mm_mullo_epi32)
+WIDTHS = {4: ("_mm", 128, "-msse4.1"), 8: ("_mm256", 256, "-mavx2")}
+SUFFIX = {"int": "epi32", "float": "ps"}
+OPERATIONS = {
+    ("int", "+"): "add",
+    ("int", "-"): "sub",
+    ("int", "*"): "mullo",
+    ("float", "+"): "add",
+    ("float", "-"): "sub",
+    ("float", "*"): "mul",
+    ("float", "/"): "div",
+}
+
+FORMATS = {"int": "%d", "char": "%d", "float": "%.17g"}
+
+# C keywords and the backend's own names a TAC name must not collide with
+RESERVED = {
+    "auto", "break", "case", "const", "continue", "default", "do", "double",
+    "else", "enum", "extern", "for", "goto", "if", "inline", "long", "register",
+    "restrict", "return", "short", "signed", "sizeof", "static", "struct",
+    "switch", "typedef", "union", "unsigned", "void", "volatile", "while",
+    "main", "printf", "fprintf", "stderr", "exit", "out_of_bounds",
+    "print_ints", "print_chars", "print_floats", "minicc_first", "minicc_i",
+}  # fmt: skip
+
+PRELUDE = """\
+#include <stdio.h>
+#include <stdlib.h>
+
+static void out_of_bounds(const char *name, int index){
+	fprintf(stderr, "'%s[%d]' is outside the array\\n", name, index);
+	exit(1);
+}
+
+static void print_ints(const char *name, const int *a, int n){
+	printf("%s = [", name);
+	for(int k = 0; k < n; k++)
+		printf(k ? ", %d" : "%d", a[k]);
+	printf("]\\n");
+}
+
+static void print_chars(const char *name, const char *a, int n){
+	printf("%s = [", name);
+	for(int k = 0; k < n; k++)
+		printf(k ? ", %d" : "%d", a[k]);
+	printf("]\\n");
+}
+
+static void print_floats(const char *name, const float *a, int n){
+	printf("%s = [", name);
+	for(int k = 0; k < n; k++)
+		printf(k ? ", %.17g" : "%.17g", (double)a[k]);
+	printf("]\\n");
+}
+"""
+
+
+class BackendError(Exception):
+    pass
+
+
+def c_name(name):
+    return name + "_" if name in RESERVED else name
+
+
+class Translation:
+    def __init__(self, code, types):
+        self.code = code
+        self.types = types
+        # the gcc flags the vector types need
+        self.flags = []
+        for type_name in types.values():
+            width = tac_types.vector_width(type_name)
+            if width is None:
+                continue
+            if width not in WIDTHS:
+                raise BackendError(f"no vector instructions for {type_name}")
+            if WIDTHS[width][2] not in self.flags:
+                self.flags.append(WIDTHS[width][2])
+        if any(t[0] == "parallel" for t in code):
+            self.flags.append(OPENMP_FLAG)
+
+    def type_of(self, name):
+        return self.types.get(name, "int")
+
+    def literal(self, operand, suffix):
+        if operand in ("True", "False"):
+            return "1" if operand == "True" else "0"
+        if "." in operand and suffix:
+            return operand + "f"
+        return operand
+
+    def scalar(self, operand, in_operation=False):
+        """A scalar operand; in an operation a float literal is a float."""
+        if tac_types.NAME.match(operand) and operand not in ("True", "False"):
+            return c_name(operand)
+        return self.literal(operand, in_operation)
+
+    def vector(self, operand, type_name, in_operation=True):
+        """An operand of a vector operation on type_name, broadcast if scalar."""
+        if tac_types.vector_width(self.type_of(operand)) and tac_types.NAME.match(
+            operand
+        ):
+            return c_name(operand)
+        prefix, _, _ = WIDTHS[tac_types.vector_width(type_name)]
+        element = tac_types.scalar(type_name)
+        value = self.scalar(operand, in_operation)
+        return f"{prefix}_set1_{SUFFIX[element]}({value})"
+
+    def address(self, array, index, type_name):
+        """&array[index] as the pointer the vector load or store takes."""
+        _, bits, _ = WIDTHS[tac_types.vector_width(type_name)]
+        pointer = f"&{c_name(array)}[{self.scalar(index)}]"
+        if tac_types.scalar(type_name) == "int":
+            return f"(__m{bits}i *){pointer}"
+        return pointer
+
+    def register_type(self, type_name):
+        _, bits, _ = WIDTHS[tac_types.vector_width(type_name)]
+        return f"__m{bits}i" if tac_types.scalar(type_name) == "int" else f"__m{bits}"
+
+    def declaration(self, name, type_name):
+        if tac_types.vector_width(type_name):
+            return f"\t{self.register_type(type_name)} {c_name(name)};"
+        size = tac_types.array_size(type_name)
+        if size is not None:
+            return f"\tstatic {tac_types.scalar(type_name)} {c_name(name)}[{size}];"
+        return f"\t{type_name} {c_name(name)} = 0;"
+
+    def statement(self, t):
+        kind = t[0]
+        if kind == "label":
+            return f"{t[1]}:;"
+        if kind == "goto":
+            return f"\tgoto {t[1]};"
+        if kind == "ifFalse":
+            return f"\tif(!{self.scalar(t[1])}) goto {t[2]};"
+        if kind == "check":
+            return self.check(t)
+        target = self.type_of(t[1])
+        width = tac_types.vector_width(target)
+        if kind == "load" and width:
+            prefix, bits, _ = WIDTHS[width]
+            element = tac_types.scalar(target)
+            load = f"loadu_si{bits}" if element == "int" else "loadu_ps"
+            pointer = self.address(t[2], t[3], target)
+            return f"\t{c_name(t[1])} = {prefix}_{load}({pointer});"
+        if kind == "load":
+            return f"\t{c_name(t[1])} = {c_name(t[2])}[{self.scalar(t[3])}];"
+        if kind == "store":
+            value = self.type_of(t[3]) if tac_types.NAME.match(t[3]) else None
+            width = tac_types.vector_width(value)
+            if width:
+                prefix, bits, _ = WIDTHS[width]
+                store = (
+                    f"storeu_si{bits}"
+                    if tac_types.scalar(value) == "int"
+                    else "storeu_ps"
+                )
+                pointer = self.address(t[1], t[2], value)
+                return f"\t{prefix}_{store}({pointer}, {c_name(t[3])});"
+            return f"\t{c_name(t[1])}[{self.scalar(t[2])}] = {self.scalar(t[3])};"
+        if kind == "copy" and width:
+            return f"\t{c_name(t[1])} = {self.vector(t[2], target, False)};"
+        if kind == "copy":
+            return f"\t{c_name(t[1])} = {self.scalar(t[2])};"
+        # binop
+        a, op, b = t[2], t[3], t[4]
+        if width:
+            element = tac_types.scalar(target)
+            if (element, op) not in OPERATIONS:
+                raise BackendError(f"no vector instruction for '{op}' on {target}")
+            prefix, _, _ = WIDTHS[width]
+            name = f"{prefix}_{OPERATIONS[(element, op)]}_{SUFFIX[element]}"
+            a, b = self.vector(a, target), self.vector(b, target)
+            return f"\t{c_name(t[1])} = {name}({a}, {b});"
+        a, b = self.scalar(a, True), self.scalar(b, True)
+        return f"\t{c_name(t[1])} = {a} {op} {b};"
+
+    def statements(self):
+        """The lines of code, each marked loop lowered as a whole."""
+        lines = []
+        k = 0
+        while k < len(self.code):
+            if self.code[k][0] == "parallel":
+                loop_lines, k = self.parallel(k)
+                lines += loop_lines
+            else:
+                lines.append(self.statement(self.code[k]))
+                k += 1
+        return lines
+
+    def parallel(self, k):
+        """The lines of the loop marked by code[k], and where the code goes
+        on after it: at the loop's exit label."""
+        marker = self.code[k]
+        loop = counted_loop(self.code, k + 1, self.types)
+        if loop is None or loop.header != marker[1]:
+            raise BackendError(f"'{marker[1]}' is not a counted loop")
+        end = self.code.index(("goto", loop.header), loop.start)
+        i, n, step = c_name(loop.index), self.scalar(loop.bound), loop.step
+        test = c_name(self.code[k + 2][1])
+        _, _, private, last, reductions = marker
+        clauses = [f"if((long long){n} - minicc_first >= {PARALLEL_TRIPS}LL * {step})"]
+        if private:
+            clauses.append(f"private({', '.join(map(c_name, private))})")
+        if last:
+            clauses.append(f"lastprivate({', '.join(map(c_name, last))})")
+        for op, name in reductions:
+            clauses.append(f"reduction({op}: {c_name(name)})")
+        lines = [
+            "\t{",
+            f"\tint minicc_first = {i};",
+            f"\t#pragma omp parallel for {' '.join(clauses)}",
+            f"\tfor(int minicc_i = minicc_first; minicc_i <= {n}; minicc_i += {step}){{",
+            f"\t\t{i} = minicc_i;",
+        ]
+        lines += ["\t" + self.statement(t) for t in loop.body]
+        lines += [
+            "\t}",
+            f"\tif(minicc_first <= {n})",
+            f"\t\t{i} = minicc_first + (int)(((long long){n} - minicc_first) "
+            f"/ {step} + 1) * {step};",
+            f"\t{test} = {i} <= {n};",
+            "\t}",
+        ]
+        return lines, end + 1
+
+    def check(self, t):
+        size = tac_types.array_size(self.types.get(t[1]))
+        if size is None:
+            raise BackendError(f"'{t[1]}' is not an array")
+        first, last = self.scalar(t[2]), self.scalar(t[3])
+        array = f'"{t[1]}"'
+        if t[2] == t[3]:
+            fails, at = f"{first} < 0 || {first} >= {size}", first
+        else:
+            fails = f"{first} <= {last} && ({first} < 0 || {last} >= {size})"
+            at = f"{first} < 0 ? {first} : {last}"
+        return f"\tif({fails}) out_of_bounds({array}, {at});"
+
+    def result(self, name, type_name):
+        """The statement printing name's final value."""
+        size = tac_types.array_size(type_name)
+        if size is not None:
+            printer = f"print_{tac_types.scalar(type_name)}s"
+            return f'\t{printer}("{name}", {c_name(name)}, {size});'
+        value = c_name(name)
+        if type_name == "float":
+            value = f"(double){value}"
+        return f'\tprintf("{name} = {FORMATS[type_name]}\\n", {value});'
+
+    def source(self):
+        lines = [PRELUDE]
+        if self.flags:
+            lines.insert(0, "#include <immintrin.h>")
+        lines.append("int main(void){")
+        names = tac_types.declarations(self.code, self.types)
+        declared = [d.split(" ")[1].split("[")[0] for d in names]
+        for name in declared:
+            lines.append(self.declaration(name, self.types[name]))
+        lines.append("")
+        lines += self.statements()
+        lines.append("")
+        for name in declared:
+            type_name = self.types[name]
+            if TEMP.match(name) or tac_types.vector_width(type_name):
+                continue
+            lines.append(self.result(name, type_name))
+        lines.append("\treturn 0;")
+        lines.append("}")
+        return "\n".join(lines) + "\n"
+
+
+def translate(text):
+    """TAC text as (C source, the gcc flags it needs)."""
+    code, types = tac_vm.parse(text)
+    translation = Translation(code, types)
+    return translation.source(), translation.flags
+
+
+def compile_c(source, flags, exe):
+    """Build source into the program exe with gcc."""
+    command = CC + SCALAR_FLAGS + flags + ["-x", "c", "-", "-o", exe]
+    process = subprocess.run(command, input=source, capture_output=True, text=True)
+    if process.returncode != 0:
+        raise BackendError(f"gcc failed:\n{process.stderr}")
+
+
+def run_program(exe):
+    """Run a compiled program; returns its final variables by name."""
+    process = subprocess.run([exe], capture_output=True, text=True)
+    if process.returncode != 0:
+        raise BackendError(
+            f"{exe} exited with status {process.returncode}: {process.stderr.strip()}"
+        )
+    state = {}
+    for line in process.stdout.splitlines():
+        name, _, value = line.partition(" = ")
+        state[name] = ast.literal_eval(value)
+    return state
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Translate optimized three-address code to C."
+    )
+    parser.add_argument("source", metavar="FILE", help="three-address code")
+    parser.add_argument("-o", "--output", metavar="OUT.c", help="default: stdout")
+    parser.add_argument(
+        "--compile", metavar="EXE", help="also build the program EXE with gcc"
+    )
+    args = parser.parse_args()
+    try:
+        with open(args.source, "r") as f:
+            source, flags = translate(f.read())
+        if args.output:
+            with open(args.output, "w") as f:
+                f.write(source)
+        else:
+            sys.stdout.write(source)
+        if args.compile:
+            compile_c(source, flags, args.compile)
+    except (OSError, ValueError, BackendError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
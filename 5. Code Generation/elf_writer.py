@@ -0,0 +1,225 @@
+import os
+import struct
+
+from x86_encoder import Section
+
+# ELF64 files from an x86_encoder.Assembly, without as or ld: a relocatable
+# object with its sections, a symbol table and RELA relocations, which any
+# linker takes, or a static executable for Linux with the relocations
+# resolved here. The executable has no section headers, only a program
+# header table of two loadable segments: the headers, .text and .rodata,
+# read and execute, then .data and .bss, read and write. The program starts
+# at the runtime's _start, so it needs no C library or startup files.
+
+BASE = 0x400000  # where the executable is loaded, as ld -static puts it
+PAGE = 0x1000
+
+SHT_PROGBITS, SHT_SYMTAB, SHT_STRTAB, SHT_RELA, SHT_NOBITS = 1, 2, 3, 4, 8
+SHF_WRITE, SHF_ALLOC, SHF_EXECINSTR, SHF_INFO_LINK = 1, 2, 4, 0x40
+# the sections the backend writes, in file order, with their type and flags
+SECTIONS = {
+    ".text": (SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR),
+    ".data": (SHT_PROGBITS, SHF_WRITE | SHF_ALLOC),
+    ".bss": (SHT_NOBITS, SHF_WRITE | SHF_ALLOC),
+    ".rodata": (SHT_PROGBITS, SHF_ALLOC),
+}
+RELOCATIONS = {"pc32": 2, "plt32": 4, "32s": 11}  # R_X86_64_*
+STB_LOCAL, STB_GLOBAL = 0, 1
+STT_NOTYPE, STT_SECTION = 0, 3
+PT_LOAD, PT_GNU_STACK = 1, 0x6474E551
+PF_X, PF_W, PF_R = 1, 2, 4
+
+HEADER = struct.Struct("<16sHHIQQQIHHHHHH")
+SECTION_HEADER = struct.Struct("<IIQQQQIIQQ")
+PROGRAM_HEADER = struct.Struct("<IIQQQQQQ")
+SYMBOL = struct.Struct("<IBBHQQ")
+RELA = struct.Struct("<QQq")
+IDENT = b"\x7fELF\x02\x01\x01" + bytes(9)  # 64-bit, little-endian, System V
+
+
+class LinkError(Exception):
+    pass
+
+
+class Strings:
+    """A string table: offsets of the names added to it."""
+
+    def __init__(self):
+        self.data = bytearray(b"\0")
+        self.offsets = {"": 0}
+
+    def add(self, name):
+        if name not in self.offsets:
+            self.offsets[name] = len(self.data)
+            self.data += name.encode() + b"\0"
+        return self.offsets[name]
+
+
+def align_up(value, alignment):
+    return -(-value // alignment) * alignment
+
+
+def sections(assembly):
+    """The sections in file order; .text, .data and .bss always, as as does."""
+    for name in assembly.sections:
+        if name not in SECTIONS:
+            raise LinkError(f"cannot place the section '{name}'")
+    present = [n for n in SECTIONS if n in assembly.sections or n != ".rodata"]
+    return [assembly.sections.get(n) or Section(n) for n in present]
+
+
+def write_object(assembly, path):
+    """Write assembly as the relocatable object path."""
+    contents = sections(assembly)
+    index = {s.name: k for k, s in enumerate(contents, 1)}
+    note = len(contents) + 1
+
+    # the null symbol, one per section, the local symbols, then the global
+    # ones; relocations against a local go through its section's symbol
+    names = Strings()
+    symbols = [SYMBOL.pack(0, 0, 0, 0, 0, 0)]
+    for k in index.values():
+        symbols.append(SYMBOL.pack(0, STB_LOCAL << 4 | STT_SECTION, 0, k, 0, 0))
+    for name, (section, offset) in assembly.symbols.items():
+        if name not in assembly.globals and not name.startswith(".L"):
+            info = STB_LOCAL << 4 | STT_NOTYPE
+            name = names.add(name)
+            symbols.append(SYMBOL.pack(name, info, 0, index[section], offset, 0))
+    first_global = len(symbols)
+    numbers = {}
+    undefined = sorted(
+        {r[2] for s in contents for r in s.relocations} - set(assembly.symbols)
+    )
+    for name in sorted(assembly.globals) + undefined:
+        numbers[name] = len(symbols)
+        section, offset = assembly.symbols.get(name, (None, 0))
+        shndx = index[section] if section else 0
+        info = STB_GLOBAL << 4 | STT_NOTYPE
+        symbols.append(SYMBOL.pack(names.add(name), info, 0, shndx, offset, 0))
+
+    relocations = []
+    for s in contents:
+        if not s.relocations:
+            continue
+        entries = bytearray()
+        for offset, kind, symbol, addend in s.relocations:
+            if symbol in numbers:
+                number = numbers[symbol]
+            else:
+                section, place = assembly.symbols[symbol]
+                number, addend = index[section], addend + place
+            entries += RELA.pack(offset, number << 32 | RELOCATIONS[kind], addend)
+        relocations.append((".rela" + s.name, index[s.name], entries))
+
+    # the section contents, then the section header table
+    shstrtab = Strings()
+    headers = [SECTION_HEADER.pack(*[0] * 10)]
+    body = bytearray()
+    position = HEADER.size
+
+    def place(name, kind, flags, data, size, link=0, info=0, alignment=1, entry=0):
+        nonlocal position
+        if kind != SHT_NOBITS:
+            padding = -position % alignment
+            body.extend(bytes(padding))
+            position += padding
+        headers.append(
+            SECTION_HEADER.pack(
+                shstrtab.add(name), kind, flags, 0, position, size, link, info,
+                alignment, entry,
+            )
+        )  # fmt: skip
+        if kind != SHT_NOBITS:
+            body.extend(data)
+            position += len(data)
+
+    for s in contents:
+        kind, flags = SECTIONS[s.name]
+        place(s.name, kind, flags, s.data, s.size, alignment=s.align)
+    place(".note.GNU-stack", SHT_PROGBITS, 0, b"", 0)
+    symtab = note + len(relocations) + 1
+    for name, target, entries in relocations:
+        place(
+            name, SHT_RELA, SHF_INFO_LINK, entries, len(entries), symtab, target,
+            8, RELA.size,
+        )  # fmt: skip
+    table = b"".join(symbols)
+    place(
+        ".symtab", SHT_SYMTAB, 0, table, len(table), symtab + 1, first_global, 8,
+        SYMBOL.size,
+    )  # fmt: skip
+    place(".strtab", SHT_STRTAB, 0, names.data, len(names.data))
+    shstrtab.add(".shstrtab")
+    place(".shstrtab", SHT_STRTAB, 0, shstrtab.data, len(shstrtab.data))
+    body += bytes(-position % 8)
+    position = align_up(position, 8)
+
+    header = HEADER.pack(
+        IDENT, 1, 62, 1, 0, 0, position, 0, HEADER.size, 0, 0,
+        SECTION_HEADER.size, len(headers), len(headers) - 1,
+    )  # fmt: skip
+    with open(path, "wb") as f:
+        f.write(header + body + b"".join(headers))
+
+
+def write_executable(assembly, path):
+    """Link assembly alone into the static executable path."""
+    contents = {s.name: s for s in sections(assembly)}
+    text, rodata = contents[".text"], contents.get(".rodata") or Section(".rodata")
+    data, bss = contents[".data"], contents[".bss"]
+
+    # the read-only segment from the start of the file, then the writable
+    # one on the next page, at an address that matches its file offset
+    # modulo the page size, as the loader maps it
+    headers_end = HEADER.size + 3 * PROGRAM_HEADER.size
+    offsets = {".text": align_up(headers_end, text.align)}
+    offsets[".rodata"] = align_up(offsets[".text"] + text.size, rodata.align)
+    end = offsets[".rodata"] + rodata.size
+    offsets[".data"] = align_up(end, data.align)
+    address = {name: BASE + offset for name, offset in offsets.items()}
+    address[".data"] = align_up(BASE + end, PAGE) + offsets[".data"] % PAGE
+    address[".bss"] = align_up(address[".data"] + data.size, bss.align)
+    writable_end = address[".bss"] + bss.size
+
+    def resolve(symbol):
+        if symbol not in assembly.symbols:
+            raise LinkError(f"undefined symbol '{symbol}'")
+        section, offset = assembly.symbols[symbol]
+        return address[section] + offset
+
+    if "_start" not in assembly.symbols:
+        raise LinkError("no _start to begin at")
+    image = bytearray(offsets[".data"] + data.size)
+    for s in (text, rodata, data):
+        code = bytearray(s.data)
+        for offset, kind, symbol, addend in s.relocations:
+            value = resolve(symbol) + addend
+            if kind != "32s":
+                value -= address[s.name] + offset
+            if not -(2**31) <= value < 2**31:
+                raise LinkError(f"'{symbol}' is out of reach of {s.name}+{offset:#x}")
+            code[offset : offset + 4] = struct.pack("<i", value)
+        image[offsets[s.name] : offsets[s.name] + len(code)] = code
+
+    segments = [
+        (PT_LOAD, PF_R | PF_X, 0, BASE, end, end, PAGE),
+        (
+            PT_LOAD, PF_R | PF_W, offsets[".data"], address[".data"], data.size,
+            writable_end - address[".data"], PAGE,
+        ),
+        (PT_GNU_STACK, PF_R | PF_W, 0, 0, 0, 0, 16),
+    ]  # fmt: skip
+    image[: HEADER.size] = HEADER.pack(
+        IDENT, 2, 62, 1, resolve("_start"), HEADER.size, 0, 0, HEADER.size,
+        PROGRAM_HEADER.size, len(segments), 0, 0, 0,
+    )  # fmt: skip
+    table = b"".join(
+        PROGRAM_HEADER.pack(kind, flags, offset, vaddr, vaddr, filesz, memsz, alignment)
+        for kind, flags, offset, vaddr, filesz, memsz, alignment in segments
+    )
+    image[HEADER.size : headers_end] = table
+    with open(path, "wb") as f:
+        f.write(image)
+    # executable wherever it is readable, as ld leaves it
+    mode = os.stat(path).st_mode
+    os.chmod(path, mode | (mode & 0o444) >> 2)
@@ -0,0 +1,293 @@
+# Register allocation for the x86-64 backend, on a program given as one
+# Instructions entry per instruction: the virtual registers it reads and
+# writes, the instructions control goes to next, and, for a copy between two
+# virtual registers, the pair (destination, source). Each allocator maps
+# every virtual register of one class to a register of that class or to None,
+# which means it lives in a stack slot; the backend reaches those through
+# scratch registers that are never allocated. It also returns the nodes that
+# share another's stack slot, as the two ends of a coalesced copy do.
+#
+# linear_scan is the default: Poletto and Sarkar's, over live intervals in
+# instruction order. When no register is free it spills whichever of the
+# current interval and the active ones ends last, so it neither looks at how
+# often a register is used nor tries to give a copy's two ends one register.
+#
+# coalescing is George and Appel's iterated register coalescing: it colors
+# the interference graph built from liveness, coalesces copies whose ends do
+# not interfere as long as Briggs's or George's test says the graph stays
+# colorable, and when it must spill picks the node of least cost per
+# interference, a use or definition costing 10 to the power of the loop
+# depth it is at. Spilled nodes stay in memory rather than being rewritten
+# into short ranges, as the backend's scratch registers already cover them.
+
+
+class Instructions:
+    def __init__(self, uses, defs, succ, moves, depth):
+        # per instruction: sets of names, successor indices, a (dst, src)
+        # copy or None, and the number of loops around it
+        self.uses = uses
+        self.defs = defs
+        self.succ = succ
+        self.moves = moves
+        self.depth = depth
+
+
+def liveness(program):
+    """The names live into and out of each instruction."""
+    n = len(program.uses)
+    live_in = [set() for _ in range(n)]
+    live_out = [set() for _ in range(n)]
+    changed = True
+    while changed:
+        changed = False
+        for k in reversed(range(n)):
+            out = set()
+            for s in program.succ[k]:
+                out |= live_in[s]
+            new = program.uses[k] | (out - program.defs[k])
+            if out != live_out[k] or new != live_in[k]:
+                live_out[k], live_in[k] = out, new
+                changed = True
+    return live_in, live_out
+
+
+def spill_costs(program, nodes):
+    """Each node's uses and definitions, each weighted by 10 ** loop depth."""
+    cost = dict.fromkeys(nodes, 0)
+    for k, depth in enumerate(program.depth):
+        for v in program.uses[k] | program.defs[k]:
+            if v in cost:
+                cost[v] += 10**depth
+    return cost
+
+
+def linear_scan(program, nodes, registers, live_in):
+    """Poletto and Sarkar's linear scan; returns ({node: register or None},
+    {})."""
+    start, end = {}, {}
+    for k in range(len(program.uses)):
+        for v in (live_in[k] | program.defs[k]) & nodes:
+            start.setdefault(v, k)
+            end[v] = k
+    location = dict.fromkeys(nodes)
+    free = list(registers)
+    active = []
+    for v in sorted(start, key=lambda v: (start[v], v)):
+        for a in [a for a in active if end[a] < start[v]]:
+            active.remove(a)
+            free.append(location[a])
+        if free:
+            location[v] = free.pop(0)
+            active.append(v)
+        else:
+            last = max(active, key=lambda a: (end[a], a))
+            if end[last] > end[v]:
+                location[v], location[last] = location[last], None
+                active.remove(last)
+                active.append(v)
+        active.sort(key=lambda a: end[a])
+    return location, {}
+
+
+def coalescing(program, nodes, registers, live_out):
+    """Iterated register coalescing; returns ({node: register or None},
+    {coalesced node: the node it was merged into})."""
+    graph = Coalescing(program, nodes, registers, live_out)
+    return graph.location, {v: graph.get_alias(v) for v in graph.coalesced}
+
+
+class Coalescing:
+    def __init__(self, program, nodes, registers, live_out):
+        self.k = len(registers)
+        self.nodes = nodes
+        self.adjacent = {v: set() for v in nodes}
+        self.degree = dict.fromkeys(nodes, 0)
+        self.move_list = {v: set() for v in nodes}
+        self.alias = {}
+        self.cost = spill_costs(program, nodes)
+        # the copies, by instruction index, in the state they are in
+        self.moves = {}
+        self.worklist_moves = set()
+        self.active_moves = set()
+        self.build(program, live_out)
+
+        self.simplify_list, self.freeze_list, self.spill_list = [], set(), set()
+        for v in sorted(nodes):
+            if self.degree[v] >= self.k:
+                self.spill_list.add(v)
+            elif self.move_related(v):
+                self.freeze_list.add(v)
+            else:
+                self.simplify_list.append(v)
+        self.stack = []
+        self.coalesced = set()
+        # the nodes on the stack or coalesced
+        self.removed = set()
+        while True:
+            if self.simplify_list:
+                self.simplify()
+            elif self.worklist_moves:
+                self.coalesce()
+            elif self.freeze_list:
+                self.freeze()
+            elif self.spill_list:
+                self.select_spill()
+            else:
+                break
+        self.location = self.assign_colors(registers)
+
+    def build(self, program, live_out):
+        for k in range(len(program.uses)):
+            live = live_out[k] & self.nodes
+            move = program.moves[k]
+            if move and move[0] in self.nodes and move[1] in self.nodes:
+                live = live - {move[1]}
+                for v in move:
+                    self.move_list[v].add(k)
+                self.moves[k] = move
+                self.worklist_moves.add(k)
+            for d in program.defs[k] & self.nodes:
+                for v in live:
+                    self.add_edge(v, d)
+
+    def add_edge(self, u, v):
+        if u != v and v not in self.adjacent[u]:
+            self.adjacent[u].add(v)
+            self.adjacent[v].add(u)
+            self.degree[u] += 1
+            self.degree[v] += 1
+
+    def neighbours(self, v):
+        """v's neighbours still in the graph."""
+        return self.adjacent[v] - self.removed
+
+    def node_moves(self, v):
+        return self.move_list[v] & (self.active_moves | self.worklist_moves)
+
+    def move_related(self, v):
+        return bool(self.node_moves(v))
+
+    def simplify(self):
+        v = self.simplify_list.pop()
+        self.stack.append(v)
+        self.removed.add(v)
+        for u in self.neighbours(v):
+            self.decrement_degree(u)
+
+    def decrement_degree(self, v):
+        self.degree[v] -= 1
+        if self.degree[v] == self.k - 1 and v in self.spill_list:
+            self.enable_moves({v} | self.neighbours(v))
+            self.spill_list.discard(v)
+            if self.move_related(v):
+                self.freeze_list.add(v)
+            else:
+                self.simplify_list.append(v)
+
+    def enable_moves(self, nodes):
+        for v in nodes:
+            for m in self.node_moves(v):
+                if m in self.active_moves:
+                    self.active_moves.discard(m)
+                    self.worklist_moves.add(m)
+
+    def add_worklist(self, v):
+        if (
+            v in self.freeze_list
+            and not self.move_related(v)
+            and self.degree[v] < self.k
+        ):
+            self.freeze_list.discard(v)
+            self.simplify_list.append(v)
+
+    def ok(self, t, r):
+        """George's test for one neighbour t of the node r merges into."""
+        return self.degree[t] < self.k or r in self.adjacent[t]
+
+    def conservative(self, nodes):
+        """Briggs's test: fewer than k of the nodes have significant degree."""
+        return sum(1 for v in nodes if self.degree[v] >= self.k) < self.k
+
+    def get_alias(self, v):
+        while v in self.coalesced:
+            v = self.alias[v]
+        return v
+
+    def coalesce(self):
+        m = min(self.worklist_moves)
+        self.worklist_moves.discard(m)
+        x, y = map(self.get_alias, self.moves[m])
+        u, v = x, y
+        if u == v:
+            self.add_worklist(u)
+        elif v in self.adjacent[u]:
+            # constrained: the two ends interfere
+            self.add_worklist(u)
+            self.add_worklist(v)
+        elif all(self.ok(t, u) for t in self.neighbours(v)) or self.conservative(
+            self.neighbours(u) | self.neighbours(v)
+        ):
+            self.combine(u, v)
+            self.add_worklist(u)
+        else:
+            self.active_moves.add(m)
+
+    def combine(self, u, v):
+        if v in self.freeze_list:
+            self.freeze_list.discard(v)
+        else:
+            self.spill_list.discard(v)
+        self.coalesced.add(v)
+        self.removed.add(v)
+        self.alias[v] = u
+        self.move_list[u] |= self.move_list[v]
+        self.enable_moves({v})
+        self.cost[u] += self.cost[v]
+        for t in self.neighbours(v):
+            self.add_edge(t, u)
+            self.decrement_degree(t)
+        if self.degree[u] >= self.k and u in self.freeze_list:
+            self.freeze_list.discard(u)
+            self.spill_list.add(u)
+
+    def freeze(self):
+        v = min(self.freeze_list)
+        self.freeze_list.discard(v)
+        self.simplify_list.append(v)
+        self.freeze_moves(v)
+
+    def freeze_moves(self, v):
+        for m in self.node_moves(v):
+            x, y = self.moves[m]
+            x, y = self.get_alias(x), self.get_alias(y)
+            other = y if x == self.get_alias(v) else x
+            self.active_moves.discard(m)
+            self.worklist_moves.discard(m)
+            if (
+                other in self.freeze_list
+                and not self.node_moves(other)
+                and self.degree[other] < self.k
+            ):
+                self.freeze_list.discard(other)
+                self.simplify_list.append(other)
+
+    def select_spill(self):
+        v = min(self.spill_list, key=lambda v: (self.cost[v] / self.degree[v], v))
+        self.spill_list.discard(v)
+        self.simplify_list.append(v)
+        self.freeze_moves(v)
+
+    def assign_colors(self, registers):
+        location = {}
+        while self.stack:
+            v = self.stack.pop()
+            taken = {
+                location[self.get_alias(u)]
+                for u in self.adjacent[v]
+                if self.get_alias(u) in location
+            }
+            free = [r for r in registers if r not in taken]
+            location[v] = free[0] if free else None
+        for v in self.coalesced:
+            location[v] = location[self.get_alias(v)]
+        return location
@@ -0,0 +1,1143 @@
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+from collections import Counter
+
+# x86-64 backend: typed three-address code as GNU assembly for a static
+# executable that needs no C library. Every scalar TAC name is a virtual
+# register, of the integer class (ints and chars, in 32-bit registers) or the
+# float class (xmm registers, single precision), and regalloc.py assigns the
+# machine registers: linear scan by default, iterated register coalescing
+# with --regalloc irc. A name left in memory gets a stack slot, which the code
+# reaches through the scratch registers rax, rdx and r11 and xmm14 and xmm15.
+# Arrays live in .bss, so they start zeroed as in the VM.
+#
+# The instructions follow the VM's semantics (tac_vm.py): int arithmetic
+# wraps in 32 bits and divides with truncation, a store to a char keeps the
+# low 8 bits, a float converts to an int by truncation and a float operation
+# is done in single precision. A comparison that only feeds the branch after
+# it becomes a compare and a conditional jump.
+#
+# At the end the program prints its variables as the C backend's programs do,
+# floats as their exact decimal expansion, which reads back as the same
+# value. The runtime below does that with write and exit system calls.
+#
+# x86_encoder.py and elf_writer.py build the object file or the program from
+# the assembly in-process; with the gnu assembler, as and ld do instead.
+
+GEN_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(GEN_DIR)
+sys.path.insert(0, os.path.join(ROOT_DIR, "4. Code Optimization"))
+
+import elf_writer  # noqa: E402
+import regalloc  # noqa: E402
+import tac_types  # noqa: E402
+import tac_vm  # noqa: E402
+import x86_encoder  # noqa: E402
+from c_backend import BackendError, run_program  # noqa: E402
+from lcm import TEMP  # noqa: E402
+from peephole import reads  # noqa: E402
+
+ALLOCATORS = {"linear": "linear scan", "irc": "iterated register coalescing"}
+ASSEMBLERS = ("builtin", "gnu")
+
+# the registers each class hands out, in order
+GPRS = ("rbx", "rcx", "rsi", "rdi", "r8", "r9", "r10", "r12", "r13", "r14", "r15")
+XMMS = tuple(f"xmm{k}" for k in range(14))
+LOW = {
+    "rbx": "ebx", "rcx": "ecx", "rsi": "esi", "rdi": "edi", "r8": "r8d",
+    "r9": "r9d", "r10": "r10d", "r12": "r12d", "r13": "r13d", "r14": "r14d",
+    "r15": "r15d",
+}  # fmt: skip
+SCALE = {"int": 4, "float": 4, "char": 1}
+
+INT_OPERATIONS = {"+": "addl", "-": "subl", "*": "imull"}
+FLOAT_OPERATIONS = {"+": "addss", "-": "subss", "*": "mulss", "/": "divss"}
+# setcc for a comparison, and the jump taken when it is false
+INT_CONDITIONS = {"<=": ("setle", "jg"), ">": ("setg", "jle")}
+FLOAT_CONDITIONS = {"<=": ("setbe", "ja"), ">": ("seta", "jbe")}
+
+
+def register_class(type_name):
+    return "float" if type_name == "float" else "int"
+
+
+class Lowering:
+    """
+    TAC as a list of instructions on virtual registers:
+
+        ("label", L)  ("jmp", L)  ("jz", v, L)
+        ("br", op, a, b, L, class)     goto L unless a op b
+        ("mov", d, a)  ("cvt_if", d, a)  ("cvt_fi", d, a)  ("sext8", d, a)
+        ("op", op, d, a, b)  ("div", d, a, b)  ("opf", op, d, a, b)
+        ("cmp", op, d, a, b, class)
+        ("load", d, array, i)  ("store", array, i, v)
+        ("check", array, first, last)
+        ("exit",)                      print the program's variables
+
+    An operand is a virtual register's name, or a Python int or float for a
+    literal of the class the instruction works in.
+    """
+
+    def __init__(self, code, types):
+        self.types = types
+        self.classes = {}
+        self.count = 0
+        self.lir = []
+        for name, type_name in types.items():
+            if tac_types.vector_width(type_name):
+                raise BackendError(f"'{name}' is a vector; use the C backend")
+            if tac_types.array_size(type_name) is None:
+                self.classes[name] = register_class(type_name)
+        uses = Counter(v for t in code for v in reads(t))
+        k = 0
+        while k < len(code):
+            t = code[k]
+            following = code[k + 1] if k + 1 < len(code) else ("end",)
+            if (
+                t[0] == "binop"
+                and t[3] in tac_types.COMPARISONS
+                and TEMP.match(t[1])
+                and uses[t[1]] == 1
+                and following[:2] == ("ifFalse", t[1])
+            ):
+                self.branch(t, following[2])
+                k += 2
+                continue
+            self.instruction(t)
+            k += 1
+        self.lir.append(("exit",))
+
+    def type_of(self, name):
+        return self.types.get(name, "int")
+
+    def new(self, kind):
+        self.count += 1
+        name = f".v{self.count}"
+        self.classes[name] = kind
+        return name
+
+    def emit(self, *instruction):
+        self.lir.append(instruction)
+
+    def operand(self, operand, kind):
+        """operand as a value of register class kind, converted if need be."""
+        value = tac_types.value_of(operand)
+        if value is not None:
+            return tac_types.convert(value, kind)
+        self.classes.setdefault(operand, register_class(self.type_of(operand)))
+        if self.classes[operand] == kind:
+            return operand
+        converted = self.new(kind)
+        self.emit("cvt_if" if kind == "float" else "cvt_fi", converted, operand)
+        return converted
+
+    def assign(self, name, value, value_type):
+        """name = value, converted from value_type to name's type."""
+        target = self.type_of(name)
+        self.classes.setdefault(name, register_class(target))
+        if not isinstance(value, str):
+            self.emit("mov", name, tac_types.convert(value, target))
+        elif register_class(value_type) == register_class(target):
+            if target == "char" and value_type != "char":
+                self.emit("sext8", name, value)
+            else:
+                self.emit("mov", name, value)
+        elif target == "float":
+            self.emit("cvt_if", name, value)
+        elif target == "char":
+            whole = self.new("int")
+            self.emit("cvt_fi", whole, value)
+            self.emit("sext8", name, whole)
+        else:
+            self.emit("cvt_fi", name, value)
+
+    def comparison_operands(self, t):
+        a, b = t[2], t[4]
+        kinds = {tac_types.operand_type(v, self.types) for v in (a, b)}
+        kind = "float" if "float" in kinds else "int"
+        return self.operand(a, kind), self.operand(b, kind), kind
+
+    def branch(self, t, label):
+        a, b, kind = self.comparison_operands(t)
+        self.emit("br", t[3], a, b, label, kind)
+
+    def instruction(self, t):
+        kind = t[0]
+        if kind in ("label", "goto"):
+            self.emit("label" if kind == "label" else "jmp", t[1])
+        elif kind == "ifFalse":
+            value = tac_types.value_of(t[1])
+            if value is None:
+                self.classes.setdefault(t[1], register_class(self.type_of(t[1])))
+                self.emit("jz", t[1], t[2])
+            elif not value:
+                self.emit("jmp", t[2])
+        elif kind == "copy":
+            value = tac_types.value_of(t[2])
+            if value is None:
+                self.operand(t[2], register_class(self.type_of(t[2])))
+                self.assign(t[1], t[2], self.type_of(t[2]))
+            else:
+                self.assign(t[1], value, None)
+        elif kind == "binop":
+            self.binop(t)
+        elif kind == "load":
+            element = tac_types.scalar(self.types[t[2]])
+            index = self.operand(t[3], "int")
+            target = self.type_of(t[1])
+            if register_class(target) == register_class(element) and (
+                target != "char" or element == "char"
+            ):
+                self.classes.setdefault(t[1], register_class(target))
+                self.emit("load", t[1], t[2], index)
+            else:
+                value = self.new(register_class(element))
+                self.emit("load", value, t[2], index)
+                self.assign(t[1], value, element)
+        elif kind == "store":
+            element = tac_types.scalar(self.types[t[1]])
+            index = self.operand(t[2], "int")
+            literal = tac_types.value_of(t[3])
+            if literal is not None:
+                value = tac_types.convert(literal, element)
+            else:
+                value = self.operand(t[3], register_class(element))
+            self.emit("store", t[1], index, value)
+        elif kind == "check":
+            first, last = self.operand(t[2], "int"), self.operand(t[3], "int")
+            self.emit("check", t[1], first, last)
+        elif kind != "parallel":
+            raise BackendError(f"cannot translate '{kind}'")
+
+    def binop(self, t):
+        target = self.type_of(t[1])
+        if t[3] in tac_types.COMPARISONS:
+            a, b, kind = self.comparison_operands(t)
+            value = t[1] if target == "int" else self.new("int")
+            self.classes.setdefault(t[1], register_class(target))
+            self.emit("cmp", t[3], value, a, b, kind)
+            if value != t[1]:
+                self.assign(t[1], value, "int")
+            return
+        result = tac_types.expression_type(t[2], t[3], t[4], self.types)
+        a, b = self.operand(t[2], result), self.operand(t[4], result)
+        value = t[1] if target == result else self.new(result)
+        self.classes.setdefault(t[1], register_class(target))
+        if result == "float":
+            self.emit("opf", t[3], value, a, b)
+        elif t[3] == "/":
+            self.emit("div", value, a, b)
+        else:
+            self.emit("op", t[3], value, a, b)
+        if value != t[1]:
+            self.assign(t[1], value, result)
+
+
+def operands(instruction):
+    """The (defined, used) virtual register candidates of an instruction."""
+    kind = instruction[0]
+    if kind in ("label", "jmp", "exit"):
+        return (), ()
+    if kind == "jz":
+        return (), (instruction[1],)
+    if kind == "br":
+        return (), instruction[2:4]
+    if kind in ("mov", "cvt_if", "cvt_fi", "sext8"):
+        return (instruction[1],), (instruction[2],)
+    if kind in ("op", "opf"):
+        return (instruction[2],), instruction[3:5]
+    if kind == "div":
+        return (instruction[1],), instruction[2:4]
+    if kind == "cmp":
+        return (instruction[2],), instruction[3:5]
+    if kind == "load":
+        return (instruction[1],), (instruction[3],)
+    if kind == "store":
+        return (), instruction[2:4]
+    # check
+    return (), instruction[2:4]
+
+
+def analyse(lir, classes, printed):
+    """lir as a regalloc.Instructions."""
+    labels = {t[1]: k for k, t in enumerate(lir) if t[0] == "label"}
+    uses, defs, succ, moves = [], [], [], []
+    depth = [0] * len(lir)
+    for k, t in enumerate(lir):
+        defined, used = operands(t)
+        defs.append({v for v in defined if v in classes})
+        if t[0] == "exit":
+            uses.append(set(printed))
+        else:
+            uses.append({v for v in used if isinstance(v, str) and v in classes})
+        following = [k + 1] if k + 1 < len(lir) and t[0] not in ("jmp", "exit") else []
+        if t[0] in ("jmp", "jz", "br"):
+            target = labels[t[4] if t[0] == "br" else t[-1]]
+            following.append(target)
+            if target <= k:
+                # a loop, from its header to the jump back
+                for j in range(target, k + 1):
+                    depth[j] += 1
+        succ.append(following)
+        copy = t[0] == "mov" and isinstance(t[2], str)
+        moves.append((t[1], t[2]) if copy else None)
+    return regalloc.Instructions(uses, defs, succ, moves, depth)
+
+
+def allocate(program, classes, method):
+    """{virtual register: machine register or None} and {node: the node
+    whose stack slot it shares} over both classes."""
+    live_in, live_out = regalloc.liveness(program)
+    used = set().union(*program.uses, *program.defs) if program.uses else set()
+    location, shared = {}, {}
+    for kind, registers in (("int", GPRS), ("float", XMMS)):
+        nodes = {v for v in used if classes[v] == kind}
+        if method == "irc":
+            found, aliases = regalloc.coalescing(program, nodes, registers, live_out)
+        else:
+            found, aliases = regalloc.linear_scan(program, nodes, registers, live_in)
+        location.update(found)
+        shared.update(aliases)
+    return location, shared, live_in
+
+
+class Emitter:
+    def __init__(self, lowering, location, shared, names):
+        self.lowering = lowering
+        self.classes = lowering.classes
+        self.types = lowering.types
+        self.location = location
+        self.shared = shared
+        # the program's variables, printed at the end
+        self.names = names
+        self.lines = []
+        self.constants = {}
+        self.slots = {}
+        self.stubs = []
+        self.stats = Counter()
+
+    def out(self, line):
+        self.lines.append("\t" + line)
+
+    def place(self, v):
+        """Where virtual register v is: a register or its stack slot."""
+        register = self.location.get(v)
+        if register:
+            return "%" + (LOW[register] if self.classes[v] == "int" else register)
+        owner = self.shared.get(v, v)
+        if owner not in self.slots:
+            self.slots[owner] = 8 * (len(self.slots) + 1)
+        return f"-{self.slots[owner]}(%rbp)"
+
+    def operand(self, x):
+        if isinstance(x, str):
+            return self.place(x)
+        if isinstance(x, float):
+            bits = struct.unpack("<I", struct.pack("<f", x))[0]
+            if bits not in self.constants:
+                self.constants[bits] = f".LC{len(self.constants)}"
+            return f"{self.constants[bits]}(%rip)"
+        return f"${tac_types.wrap(int(x), 32)}"
+
+    def move(self, source, target):
+        """movl between any two places, through eax if both are memory."""
+        if source == target:
+            return
+        if "(" in source and "(" in target:
+            self.out(f"movl {source}, %eax")
+            source = "%eax"
+        self.out(f"movl {source}, {target}")
+
+    def move_float(self, source, target):
+        if source == target:
+            return
+        if "(" in source and "(" in target:
+            self.out(f"movss {source}, %xmm15")
+            source = "%xmm15"
+        self.out(f"movss {source}, {target}")
+
+    def address(self, array, index):
+        """The memory operand of array[index]."""
+        scale = SCALE[tac_types.scalar(self.types[array])]
+        if not isinstance(index, str):
+            return f"A_{array}{int(index) * scale:+d}"
+        self.out(f"movslq {self.place(index)}, %r11")
+        return f"A_{array}(,%r11,{scale})"
+
+    def compare(self, op, a, b, kind):
+        """Set the flags for a op b; returns the setcc and the jump when false."""
+        first, second = self.operand(a), self.operand(b)
+        if kind == "float":
+            if not first.startswith("%"):
+                self.out(f"movss {first}, %xmm15")
+                first = "%xmm15"
+            self.out(f"comiss {second}, {first}")
+            return FLOAT_CONDITIONS[op]
+        if first.startswith("$") or ("(" in first and "(" in second):
+            self.out(f"movl {first}, %eax")
+            first = "%eax"
+        self.out(f"cmpl {second}, {first}")
+        return INT_CONDITIONS[op]
+
+    def two_address(self, name, target, a, b, commutative, move, scratch):
+        """target = a name b on either register class."""
+        if target.startswith("%") and target != b:
+            move(a, target)
+            self.out(f"{name} {b}, {target}")
+        elif target.startswith("%") and commutative:
+            self.out(f"{name} {a}, {target}")
+        elif target == a and name in ("addl", "subl") and "(" not in b:
+            # a counter in a stack slot, updated in place
+            self.out(f"{name} {b}, {target}")
+        else:
+            move(a, scratch)
+            self.out(f"{name} {b}, {scratch}")
+            move(scratch, target)
+
+    def instruction(self, t):
+        kind = t[0]
+        if kind == "label":
+            self.lines.append(f".{t[1]}:")
+        elif kind == "jmp":
+            self.out(f"jmp .{t[1]}")
+        elif kind == "jz":
+            place = self.place(t[1])
+            if self.classes[t[1]] == "float":
+                self.out("xorps %xmm15, %xmm15")
+                self.out(f"ucomiss {place}, %xmm15")
+            elif place.startswith("%"):
+                self.out(f"testl {place}, {place}")
+            else:
+                self.out(f"cmpl $0, {place}")
+            self.out(f"je .{t[2]}")
+        elif kind == "br":
+            _, jump = self.compare(t[1], t[2], t[3], t[5])
+            self.out(f"{jump} .{t[4]}")
+        elif kind == "cmp":
+            setcc, _ = self.compare(t[1], t[3], t[4], t[5])
+            self.out(f"{setcc} %al")
+            self.out("movzbl %al, %eax")
+            self.move("%eax", self.place(t[2]))
+        elif kind == "mov":
+            target, source = self.place(t[1]), self.operand(t[2])
+            if isinstance(t[2], str):
+                self.stats["moves" if source != target else "coalesced"] += 1
+            if self.classes[t[1]] == "float":
+                self.move_float(source, target)
+            else:
+                self.move(source, target)
+        elif kind == "cvt_if":
+            target = self.place(t[1])
+            register = target if target.startswith("%") else "%xmm15"
+            self.out(f"cvtsi2ssl {self.place(t[2])}, {register}")
+            self.move_float(register, target)
+        elif kind == "cvt_fi":
+            self.out(f"cvttss2si {self.place(t[2])}, %rax")
+            self.move("%eax", self.place(t[1]))
+        elif kind == "sext8":
+            self.move(self.operand(t[2]), "%eax")
+            self.out("movsbl %al, %eax")
+            self.move("%eax", self.place(t[1]))
+        elif kind == "op":
+            self.two_address(
+                INT_OPERATIONS[t[1]],
+                self.place(t[2]),
+                self.operand(t[3]),
+                self.operand(t[4]),
+                t[1] != "-",
+                self.move,
+                "%eax",
+            )
+        elif kind == "opf":
+            self.two_address(
+                FLOAT_OPERATIONS[t[1]],
+                self.place(t[2]),
+                self.operand(t[3]),
+                self.operand(t[4]),
+                t[1] in "+*",
+                self.move_float,
+                "%xmm15",
+            )
+        elif kind == "div":
+            self.move(self.operand(t[2]), "%eax")
+            self.out("cltd")
+            divisor = self.operand(t[3])
+            if divisor.startswith("$"):
+                self.out(f"movl {divisor}, %r11d")
+                divisor = "%r11d"
+            self.out(f"idivl {divisor}")
+            self.move("%eax", self.place(t[1]))
+        elif kind == "load":
+            self.load(t)
+        elif kind == "store":
+            self.store(t)
+        elif kind == "check":
+            self.check(t)
+        else:
+            self.exit()
+
+    def load(self, t):
+        element = tac_types.scalar(self.types[t[2]])
+        source = self.address(t[2], t[3])
+        target = self.place(t[1])
+        if element == "float":
+            register = target if target.startswith("%") else "%xmm15"
+            self.out(f"movss {source}, {register}")
+            self.move_float(register, target)
+            return
+        register = target if target.startswith("%") else "%eax"
+        self.out(f"{'movsbl' if element == 'char' else 'movl'} {source}, {register}")
+        self.move(register, target)
+
+    def store(self, t):
+        element = tac_types.scalar(self.types[t[1]])
+        target = self.address(t[1], t[2])
+        value = self.operand(t[3])
+        if element == "float":
+            if not value.startswith("%"):
+                self.out(f"movss {value}, %xmm15")
+                value = "%xmm15"
+            self.out(f"movss {value}, {target}")
+        elif element == "char":
+            if value.startswith("$"):
+                self.out(f"movb {value}, {target}")
+            else:
+                self.move(value, "%eax")
+                self.out(f"movb %al, {target}")
+        else:
+            if "(" in value:
+                self.move(value, "%eax")
+                value = "%eax"
+            self.out(f"movl {value}, {target}")
+
+    def check(self, t):
+        array, first, last = t[1], t[2], t[3]
+        size = tac_types.array_size(self.types[array])
+        stub = f".Loob{len(self.stubs)}"
+        if first == last and not isinstance(first, str):
+            if not 0 <= first < size:
+                self.out(f"movl ${first}, %eax")
+                self.out(f"jmp {stub}")
+                self.stubs.append((stub, array))
+            return
+        self.stubs.append((stub, array))
+        self.move(self.operand(first), "%eax")
+        if first == last:
+            # one compare, unsigned, catches both ends
+            self.out(f"cmpl ${size}, %eax")
+            self.out(f"jae {stub}")
+            return
+        passed = f".Lpass{len(self.stubs) - 1}"
+        self.move(self.operand(last), "%edx")
+        self.out("cmpl %edx, %eax")
+        self.out(f"jg {passed}")
+        self.out("testl %eax, %eax")
+        self.out(f"js {stub}")
+        self.out("movl %edx, %eax")
+        self.out(f"cmpl ${size}, %eax")
+        self.out(f"jge {stub}")
+        self.lines.append(f"{passed}:")
+
+    def exit(self):
+        """Store the variables and print them."""
+        for name in self.names:
+            type_name = self.types[name]
+            if tac_types.array_size(type_name) is not None:
+                continue
+            if type_name == "float":
+                place = self.place(name)
+                if "(" in place:
+                    self.out(f"movss {place}, %xmm15")
+                    place = "%xmm15"
+                self.out(f"movss {place}, V_{name}(%rip)")
+            else:
+                self.move(self.place(name), "%eax")
+                self.out(f"movl %eax, V_{name}(%rip)")
+        for name in self.names:
+            type_name = self.types[name]
+            self.out(f"leaq .Ls_{name}(%rip), %rdi")
+            size = tac_types.array_size(type_name)
+            if size is not None:
+                self.out(f"leaq A_{name}(%rip), %rsi")
+                self.out(f"movl ${size}, %edx")
+                self.out(f"call minicc_print_{tac_types.scalar(type_name)}s")
+            elif type_name == "float":
+                self.out(f"movss V_{name}(%rip), %xmm0")
+                self.out("call minicc_print_float")
+            else:
+                self.out(f"movl V_{name}(%rip), %esi")
+                self.out("call minicc_print_int")
+
+    def source(self, lir, live_in):
+        body = self.lines
+        self.lines = []
+        # a name read before it is written starts at 0, as in the VM
+        for v in sorted(live_in[0] if lir else ()):
+            place = self.place(v)
+            if place.startswith("%xmm"):
+                self.out(f"xorps {place}, {place}")
+            elif place.startswith("%"):
+                self.out(f"xorl {place}, {place}")
+            else:
+                self.out(f"movl $0, {place}")
+        start = self.lines
+        self.lines = body
+        for t in lir:
+            before = len(self.lines)
+            self.instruction(t)
+            self.stats["spill accesses"] += sum(
+                line.count("(%rbp)") for line in self.lines[before:]
+            )
+        self.out("xorl %eax, %eax")
+        self.out("leave")
+        self.out("ret")
+        for stub, array in self.stubs:
+            self.lines.append(f"{stub}:")
+            self.out(f"leaq .Ls_{array}(%rip), %rdi")
+            self.out("movl %eax, %esi")
+            self.out("call minicc_out_of_bounds")
+
+        frame = -(-8 * len(self.slots) // 16) * 16
+        lines = ["\t.text", "\t.globl main", "main:"]
+        lines += ["\tpushq %rbp", "\tmovq %rsp, %rbp"]
+        if frame:
+            lines.append(f"\tsubq ${frame}, %rsp")
+        lines += start + self.lines
+        lines += ["", "\t.section .rodata"]
+        for bits, label in self.constants.items():
+            lines += ["\t.balign 4", f"{label}:", f"\t.long {bits}"]
+        for name in self.names:
+            lines += [f".Ls_{name}:", f'\t.asciz "{name}"']
+        lines += ["", "\t.bss"]
+        for name in self.names:
+            type_name = self.types[name]
+            size = tac_types.array_size(type_name)
+            if size is None:
+                lines += ["\t.balign 4", f"V_{name}:", "\t.zero 4"]
+        for name, type_name in self.types.items():
+            size = tac_types.array_size(type_name)
+            if size is not None:
+                scale = SCALE[tac_types.scalar(type_name)]
+                lines += ["\t.balign 16", f"A_{name}:", f"\t.zero {size * scale}"]
+        self.stats["spilled"] = len(self.slots)
+        return "\n".join(lines) + "\n"
+
+
+RUNTIME = """\
+# the runtime: start, buffered output to a file descriptor, and printing
+	.text
+	.globl _start
+_start:
+	xorl %ebp, %ebp
+	call main
+	movl %eax, %edi
+	call minicc_exit
+
+minicc_exit:
+	pushq %rdi
+	call minicc_flush
+	popq %rdi
+	movl $60, %eax
+	syscall
+
+minicc_flush:
+	movq minicc_outlen(%rip), %rdx
+	testq %rdx, %rdx
+	je .Lflush_done
+	movl minicc_outfd(%rip), %edi
+	leaq minicc_out(%rip), %rsi
+	movl $1, %eax
+	syscall
+	movq $0, minicc_outlen(%rip)
+.Lflush_done:
+	ret
+
+# putc(dil)
+minicc_putc:
+	movq minicc_outlen(%rip), %rax
+	cmpq $65536, %rax
+	jb .Lputc_room
+	pushq %rdi
+	call minicc_flush
+	popq %rdi
+	xorl %eax, %eax
+.Lputc_room:
+	leaq minicc_out(%rip), %rdx
+	movb %dil, (%rdx,%rax)
+	incq %rax
+	movq %rax, minicc_outlen(%rip)
+	ret
+
+# puts(rdi), a string ending in a zero byte
+minicc_puts:
+	pushq %rbx
+	movq %rdi, %rbx
+.Lputs_next:
+	movzbl (%rbx), %edi
+	testl %edi, %edi
+	je .Lputs_done
+	call minicc_putc
+	incq %rbx
+	jmp .Lputs_next
+.Lputs_done:
+	popq %rbx
+	ret
+
+# put_int(edi), in decimal
+minicc_put_int:
+	pushq %rbx
+	pushq %r12
+	movslq %edi, %rbx
+	testq %rbx, %rbx
+	jns .Lint_digits
+	movl $45, %edi
+	call minicc_putc
+	negq %rbx
+.Lint_digits:
+	leaq minicc_digits+32(%rip), %r12
+	movq %rbx, %rax
+	movl $10, %ecx
+.Lint_digit:
+	xorl %edx, %edx
+	divq %rcx
+	addl $48, %edx
+	decq %r12
+	movb %dl, (%r12)
+	testq %rax, %rax
+	jne .Lint_digit
+.Lint_put:
+	movzbl (%r12), %edi
+	call minicc_putc
+	incq %r12
+	leaq minicc_digits+32(%rip), %rax
+	cmpq %rax, %r12
+	jb .Lint_put
+	popq %r12
+	popq %rbx
+	ret
+
+# put_float(xmm0), exactly: the value is m * 2 ** e, which is an integer
+# times 2 ** e for e >= 0 and m * 5 ** -e / 10 ** -e otherwise, so the digits
+# are those of a product computed in limbs of 9 decimal digits
+minicc_put_float:
+	pushq %rbx
+	pushq %r12
+	pushq %r13
+	pushq %r14
+	pushq %r15
+	movd %xmm0, %ebx
+	testl %ebx, %ebx
+	jns .Lfloat_positive
+	movl $45, %edi
+	call minicc_putc
+.Lfloat_positive:
+	movl %ebx, %r12d
+	shrl $23, %r12d
+	andl $255, %r12d
+	andl $8388607, %ebx
+	testl %r12d, %r12d
+	je .Lfloat_subnormal
+	orl $8388608, %ebx
+	subl $150, %r12d
+	jmp .Lfloat_scaled
+.Lfloat_subnormal:
+	movl $-149, %r12d
+.Lfloat_scaled:
+	testl %ebx, %ebx
+	jne .Lfloat_nonzero
+	xorl %r12d, %r12d
+.Lfloat_nonzero:
+	leaq minicc_big(%rip), %r13
+	movq %rbx, (%r13)
+	movl $1, %r14d
+	xorl %r15d, %r15d
+	movl $2, %ecx
+	testl %r12d, %r12d
+	jns .Lfloat_times
+	negl %r12d
+	movl %r12d, %r15d
+	movl $5, %ecx
+.Lfloat_times:
+	testl %r12d, %r12d
+	je .Lfloat_digits
+	xorl %edx, %edx
+	xorl %esi, %esi
+.Lfloat_limb:
+	movq (%r13,%rsi,8), %rax
+	imulq %rcx, %rax
+	addq %rdx, %rax
+	xorl %edx, %edx
+.Lfloat_carry:
+	cmpq $1000000000, %rax
+	jb .Lfloat_stored
+	subq $1000000000, %rax
+	incq %rdx
+	jmp .Lfloat_carry
+.Lfloat_stored:
+	movq %rax, (%r13,%rsi,8)
+	incq %rsi
+	cmpq %r14, %rsi
+	jb .Lfloat_limb
+	testq %rdx, %rdx
+	je .Lfloat_next
+	movq %rdx, (%r13,%r14,8)
+	incq %r14
+.Lfloat_next:
+	decl %r12d
+	jmp .Lfloat_times
+.Lfloat_digits:
+	leaq minicc_decimal(%rip), %rdi
+	movq %r14, %rsi
+	movl $10, %ecx
+.Lfloat_limb_digits:
+	decq %rsi
+	movq (%r13,%rsi,8), %rax
+	leaq 9(%rdi), %r8
+	movq %r8, %r9
+.Lfloat_digit:
+	xorl %edx, %edx
+	divq %rcx
+	addl $48, %edx
+	decq %r9
+	movb %dl, (%r9)
+	cmpq %rdi, %r9
+	ja .Lfloat_digit
+	movq %r8, %rdi
+	testq %rsi, %rsi
+	jne .Lfloat_limb_digits
+	movq %rdi, %r12
+	leaq minicc_decimal(%rip), %rbx
+	leaq -1(%r12), %rax
+.Lfloat_skip:
+	cmpq %rax, %rbx
+	jae .Lfloat_point_at
+	cmpb $48, (%rbx)
+	jne .Lfloat_point_at
+	incq %rbx
+	jmp .Lfloat_skip
+.Lfloat_point_at:
+	movq %r12, %r13
+	subq %r15, %r13
+	cmpq %rbx, %r13
+	ja .Lfloat_whole
+	movl $48, %edi
+	call minicc_putc
+	movl $46, %edi
+	call minicc_putc
+.Lfloat_zeros:
+	cmpq %rbx, %r13
+	jae .Lfloat_rest
+	movl $48, %edi
+	call minicc_putc
+	incq %r13
+	jmp .Lfloat_zeros
+.Lfloat_whole:
+	cmpq %r13, %rbx
+	jae .Lfloat_point
+	movzbl (%rbx), %edi
+	call minicc_putc
+	incq %rbx
+	jmp .Lfloat_whole
+.Lfloat_point:
+	cmpq %r12, %rbx
+	jae .Lfloat_done
+	movl $46, %edi
+	call minicc_putc
+.Lfloat_rest:
+	cmpq %r12, %rbx
+	jae .Lfloat_done
+	movzbl (%rbx), %edi
+	call minicc_putc
+	incq %rbx
+	jmp .Lfloat_rest
+.Lfloat_done:
+	popq %r15
+	popq %r14
+	popq %r13
+	popq %r12
+	popq %rbx
+	ret
+
+# print_int(rdi name, esi value): "name = value"
+minicc_print_int:
+	pushq %rbx
+	movl %esi, %ebx
+	call minicc_puts
+	leaq .Lrt_equals(%rip), %rdi
+	call minicc_puts
+	movl %ebx, %edi
+	call minicc_put_int
+	movl $10, %edi
+	call minicc_putc
+	popq %rbx
+	ret
+
+# print_float(rdi name, xmm0 value)
+minicc_print_float:
+	pushq %rbx
+	movd %xmm0, %ebx
+	call minicc_puts
+	leaq .Lrt_equals(%rip), %rdi
+	call minicc_puts
+	movd %ebx, %xmm0
+	call minicc_put_float
+	movl $10, %edi
+	call minicc_putc
+	popq %rbx
+	ret
+
+# print_ints, print_chars and print_floats(rdi name, rsi array, edx size):
+# "name = [a, b, ...]"
+minicc_print_ints:
+	pushq %rbx
+	pushq %r12
+	pushq %r13
+	movq %rsi, %rbx
+	movl %edx, %r12d
+	xorl %r13d, %r13d
+	call minicc_puts
+	leaq .Lrt_open(%rip), %rdi
+	call minicc_puts
+.Lints_next:
+	cmpl %r12d, %r13d
+	jge .Llist_done
+	testl %r13d, %r13d
+	je .Lints_first
+	leaq .Lrt_comma(%rip), %rdi
+	call minicc_puts
+.Lints_first:
+	movl (%rbx,%r13,4), %edi
+	call minicc_put_int
+	incl %r13d
+	jmp .Lints_next
+
+minicc_print_chars:
+	pushq %rbx
+	pushq %r12
+	pushq %r13
+	movq %rsi, %rbx
+	movl %edx, %r12d
+	xorl %r13d, %r13d
+	call minicc_puts
+	leaq .Lrt_open(%rip), %rdi
+	call minicc_puts
+.Lchars_next:
+	cmpl %r12d, %r13d
+	jge .Llist_done
+	testl %r13d, %r13d
+	je .Lchars_first
+	leaq .Lrt_comma(%rip), %rdi
+	call minicc_puts
+.Lchars_first:
+	movsbl (%rbx,%r13,1), %edi
+	call minicc_put_int
+	incl %r13d
+	jmp .Lchars_next
+
+minicc_print_floats:
+	pushq %rbx
+	pushq %r12
+	pushq %r13
+	movq %rsi, %rbx
+	movl %edx, %r12d
+	xorl %r13d, %r13d
+	call minicc_puts
+	leaq .Lrt_open(%rip), %rdi
+	call minicc_puts
+.Lfloats_next:
+	cmpl %r12d, %r13d
+	jge .Llist_done
+	testl %r13d, %r13d
+	je .Lfloats_first
+	leaq .Lrt_comma(%rip), %rdi
+	call minicc_puts
+.Lfloats_first:
+	movss (%rbx,%r13,4), %xmm0
+	call minicc_put_float
+	incl %r13d
+	jmp .Lfloats_next
+
+.Llist_done:
+	leaq .Lrt_close(%rip), %rdi
+	call minicc_puts
+	popq %r13
+	popq %r12
+	popq %rbx
+	ret
+
+# out_of_bounds(rdi name, esi index): the message on stderr, and exit 1
+minicc_out_of_bounds:
+	movq %rdi, %rbx
+	movl %esi, %r12d
+	movq $0, minicc_outlen(%rip)
+	movl $2, minicc_outfd(%rip)
+	movl $39, %edi
+	call minicc_putc
+	movq %rbx, %rdi
+	call minicc_puts
+	movl $91, %edi
+	call minicc_putc
+	movl %r12d, %edi
+	call minicc_put_int
+	leaq .Lrt_outside(%rip), %rdi
+	call minicc_puts
+	movl $1, %edi
+	call minicc_exit
+
+	.section .rodata
+.Lrt_equals:
+	.asciz " = "
+.Lrt_open:
+	.asciz " = ["
+.Lrt_comma:
+	.asciz ", "
+.Lrt_close:
+	.asciz "]\\n"
+.Lrt_outside:
+	.asciz "]' is outside the array\\n"
+
+	.data
+	.balign 4
+minicc_outfd:
+	.long 1
+
+	.bss
+	.balign 8
+minicc_outlen:
+	.zero 8
+minicc_big:
+	.zero 128
+minicc_digits:
+	.zero 32
+minicc_decimal:
+	.zero 160
+minicc_out:
+	.zero 65536
+
+	.section .note.GNU-stack,"",@progbits
+"""
+
+
+def translate(text, allocator="linear"):
+    """TAC text as (assembly, statistics of the register allocation)."""
+    if allocator not in ALLOCATORS:
+        raise BackendError(f"no register allocator '{allocator}'")
+    code, types = tac_vm.parse(text)
+    lowering = Lowering(code, types)
+    declared = tac_types.declarations(code, types)
+    names = [d.split(" ")[1].split("[")[0] for d in declared]
+    names = [name for name in names if not TEMP.match(name)]
+    printed = {name for name in names if tac_types.array_size(types[name]) is None}
+    for name in printed:
+        lowering.classes.setdefault(name, register_class(types[name]))
+    program = analyse(lowering.lir, lowering.classes, printed)
+    location, shared, live_in = allocate(program, lowering.classes, allocator)
+    emitter = Emitter(lowering, location, shared, names)
+    assembly = emitter.source(lowering.lir, live_in) + "\n" + RUNTIME
+    return assembly, dict(emitter.stats)
+
+
+def compile_object(source, obj, assembler="builtin"):
+    """Build the assembly source into the object file obj."""
+    if assembler == "gnu":
+        run_gnu(source, obj, link=False)
+        return
+    try:
+        elf_writer.write_object(encode(source), obj)
+    except elf_writer.LinkError as e:
+        raise BackendError(f"cannot write the object: {e}") from None
+
+
+def compile_program(source, exe, assembler="builtin"):
+    """Build the assembly source into the static program exe."""
+    if assembler == "gnu":
+        run_gnu(source, exe, link=True)
+        return
+    try:
+        elf_writer.write_executable(encode(source), exe)
+    except elf_writer.LinkError as e:
+        raise BackendError(f"cannot link: {e}") from None
+
+
+def encode(source):
+    try:
+        return x86_encoder.assemble(source)
+    except x86_encoder.EncodeError as e:
+        raise BackendError(f"cannot assemble: {e}") from None
+
+
+def run_gnu(source, output, link):
+    """Build source with as, and ld when link is set."""
+    with tempfile.TemporaryDirectory() as folder:
+        asm = os.path.join(folder, "program.s")
+        obj = os.path.join(folder, "program.o") if link else output
+        with open(asm, "w") as f:
+            f.write(source)
+        commands = [["as", "--64", "-o", obj, asm]]
+        if link:
+            commands.append(["ld", "-static", "-o", output, obj])
+        for command in commands:
+            process = subprocess.run(command, capture_output=True, text=True)
+            if process.returncode != 0:
+                raise BackendError(f"{command[0]} failed:\n{process.stderr}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Translate optimized three-address code to x86-64 assembly."
+    )
+    parser.add_argument("source", metavar="FILE", help="three-address code")
+    parser.add_argument("-o", "--output", metavar="OUT.s", help="default: stdout")
+    parser.add_argument(
+        "--regalloc",
+        choices=sorted(ALLOCATORS),
+        default="linear",
+        help="register allocator: linear scan (default) or iterated register "
+        "coalescing",
+    )
+    parser.add_argument("--compile", metavar="EXE", help="also build the program EXE")
+    parser.add_argument("--object", metavar="OUT.o", help="also write an object file")
+    parser.add_argument(
+        "--assembler",
+        choices=ASSEMBLERS,
+        default="builtin",
+        help="build EXE and OUT.o in-process (default) or with as and ld",
+    )
+    parser.add_argument(
+        "--stats", action="store_true", help="report spills and copies on stderr"
+    )
+    args = parser.parse_args()
+    try:
+        with open(args.source, "r") as f:
+            source, stats = translate(f.read(), args.regalloc)
+        if args.output:
+            with open(args.output, "w") as f:
+                f.write(source)
+        else:
+            sys.stdout.write(source)
+        if args.object:
+            compile_object(source, args.object, args.assembler)
+        if args.compile:
+            compile_program(source, args.compile, args.assembler)
+    except (OSError, ValueError, BackendError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+    if args.stats:
+        print(format_stats(args.regalloc, stats), file=sys.stderr)
+    return 0
+
+
+def format_stats(allocator, stats):
+    return (
+        f"{ALLOCATORS[allocator]}: {stats.get('spilled', 0)} spilled, "
+        f"{stats.get('spill accesses', 0)} stack accesses, "
+        f"{stats.get('moves', 0)} copies left, {stats.get('coalesced', 0)} removed"
+    )
+
+
+if __name__ == "__main__":
+    sys.exit(main())
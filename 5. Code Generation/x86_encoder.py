@@ -0,0 +1,545 @@
+import re
+import struct
+from collections import namedtuple
+
+# x86-64 encoder for the assembly x86_backend.py emits: the AT&T syntax of
+# GNU as, limited to the instructions, addressing modes and directives the
+# backend and its runtime use. assemble() returns each section's bytes with
+# the symbols and relocations, which elf_writer.py writes as an object file
+# or links into a program. It picks the encodings as does - the 8-bit
+# immediate and accumulator forms, and jumps shortened to an 8-bit
+# displacement wherever it reaches - so the code comes out byte for byte the
+# same.
+
+
+class EncodeError(Exception):
+    pass
+
+
+Register = namedtuple("Register", "number size")  # size 8, 32, 64 or "xmm"
+Immediate = namedtuple("Immediate", "value")
+# symbol + offset, from base + index * scale; base may be "rip"
+Memory = namedtuple("Memory", "symbol offset base index scale")
+
+REGISTERS = {}
+for number, names in enumerate(
+    ["rax eax al", "rcx ecx cl", "rdx edx dl", "rbx ebx bl"]
+    + ["rsp esp spl", "rbp ebp bpl", "rsi esi sil", "rdi edi dil"]
+):
+    for size, name in zip((64, 32, 8), names.split()):
+        REGISTERS[name] = Register(number, size)
+for number in range(8, 16):
+    for size, suffix in ((64, ""), (32, "d"), (8, "b")):
+        REGISTERS[f"r{number}{suffix}"] = Register(number, size)
+for number in range(16):
+    REGISTERS[f"xmm{number}"] = Register(number, "xmm")
+
+SUFFIXES = {"b": 8, "l": 32, "q": 64}
+# opcode extension (the /n of the manuals) of each group of operations
+ALU = {"add": 0, "or": 1, "and": 4, "sub": 5, "xor": 6, "cmp": 7}
+UNARY = {"not": 2, "neg": 3, "mul": 4, "imul": 5, "div": 6, "idiv": 7}
+STEP = {"inc": 0, "dec": 1}
+SHIFTS = {"shl": 4, "sal": 4, "shr": 5, "sar": 7}
+CONDITIONS = {
+    "o": 0, "no": 1, "b": 2, "c": 2, "nae": 2, "ae": 3, "nb": 3, "nc": 3,
+    "e": 4, "z": 4, "ne": 5, "nz": 5, "be": 6, "na": 6, "a": 7, "nbe": 7,
+    "s": 8, "ns": 9, "p": 10, "pe": 10, "np": 11, "po": 11, "l": 12,
+    "nge": 12, "ge": 13, "nl": 13, "le": 14, "ng": 14, "g": 15, "nle": 15,
+}  # fmt: skip
+# scalar SSE operations: mandatory prefix and opcode after 0F
+SSE = {
+    "addss": (b"\xf3", 0x58), "subss": (b"\xf3", 0x5C), "mulss": (b"\xf3", 0x59),
+    "divss": (b"\xf3", 0x5E), "comiss": (b"", 0x2F), "ucomiss": (b"", 0x2E),
+    "xorps": (b"", 0x57),
+}  # fmt: skip
+FIXED = {
+    "ret": b"\xc3", "leave": b"\xc9", "cltd": b"\x99", "cqto": b"\x48\x99",
+    "syscall": b"\x0f\x05", "nop": b"\x90",
+}  # fmt: skip
+SCALES = {1: 0, 2: 1, 4: 2, 8: 3}
+# 'addl' as ('add', 32), for every general purpose instruction
+INTEGER = {
+    name + suffix: (name, size)
+    for family in (("mov", "lea", "test", "push", "pop"), ALU, UNARY, STEP, SHIFTS)
+    for name in family
+    for suffix, size in SUFFIXES.items()
+}
+
+NUMBER = re.compile(r"^[-+]?(0[xX][0-9a-fA-F]+|\d+)$")
+DISPLACEMENT = re.compile(r"^([A-Za-z_.][\w.]*)?([-+]\w+)?$")
+EXTEND = re.compile(r"^mov([sz])b([lq])$")
+ESCAPES = {"n": "\n", "t": "\t", "\\": "\\", '"': '"', "0": "\0"}
+
+
+class Section:
+    def __init__(self, name):
+        self.name = name
+        self.data = bytearray()
+        self.size = 0  # of .bss, which has no data
+        self.align = 1
+        # (offset, "pc32", "plt32" or "32s", symbol, addend)
+        self.relocations = []
+
+
+class Assembly:
+    """Sections by name, symbols as {name: (section, offset)}, and the
+    global ones."""
+
+    def __init__(self):
+        self.sections = {}
+        self.symbols = {}
+        self.globals = set()
+
+
+def fits8(value):
+    return -128 <= value < 128
+
+
+def split_operands(text):
+    """'8(%rbp,%rax,4), %eax' as ['8(%rbp,%rax,4)', '%eax']."""
+    if "(" not in text:
+        return [o.strip() for o in text.split(",") if o.strip()]
+    operands, depth, current = [], 0, ""
+    for ch in text:
+        depth += (ch == "(") - (ch == ")")
+        if ch == "," and depth == 0:
+            operands.append(current.strip())
+            current = ""
+        else:
+            current += ch
+    if current.strip():
+        operands.append(current.strip())
+    return operands
+
+
+def register(text):
+    if not text.startswith("%") or text[1:] not in REGISTERS:
+        raise EncodeError(f"not a register: '{text}'")
+    return REGISTERS[text[1:]]
+
+
+def operand(text):
+    if text[0] == "%":
+        return register(text)
+    if text[0] == "$":
+        if not NUMBER.match(text[1:]):
+            raise EncodeError(f"not a number: '{text}'")
+        return Immediate(int(text[1:], 0))
+    displacement, _, inner = text.partition("(")
+    displacement = displacement.replace(" ", "")
+    if NUMBER.match(displacement):
+        symbol, offset = None, int(displacement, 0)
+    else:
+        match = DISPLACEMENT.match(displacement)
+        if not match:
+            raise EncodeError(f"cannot read the operand '{text}'")
+        symbol = match.group(1)
+        offset = int(match.group(2), 0) if match.group(2) else 0
+    base = index = None
+    scale = 1
+    if inner:
+        parts = [p.strip() for p in inner.rstrip(")").split(",")]
+        if parts[0] == "%rip":
+            base = "rip"
+        elif parts[0]:
+            base = register(parts[0])
+        if len(parts) > 1:
+            index = register(parts[1])
+        if len(parts) > 2:
+            scale = int(parts[2])
+    return Memory(symbol, offset, base, index, scale)
+
+
+class Instruction:
+    """Bytes with fixups of (position, kind, symbol, addend)."""
+
+    def __init__(self, code=b"", fixups=()):
+        self.code = bytes(code)
+        self.fixups = list(fixups)
+
+
+def encode(prefix, opcode, reg, rm, wide=False, immediate=b""):
+    """prefix, REX, opcode, ModRM (SIB, displacement) and immediate, with reg
+    an opcode extension or a Register and rm a Register or Memory."""
+    reg_number = reg.number if isinstance(reg, Register) else reg
+    rex = 0x08 if wide else 0
+    rex |= 0x04 if reg_number >= 8 else 0
+    byte_registers = [r for r in (reg, rm) if isinstance(r, Register)]
+    fixup = None
+    if isinstance(rm, Register):
+        rex |= 0x01 if rm.number >= 8 else 0
+        address = bytes([0xC0 | (reg_number & 7) << 3 | rm.number & 7])
+    elif rm.base == "rip":
+        address = bytes([0x05 | (reg_number & 7) << 3]) + bytes(4)
+        fixup = (1, "pc32")
+    elif rm.base is None:
+        # an absolute address: SIB with no base and a 32-bit displacement
+        index = rm.index.number if rm.index else 4
+        rex |= 0x02 if index >= 8 else 0
+        sib = SCALES[rm.scale] << 6 | (index & 7) << 3 | 5
+        address = bytes([0x04 | (reg_number & 7) << 3, sib])
+        address += struct.pack("<i", 0 if rm.symbol else rm.offset)
+        if rm.symbol:
+            fixup = (2, "32s")
+    else:
+        if rm.symbol:
+            raise EncodeError("a symbol with a base register")
+        base = rm.base.number
+        rex |= 0x01 if base >= 8 else 0
+        if rm.offset == 0 and base & 7 != 5:
+            mod, displacement = 0, b""
+        elif fits8(rm.offset):
+            mod, displacement = 1, struct.pack("<b", rm.offset)
+        else:
+            mod, displacement = 2, struct.pack("<i", rm.offset)
+        if rm.index or base & 7 == 4:
+            index = rm.index.number if rm.index else 4
+            rex |= 0x02 if index >= 8 else 0
+            sib = SCALES[rm.scale] << 6 | (index & 7) << 3 | base & 7
+            address = bytes([mod << 6 | (reg_number & 7) << 3 | 4, sib])
+        else:
+            address = bytes([mod << 6 | (reg_number & 7) << 3 | base & 7])
+        address += displacement
+    # spl, bpl, sil and dil exist only with a REX prefix
+    if rex or any(r.size == 8 and 4 <= r.number < 8 for r in byte_registers):
+        head = prefix + bytes([0x40 | rex]) + opcode
+    else:
+        head = prefix + opcode
+    code = head + address + immediate
+    fixups = []
+    if fixup:
+        position, kind = fixup
+        position += len(head)
+        addend = rm.offset
+        if kind == "pc32":
+            # relative to the end of the instruction
+            addend -= len(code) - position
+        fixups.append((position, kind, rm.symbol, addend))
+    return Instruction(code, fixups)
+
+
+def short_register(opcode, reg, wide=False, immediate=b""):
+    """An opcode with the register in its low 3 bits (push, mov $imm)."""
+    rex = (0x08 if wide else 0) | (0x01 if reg.number >= 8 else 0)
+    prefix = bytes([0x40 | rex]) if rex else b""
+    return Instruction(prefix + bytes([opcode + (reg.number & 7)]) + immediate)
+
+
+def immediate(value, size):
+    if size == 8:
+        return struct.pack("<B", value & 0xFF)
+    if not -(2**31) <= value < 2**32:
+        raise EncodeError(f"{value} does not fit in 32 bits")
+    return struct.pack("<I", value & 0xFFFFFFFF)
+
+
+def check_size(operands, size):
+    for o in operands:
+        if isinstance(o, Register) and o.size != size:
+            raise EncodeError(
+                f"a {o.size}-bit register in a {size}-bit instruction"
+            )
+
+
+def integer(mnemonic, operands):
+    """The general purpose instructions, by family."""
+    if mnemonic not in INTEGER:
+        raise EncodeError(f"unknown instruction '{mnemonic}'")
+    name, size = INTEGER[mnemonic]
+    wide = size == 64
+    byte = size == 8
+    if name in SHIFTS:
+        count, target = operands
+        check_size([target], size)
+        if isinstance(count, Immediate):
+            if count.value == 1:
+                opcode = bytes([0xD0 if byte else 0xD1])
+                return encode(b"", opcode, SHIFTS[name], target, wide)
+            opcode = bytes([0xC0 if byte else 0xC1])
+            count = immediate(count.value, 8)
+            return encode(b"", opcode, SHIFTS[name], target, wide, count)
+        opcode = bytes([0xD2 if byte else 0xD3])
+        return encode(b"", opcode, SHIFTS[name], target, wide)
+    check_size(operands, size)
+    if name in ("push", "pop"):
+        return short_register(0x50 if name == "push" else 0x58, operands[0])
+    if name in UNARY and len(operands) == 1:
+        opcode = bytes([0xF6 if byte else 0xF7])
+        return encode(b"", opcode, UNARY[name], operands[0], wide)
+    if name in STEP:
+        opcode = bytes([0xFE if byte else 0xFF])
+        return encode(b"", opcode, STEP[name], operands[0], wide)
+    if name == "imul":
+        source, target = operands
+        if isinstance(source, Immediate):
+            if fits8(source.value):
+                value = immediate(source.value, 8)
+                return encode(b"", b"\x6b", target, target, wide, value)
+            value = immediate(source.value, 32)
+            return encode(b"", b"\x69", target, target, wide, value)
+        return encode(b"", b"\x0f\xaf", target, source, wide)
+    source, target = operands
+    if name == "lea":
+        return encode(b"", b"\x8d", target, source, wide)
+    if name == "mov":
+        if isinstance(source, Immediate):
+            if isinstance(target, Register) and not wide:
+                opcode = 0xB0 if byte else 0xB8
+                value = immediate(source.value, size)
+                return short_register(opcode, target, False, value)
+            if wide and not -(2**31) <= source.value < 2**31:
+                raise EncodeError(f"{source.value} does not fit in 32 bits")
+            opcode = b"\xc6" if byte else b"\xc7"
+            value = immediate(source.value, min(size, 32))
+            return encode(b"", opcode, 0, target, wide, value)
+        if isinstance(source, Register):
+            return encode(b"", b"\x88" if byte else b"\x89", source, target, wide)
+        return encode(b"", b"\x8a" if byte else b"\x8b", target, source, wide)
+    if name == "test":
+        if isinstance(source, Immediate):
+            value = immediate(source.value, min(size, 32))
+            if isinstance(target, Register) and target.number == 0:
+                prefix = b"\x48" if wide else b""
+                opcode = b"\xa8" if byte else b"\xa9"
+                return Instruction(prefix + opcode + value)
+            opcode = b"\xf6" if byte else b"\xf7"
+            return encode(b"", opcode, 0, target, wide, value)
+        return encode(b"", b"\x84" if byte else b"\x85", source, target, wide)
+    # add, or, and, sub, xor, cmp
+    base = ALU[name] << 3
+    if isinstance(source, Immediate):
+        value = source.value
+        accumulator = isinstance(target, Register) and target.number == 0
+        if byte:
+            if accumulator:
+                return Instruction(bytes([base + 4]) + immediate(value, 8))
+            return encode(b"", b"\x80", ALU[name], target, False, immediate(value, 8))
+        if fits8(value):
+            return encode(b"", b"\x83", ALU[name], target, wide, immediate(value, 8))
+        if accumulator:
+            prefix = b"\x48" if wide else b""
+            return Instruction(prefix + bytes([base + 5]) + immediate(value, 32))
+        return encode(b"", b"\x81", ALU[name], target, wide, immediate(value, 32))
+    if isinstance(source, Register):
+        return encode(b"", bytes([base + (0 if byte else 1)]), source, target, wide)
+    return encode(b"", bytes([base + (2 if byte else 3)]), target, source, wide)
+
+
+def instruction(mnemonic, operands):
+    """Encode one instruction other than a jump or call."""
+    if mnemonic in FIXED:
+        return Instruction(FIXED[mnemonic])
+    if mnemonic in SSE:
+        prefix, opcode = SSE[mnemonic]
+        source, target = operands
+        return encode(prefix, bytes([0x0F, opcode]), target, source)
+    if mnemonic == "movss":
+        source, target = operands
+        if isinstance(target, Register):
+            return encode(b"\xf3", b"\x0f\x10", target, source)
+        return encode(b"\xf3", b"\x0f\x11", source, target)
+    if mnemonic == "movd":
+        source, target = operands
+        if isinstance(target, Register) and target.size == "xmm":
+            return encode(b"\x66", b"\x0f\x6e", target, source)
+        return encode(b"\x66", b"\x0f\x7e", source, target)
+    if mnemonic.startswith("cvtsi2ss"):
+        source, target = operands
+        wide = mnemonic.endswith("q") or getattr(source, "size", 32) == 64
+        return encode(b"\xf3", b"\x0f\x2a", target, source, wide)
+    if mnemonic == "cvttss2si":
+        source, target = operands
+        return encode(b"\xf3", b"\x0f\x2c", target, source, target.size == 64)
+    if mnemonic.startswith("set") and mnemonic[3:] in CONDITIONS:
+        opcode = bytes([0x0F, 0x90 + CONDITIONS[mnemonic[3:]]])
+        return encode(b"", opcode, 0, operands[0])
+    extend = EXTEND.match(mnemonic)
+    if extend:
+        source, target = operands
+        opcode = b"\x0f\xbe" if extend.group(1) == "s" else b"\x0f\xb6"
+        return encode(b"", opcode, target, source, extend.group(2) == "q")
+    if mnemonic == "movslq":
+        source, target = operands
+        return encode(b"", b"\x63", target, source, True)
+    return integer(mnemonic, operands)
+
+
+class Branch:
+    """A jump, conditional jump or call to a label in the same section."""
+
+    def __init__(self, condition, target, call=False):
+        self.condition = condition  # None for jmp
+        self.target = target
+        self.call = call
+        self.long = call
+
+    def size(self):
+        if not self.long:
+            return 2
+        return 5 if self.condition is None else 6
+
+    def encode(self, displacement):
+        if not self.long:
+            opcode = 0xEB if self.condition is None else 0x70 + self.condition
+            return bytes([opcode]) + struct.pack("<b", displacement)
+        if self.call:
+            opcode = b"\xe8"
+        elif self.condition is None:
+            opcode = b"\xe9"
+        else:
+            opcode = bytes([0x0F, 0x80 + self.condition])
+        return opcode + struct.pack("<i", displacement)
+
+
+def string(text):
+    """The bytes of a quoted .asciz operand."""
+    if len(text) < 2 or text[0] != '"' or text[-1] != '"':
+        raise EncodeError(f"not a string: {text}")
+    out, k, body = [], 0, text[1:-1]
+    while k < len(body):
+        if body[k] == "\\":
+            k += 1
+            out.append(ESCAPES[body[k]])
+        else:
+            out.append(body[k])
+        k += 1
+    return "".join(out).encode() + b"\0"
+
+
+def assemble(source):
+    """source as an Assembly."""
+    assembly = Assembly()
+    # per section, its bytes, Instructions, Branches, labels and alignments,
+    # laid out once the branches have their sizes
+    items = {}
+    current = ".text"
+    for number, line in enumerate(source.splitlines(), 1):
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        mnemonic, _, rest = line.partition(" ")
+        if mnemonic in (".text", ".data", ".bss", ".section"):
+            if mnemonic == ".section":
+                mnemonic = rest.split(",")[0].strip()
+            current = mnemonic
+            continue
+        try:
+            statement(line, assembly, items.setdefault(current, []))
+        except (EncodeError, ValueError, KeyError, IndexError) as e:
+            raise EncodeError(f"line {number}: '{line}': {e}") from None
+
+    for name, entries in items.items():
+        assembly.sections[name] = Section(name)
+        layout(assembly, assembly.sections[name], entries)
+    for name in assembly.globals:
+        if name not in assembly.symbols:
+            raise EncodeError(f"global '{name}' is not defined")
+    return assembly
+
+
+def statement(line, assembly, entries):
+    """Add one line's label, directive or instruction to entries."""
+    if line.endswith(":"):
+        entries.append(("label", line[:-1]))
+        return
+    mnemonic, _, rest = line.partition(" ")
+    rest = rest.strip()
+    if mnemonic[0] != ".":
+        if mnemonic in ("call", "jmp"):
+            entries.append(Branch(None, rest, mnemonic == "call"))
+        elif mnemonic[0] == "j" and mnemonic[1:] in CONDITIONS:
+            entries.append(Branch(CONDITIONS[mnemonic[1:]], rest))
+        else:
+            operands = [operand(o) for o in split_operands(rest)]
+            entries.append(instruction(mnemonic, operands))
+    elif mnemonic == ".globl":
+        assembly.globals.add(rest)
+    elif mnemonic == ".balign":
+        entries.append(("align", int(rest, 0)))
+    elif mnemonic == ".long":
+        entries.append(struct.pack("<I", int(rest, 0) & 0xFFFFFFFF))
+    elif mnemonic == ".zero":
+        entries.append(bytes(int(rest, 0)))
+    elif mnemonic == ".asciz":
+        entries.append(string(rest))
+    else:
+        raise EncodeError(f"unknown directive '{mnemonic}'")
+
+
+def layout(assembly, section, entries):
+    """Size the branches, place the labels and write section's bytes. A
+    branch to a global symbol is left to a relocation, as it may be
+    defined elsewhere."""
+    for e in entries:
+        if isinstance(e, Branch) and e.target in assembly.globals:
+            e.long = True
+    while True:
+        # grow the branches out of reach in this layout, then lay out again
+        offsets, places = positions(entries)
+        grown = False
+        for e, offset in zip(entries, offsets):
+            if isinstance(e, Branch) and not e.long:
+                if e.target not in places:
+                    raise EncodeError(f"no label '{e.target}' in {section.name}")
+                if not fits8(places[e.target] - (offset + 2)):
+                    e.long = grown = True
+        if not grown:
+            break
+    for name, place in places.items():
+        if name in assembly.symbols:
+            raise EncodeError(f"'{name}' is defined twice")
+        assembly.symbols[name] = (section.name, place)
+
+    data = bytearray()
+    for e in entries:
+        if isinstance(e, Branch):
+            end = len(data) + e.size()
+            if e.target in assembly.globals:
+                section.relocations.append((end - 4, "plt32", e.target, -4))
+                data += e.encode(0)
+            elif e.target in places:
+                data += e.encode(places[e.target] - end)
+            else:
+                raise EncodeError(f"no label '{e.target}' in {section.name}")
+        elif isinstance(e, Instruction):
+            for position, kind, symbol, addend in e.fixups:
+                relocation = (len(data) + position, kind, symbol, addend)
+                section.relocations.append(relocation)
+            data += e.code
+        elif isinstance(e, tuple):
+            if e[0] == "align":
+                section.align = max(section.align, e[1])
+                padding = b"\x90" if section.name == ".text" else b"\0"
+                data += padding * size(e, len(data))
+        else:
+            data += e
+    section.size = len(data)
+    if section.name == ".bss":
+        if data.count(0) != len(data):
+            raise EncodeError(".bss can only reserve zeros")
+    else:
+        section.data = data
+
+
+def positions(entries):
+    """Each entry's offset and {label: offset}, with the branches at their
+    current sizes."""
+    offset, offsets, places = 0, [], {}
+    for e in entries:
+        offsets.append(offset)
+        if isinstance(e, tuple) and e[0] == "label":
+            places[e[1]] = offset
+        offset += size(e, offset)
+    return offsets, places
+
+
+def size(entry, offset):
+    if isinstance(entry, Branch):
+        return entry.size()
+    if isinstance(entry, Instruction):
+        return len(entry.code)
+    if isinstance(entry, tuple):
+        if entry[0] == "align":
+            return -offset % entry[1]
+        return 0
+    return len(entry)
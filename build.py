@@ -0,0 +1,209 @@
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import time
+from functools import partial
+
+# Builds the native tools once, with optimization, and rebuilds a target only
+# when one of its inputs is not older than its output, so a fresh checkout,
+# where every file has the same time, regenerates everything. The GUIs and
+# the driver call ensure() before each run instead of recompiling every time.
+# The parser and scanner sources are checked in: where yacc or lex is not
+# installed, the checked-in ones are used, and touched so that later calls
+# take them as they are instead of warning again.
+
+ROOT_DIR = os.path.dirname(os.path.abspath(__file__))
+LEX_DIR = os.path.join(ROOT_DIR, "1. LexicalAnalyser")
+AST_DIR = os.path.join(ROOT_DIR, "2. AST")
+
+FRONTEND_SOURCES = [
+    "y.tab.c",
+    "lex.yy.c",
+    "trace.c",
+    "perf.c",
+    "alloc.c",
+    "srcpos.c",
+    "diag.c",
+    "pch.c",
+    "symtab.c",
+    "xref.c",
+    "sema.c",
+    "../1. LexicalAnalyser/literal.cpp",
+]
+FRONTEND_HEADERS = [
+    "ast.h",
+    "trace.h",
+    "perf.h",
+    "alloc.h",
+    "srcpos.h",
+    "diag.h",
+    "pch.h",
+    "symtab.h",
+    "xref.h",
+    "sema.h",
+    "../1. LexicalAnalyser/literal.h",
+]
+LINK_FLAGS = ["-lstdc++", "-pthread"]
+
+
+class BuildError(Exception):
+    pass
+
+
+class Target:
+    def __init__(
+        self, name, directory, outputs, inputs, command, deps=(), checked_in=False
+    ):
+        self.name = name
+        self.directory = directory
+        self.outputs = outputs
+        self.inputs = inputs
+        self.command = command
+        self.deps = deps
+        self.checked_in = checked_in
+
+    def _path(self, name):
+        return os.path.normpath(os.path.join(self.directory, name))
+
+    def stale(self):
+        try:
+            built = min(os.path.getmtime(self._path(o)) for o in self.outputs)
+        except OSError:
+            return True
+        return any(os.path.getmtime(self._path(i)) >= built for i in self.inputs)
+
+    def present(self):
+        return all(os.path.exists(self._path(o)) for o in self.outputs)
+
+
+LEXER_SOURCES = ["lexicalanalyzer.cpp", "lexer.cpp", "literal.cpp"]
+LIBRARY_SOURCES = FRONTEND_SOURCES + ["icg.c", "minicc.c"]
+CC = ["gcc", "-O2", "-I../1. LexicalAnalyser"]
+CXX = ["g++", "-std=c++17", "-O2"]
+
+TARGETS = {
+    t.name: t
+    for t in [
+        Target(
+            "lexer",
+            LEX_DIR,
+            ["lexicalanalyzer.out"],
+            LEXER_SOURCES + ["lexer.h", "literal.h"],
+            CXX + LEXER_SOURCES + ["-o", "lexicalanalyzer.out"],
+        ),
+        Target(
+            "parser",
+            AST_DIR,
+            ["y.tab.c", "y.tab.h"],
+            ["ast.y"],
+            ["yacc", "-d", "ast.y"],
+            checked_in=True,
+        ),
+        Target(
+            "scanner",
+            AST_DIR,
+            ["lex.yy.c"],
+            ["ast.l", "y.tab.h"],
+            ["lex", "ast.l"],
+            deps=("parser",),
+            checked_in=True,
+        ),
+        Target(
+            "frontend",
+            AST_DIR,
+            ["a.out"],
+            FRONTEND_SOURCES + FRONTEND_HEADERS,
+            CC + FRONTEND_SOURCES + LINK_FLAGS + ["-o", "a.out"],
+            deps=("parser", "scanner"),
+        ),
+        Target(
+            "library",
+            AST_DIR,
+            ["libminicc.so"],
+            LIBRARY_SOURCES + FRONTEND_HEADERS + ["icg.h", "minicc.h"],
+            CC
+            + ["-fPIC", "-shared", "-DFRONTEND_NO_MAIN"]
+            + LIBRARY_SOURCES
+            + LINK_FLAGS
+            + ["-o", "libminicc.so"],
+            deps=("parser", "scanner"),
+        ),
+    ]
+}
+
+DEFAULT_TARGETS = ["lexer", "frontend"]
+
+
+def ensure(names, force=False, log=None):
+    """Bring the named targets up to date; returns the names rebuilt."""
+    log = log or (lambda text: None)
+    built = []
+    done = set()
+
+    def visit(name):
+        if name in done:
+            return
+        done.add(name)
+        target = TARGETS[name]
+        for dep in target.deps:
+            visit(dep)
+        if not force and not target.stale():
+            return
+        tool = target.command[0]
+        if target.checked_in and target.present() and shutil.which(tool) is None:
+            log(f"Warning: {tool} not found, using {', '.join(target.outputs)}\n")
+            for output in target.outputs:
+                os.utime(target._path(output))
+            return
+        log(f"Running: {' '.join(target.command)}\n")
+        try:
+            process = subprocess.run(
+                target.command, capture_output=True, text=True, cwd=target.directory
+            )
+        except OSError as e:
+            raise BuildError(f"{name}: {e}") from e
+        if process.returncode != 0:
+            raise BuildError(
+                f"{name}: {' '.join(target.command)} failed:\n{process.stderr}"
+            )
+        built.append(name)
+
+    for name in names:
+        visit(name)
+    return built
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Build the native tools when they are stale."
+    )
+    parser.add_argument(
+        "targets",
+        nargs="*",
+        metavar="TARGET",
+        help=f"{', '.join(TARGETS)} (default: {' '.join(DEFAULT_TARGETS)})",
+    )
+    parser.add_argument(
+        "--force", action="store_true", help="rebuild even if up to date"
+    )
+    args = parser.parse_args()
+
+    unknown = [t for t in args.targets if t not in TARGETS]
+    if unknown:
+        parser.error(f"unknown target: {', '.join(unknown)}")
+    start = time.perf_counter()
+    try:
+        built = ensure(args.targets or DEFAULT_TARGETS, args.force, partial(print, end=""))
+    except BuildError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+    elapsed = (time.perf_counter() - start) * 1000
+    summary = f"built {', '.join(built)}" if built else "up to date"
+    print(f"{summary} ({elapsed:.0f} ms)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
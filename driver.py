@@ -0,0 +1,569 @@
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+from contextlib import contextmanager, nullcontext
+
+ROOT_DIR = os.path.dirname(os.path.abspath(__file__))
+AST_DIR = os.path.join(ROOT_DIR, "2. AST")
+ICG_DIR = os.path.join(ROOT_DIR, "3. ICG")
+OPT_DIR = os.path.join(ROOT_DIR, "4. Code Optimization")
+GEN_DIR = os.path.join(ROOT_DIR, "5. Code Generation")
+
+sys.path.insert(0, ICG_DIR)
+sys.path.insert(0, OPT_DIR)
+sys.path.insert(0, GEN_DIR)
+
+from program_converter import ProgramConverter, format_tac  # noqa: E402
+from code_optimizer import optimize_code  # noqa: E402
+from peephole import DEFAULT_WINDOW  # noqa: E402
+from perf_counters import PerfCounters  # noqa: E402
+import build  # noqa: E402
+import c_backend  # noqa: E402
+import x86_backend  # noqa: E402
+import inotify  # noqa: E402
+import lsp  # noqa: E402
+
+FRONTEND = os.path.join(AST_DIR, "a.out")
+AST_OUTPUT_PATH = os.path.join(AST_DIR, "ast_output.txt")
+ICG_OUTPUT_PATH = os.path.join(ICG_DIR, "icg_output.txt")
+OPTIMIZED_PATH = os.path.join(OPT_DIR, "optimized_code.txt")
+LOG_PATH = os.path.join(OPT_DIR, "optimization_log.txt")
+
+WATCH_QUIET_MS = 100
+INCLUDE = re.compile(r'^\s*#\s*include\s*"([^"]+)"', re.M)
+
+
+class Tracer:
+    """
+    Collects Chrome trace-event spans for the driver's own stages.
+    time.monotonic_ns() reads CLOCK_MONOTONIC, the clock the front end's
+    trace.c uses, so events from both processes share one timeline.
+    """
+
+    def __init__(self):
+        self.pid = os.getpid()
+        self.events = [
+            {
+                "name": "process_name",
+                "ph": "M",
+                "pid": self.pid,
+                "args": {"name": "driver"},
+            }
+        ]
+
+    @contextmanager
+    def span(self, name):
+        start = time.monotonic_ns()
+        try:
+            yield
+        finally:
+            end = time.monotonic_ns()
+            self.events.append(
+                {
+                    "name": name,
+                    "ph": "X",
+                    "pid": self.pid,
+                    "tid": 1,
+                    "ts": start / 1000.0,
+                    "dur": (end - start) / 1000.0,
+                }
+            )
+
+    def merge(self, path):
+        """Append the events of another trace file, e.g. the front end's."""
+        try:
+            with open(path, "r") as f:
+                self.events.extend(json.load(f)["traceEvents"])
+        except (OSError, ValueError, KeyError) as e:
+            print(f"Warning: could not merge trace '{path}': {e}", file=sys.stderr)
+
+    def write(self, path):
+        with open(path, "w") as f:
+            json.dump({"traceEvents": self.events, "displayTimeUnit": "ms"}, f)
+
+
+def extract_preorder(raw_output):
+    """Keep the lines after 'Preorder Traversal', as the AST GUI does."""
+    preorder_lines = []
+    in_preorder = False
+    for line in raw_output.strip().split("\n"):
+        if "Preorder Traversal" in line:
+            in_preorder = True
+            continue
+        if in_preorder and line.strip():
+            preorder_lines.append(line)
+    return "".join(line + "\n" for line in preorder_lines)
+
+
+def run_frontend(
+    source_path, trace_path=None, counters=False, alloc_stats=False, include_dirs=()
+):
+    cmd = [FRONTEND]
+    # the front end runs in its own folder, so header search paths are absolute
+    for include_dir in include_dirs:
+        cmd.append(f"-I{os.path.abspath(include_dir)}")
+    if trace_path:
+        cmd.append(f"--trace={trace_path}")
+    if counters:
+        cmd.append("--counters")
+    if alloc_stats:
+        cmd.append("--alloc-stats")
+    with open(source_path, "r") as source:
+        process = subprocess.run(
+            cmd, stdin=source, capture_output=True, text=True, cwd=AST_DIR
+        )
+    if process.stderr:
+        print(process.stderr, end="", file=sys.stderr)
+    if process.returncode != 0:
+        raise RuntimeError(f"front end exited with status {process.returncode}")
+    return process.stdout
+
+
+def write_ast(ast_text):
+    with open(AST_OUTPUT_PATH, "w") as f:
+        f.write(ast_text)
+
+
+def run_icg(
+    ast_text, stage=lambda name: nullcontext(), measure=lambda name: nullcontext()
+):
+    with stage("icg"), measure("icg"):
+        tac = ProgramConverter().convert(ast_text.strip())
+        icg_lines = format_tac(tac)
+    with open(ICG_OUTPUT_PATH, "w") as f:
+        f.write("\n".join(icg_lines) + "\n")
+    return icg_lines
+
+
+def run_optimizer(
+    icg_lines,
+    stage=lambda name: nullcontext(),
+    measure=lambda name: nullcontext(),
+    window=DEFAULT_WINDOW,
+    vector_width=0,
+):
+    with stage("optimize"), measure("optimize"):
+        optimized_code, log = optimize_code(
+            "\n".join(icg_lines), stage, window, vector_width=vector_width
+        )
+    with open(OPTIMIZED_PATH, "w") as f:
+        f.write(optimized_code)
+    with open(LOG_PATH, "w") as f:
+        for entry in log:
+            f.write(entry + "\n")
+    return optimized_code
+
+
+def line_edit(old, new):
+    """One LSP content change that turns old into new, covering the changed lines."""
+    a = old.split("\n")
+    b = new.split("\n")
+    first = 0
+    while first < min(len(a), len(b)) and a[first] == b[first]:
+        first += 1
+    same = 0
+    while same < min(len(a), len(b)) - first and a[-1 - same] == b[-1 - same]:
+        same += 1
+    if same == 0:
+        # through the end of the text, which has no newline after its last line
+        end = {"line": len(a) - 1, "character": len(a[-1])}
+        if first == len(b):
+            start = {"line": first - 1, "character": len(b[-1])}
+            return {"range": {"start": start, "end": end}, "text": ""}
+        first = min(first, len(a) - 1)
+        text = "\n".join(b[first:])
+    else:
+        end = {"line": len(a) - same, "character": 0}
+        text = "".join(line + "\n" for line in b[first : len(b) - same])
+    start = {"line": first, "character": 0}
+    return {"range": {"start": start, "end": end}, "text": text}
+
+
+class WatchSession:
+    """
+    The pipeline of compile_file for one source, kept in memory between runs
+    for --watch. The source is held as an lsp.Document, so a save recompiles
+    only the functions it changed; the ICG and the optimizer run only when
+    their input text changed.
+    """
+
+    def __init__(
+        self, source_path, include_dirs, window=DEFAULT_WINDOW, vector_width=0
+    ):
+        self.path = os.path.abspath(source_path)
+        self.folders = [os.path.dirname(self.path)]
+        self.folders += [os.path.abspath(d) for d in include_dirs]
+        self.compiler = lsp.minicc.Compiler(
+            include_dirs=self.folders,
+            pch_dir=os.path.join(AST_DIR, "pch-cache"),
+            pch_builder=FRONTEND,
+        )
+        self.text = None
+        self.document = None
+        self.ast_text = None
+        self.icg_lines = None
+        self.window = window
+        self.vector_width = vector_width
+
+    def headers(self):
+        """Every path an #include "x.h" of the source could be read from."""
+        return {
+            os.path.join(folder, name)
+            for name in INCLUDE.findall(self.text or "")
+            for folder in self.folders
+        }
+
+    def run(self, headers_changed=False):
+        start = time.perf_counter()
+        with open(self.path, "r") as f:
+            text = f.read()
+        if self.document is None or headers_changed:
+            # every piece after an #include has the header's symbols in its prefix
+            self.document = lsp.Document("file://" + self.path, text, 1)
+        elif text != self.text:
+            self.document.apply(line_edit(self.text, text))
+        else:
+            return
+        self.text = text
+
+        try:
+            compiled = self.document.analyze(self.compiler)
+        except Exception as e:
+            # one bad save must not end the session; start afresh on the next
+            self.document = None
+            self.report(start, [f"analysis failed: {e}"])
+            return
+        pieces = sum(1 for piece in self.document.pieces if piece.result is not None)
+        for d in self.document.diagnostics():
+            at = d["range"]["start"]
+            color = "1;31m" if d["severity"] == 1 else "1;35m"
+            kind = "error" if d["severity"] == 1 else "warning"
+            print(
+                f"Line:{at['line'] + 1}:{at['character'] + 1}: "
+                f"\033[{color}{kind}: \033[0m{d['message']}"
+            )
+
+        done = [f"recompiled {compiled} of {pieces} functions/declarations"]
+        preorder = self.document.preorder()
+        ast_text = preorder + "\n" if preorder.strip() else ""
+        if ast_text == self.ast_text:
+            done.append("AST unchanged, ICG and optimizer skipped")
+        else:
+            write_ast(ast_text)
+            self.ast_text = ast_text
+            try:
+                icg_lines = run_icg(ast_text)
+                if icg_lines == self.icg_lines:
+                    done.append("ICG unchanged, optimizer skipped")
+                else:
+                    run_optimizer(
+                        icg_lines,
+                        window=self.window,
+                        vector_width=self.vector_width,
+                    )
+                    self.icg_lines = icg_lines
+                    done.append("ICG and optimizer rerun")
+            except Exception as e:
+                # a half-typed program can trip the converter; retry on the next save
+                self.ast_text = None
+                done.append(f"ICG failed: {e}")
+        self.report(start, done)
+
+    def report(self, start, done):
+        elapsed = (time.perf_counter() - start) * 1000
+        stamp = time.strftime("%H:%M:%S")
+        name = os.path.basename(self.path)
+        print(f"[{stamp}] {name}: {'; '.join(done)} ({elapsed:.1f} ms)")
+        sys.stdout.flush()
+
+
+def watch(
+    source_path,
+    include_dirs,
+    quiet_ms=WATCH_QUIET_MS,
+    window=DEFAULT_WINDOW,
+    vector_width=0,
+):
+    session = WatchSession(source_path, include_dirs, window, vector_width)
+    notifier = inotify.Inotify()
+    try:
+        for folder in session.folders:
+            if os.path.isdir(folder):
+                notifier.add(folder)
+        session.run()
+        print(f"Watching '{session.path}' for changes (Ctrl+C to stop).")
+        sys.stdout.flush()
+        while True:
+            changed = notifier.wait({session.path} | session.headers(), quiet_ms / 1000)
+            try:
+                session.run(headers_changed=bool(changed - {session.path}))
+            except OSError as e:
+                # the file may be mid-rename; the next event brings it back
+                print(f"Error: {e}", file=sys.stderr)
+    except KeyboardInterrupt:
+        return 0
+    finally:
+        notifier.close()
+        session.compiler.close()
+
+
+def compile_file(
+    source_path,
+    tracer=None,
+    counters=None,
+    alloc_stats=False,
+    include_dirs=(),
+    window=DEFAULT_WINDOW,
+    vector_width=0,
+    c_path=None,
+    asm_path=None,
+    allocator="linear",
+    obj_path=None,
+    exe_path=None,
+):
+    stage = tracer.span if tracer else (lambda name: nullcontext())
+    measure = counters.phase if counters else (lambda name: nullcontext())
+
+    frontend_trace = None
+    if tracer:
+        fd, frontend_trace = tempfile.mkstemp(suffix=".json")
+        os.close(fd)
+
+    try:
+        with stage("front end"):
+            raw_output = run_frontend(
+                source_path,
+                frontend_trace,
+                counters is not None,
+                alloc_stats,
+                [os.path.dirname(os.path.abspath(source_path))] + list(include_dirs),
+            )
+        if tracer:
+            tracer.merge(frontend_trace)
+    finally:
+        if frontend_trace:
+            os.unlink(frontend_trace)
+
+    print(raw_output, end="")
+
+    ast_text = extract_preorder(raw_output)
+    write_ast(ast_text)
+    icg_lines = run_icg(ast_text, stage, measure)
+    optimized_code = run_optimizer(icg_lines, stage, measure, window, vector_width)
+    if c_path:
+        with stage("c backend"):
+            c_source, flags = c_backend.translate(optimized_code)
+        with open(c_path, "w") as f:
+            f.write(c_source)
+    native = asm_path or obj_path or exe_path
+    if native:
+        with stage("x86-64 backend"):
+            assembly, stats = x86_backend.translate(optimized_code, allocator)
+    if asm_path:
+        with open(asm_path, "w") as f:
+            f.write(assembly)
+    if obj_path:
+        with stage("object file"):
+            x86_backend.compile_object(assembly, obj_path)
+    if exe_path:
+        with stage("link"):
+            x86_backend.compile_program(assembly, exe_path)
+
+    print(f"\nAST saved to '{AST_OUTPUT_PATH}'.")
+    print(f"3-address code saved to '{ICG_OUTPUT_PATH}'.")
+    print(f"Optimized code saved to '{OPTIMIZED_PATH}'.")
+    if c_path:
+        print(f"C saved to '{c_path}' (gcc {' '.join(flags) or 'needs no flags'}).")
+    if native:
+        summary = x86_backend.format_stats(allocator, stats)
+    if asm_path:
+        print(f"Assembly saved to '{asm_path}' ({summary}).")
+    if obj_path:
+        print(f"Object file saved to '{obj_path}' ({summary}).")
+    if exe_path:
+        print(f"Program saved to '{exe_path}' ({summary}).")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run the whole pipeline: AST, ICG and optimization."
+    )
+    parser.add_argument("source", nargs="?", help="C++ source file")
+    parser.add_argument(
+        "--trace", metavar="OUT.json", help="write a Chrome trace-event timeline"
+    )
+    parser.add_argument(
+        "--counters",
+        action="store_true",
+        help="report hardware performance counters per phase",
+    )
+    parser.add_argument(
+        "--alloc-stats",
+        action="store_true",
+        help="report front end allocations per phase and site, and leaks",
+    )
+    parser.add_argument(
+        "-I",
+        "--include-dir",
+        action="append",
+        default=[],
+        metavar="DIR",
+        help='search DIR for #include "..." headers after the source\'s folder',
+    )
+    parser.add_argument(
+        "--peephole-window",
+        type=int,
+        default=DEFAULT_WINDOW,
+        metavar="N",
+        help="match peephole rules over N instructions, 0 to skip "
+        f"(default {DEFAULT_WINDOW})",
+    )
+    parser.add_argument(
+        "--vector-width",
+        type=int,
+        default=0,
+        metavar="N",
+        help="run loops over arrays N iterations at a time, 4 (SSE) or 8 (AVX2); "
+        "default 0, no vectorizing",
+    )
+    parser.add_argument(
+        "--emit-c",
+        metavar="OUT.c",
+        help="also translate the optimized code to C, with vector intrinsics",
+    )
+    parser.add_argument(
+        "--emit-asm",
+        metavar="OUT.s",
+        help="also translate the optimized code to x86-64 assembly",
+    )
+    parser.add_argument(
+        "--emit-obj",
+        metavar="OUT.o",
+        help="also build it into an ELF object file, without an assembler",
+    )
+    parser.add_argument(
+        "--emit-exe",
+        metavar="OUT",
+        help="also build it into a static executable, without an assembler or "
+        "linker",
+    )
+    parser.add_argument(
+        "--regalloc",
+        choices=sorted(x86_backend.ALLOCATORS),
+        default="linear",
+        help="with --emit-asm, --emit-obj or --emit-exe, allocate registers by "
+        "linear scan (default) or iterated register coalescing",
+    )
+    parser.add_argument(
+        "--lsp",
+        action="store_true",
+        help="serve the Language Server Protocol on stdin/stdout instead",
+    )
+    parser.add_argument(
+        "--watch",
+        action="store_true",
+        help="recompile whenever the source or its headers are saved",
+    )
+    parser.add_argument(
+        "--debounce",
+        type=int,
+        default=lsp.DEBOUNCE_MS,
+        metavar="MS",
+        help="with --lsp, publish diagnostics after MS quiet milliseconds",
+    )
+    args = parser.parse_args()
+    if args.source is None and not args.lsp:
+        parser.error("a source file is required unless --lsp is given")
+    if args.watch and (
+        args.trace
+        or args.counters
+        or args.alloc_stats
+        or args.emit_c
+        or args.emit_asm
+        or args.emit_obj
+        or args.emit_exe
+    ):
+        parser.error(
+            "--watch cannot be combined with --trace, --counters, --alloc-stats, "
+            "--emit-c, --emit-asm, --emit-obj or --emit-exe"
+        )
+    native = args.emit_asm or args.emit_obj or args.emit_exe
+    if args.regalloc != "linear" and not native:
+        parser.error("--regalloc needs --emit-asm, --emit-obj or --emit-exe")
+    if args.vector_width and args.vector_width not in c_backend.WIDTHS:
+        parser.error("--vector-width must be 0, 4 or 8")
+
+    # the server and watch mode compile in-process; a.out only parses headers for them
+    in_process = args.lsp or args.watch
+    needed = ["frontend", "library"] if in_process else ["frontend"]
+    output = lsp.minicc.LIBRARY if in_process else FRONTEND
+    try:
+        build.ensure(needed)
+    except build.BuildError as e:
+        if not os.path.isfile(output):
+            print(f"Error: {os.path.basename(output)} not built: {e}", file=sys.stderr)
+            return 1
+        print(
+            f"warning: using the existing {os.path.basename(output)}: {e}",
+            file=sys.stderr,
+        )
+
+    if args.lsp:
+        return lsp.serve(args.include_dir, args.debounce)
+    if args.watch:
+        try:
+            return watch(
+                args.source,
+                args.include_dir,
+                window=args.peephole_window,
+                vector_width=args.vector_width,
+            )
+        except OSError as e:
+            print(f"Error: {e}", file=sys.stderr)
+            return 1
+
+    tracer = Tracer() if args.trace else None
+    counters = None
+    if args.counters:
+        counters = PerfCounters()
+        if not counters.available:
+            print(
+                f"counters: {counters.reason}, counters disabled", file=sys.stderr
+            )
+    try:
+        compile_file(
+            args.source,
+            tracer,
+            counters,
+            args.alloc_stats,
+            args.include_dir,
+            args.peephole_window,
+            args.vector_width,
+            args.emit_c,
+            args.emit_asm,
+            args.regalloc,
+            args.emit_obj,
+            args.emit_exe,
+        )
+    except (OSError, RuntimeError, c_backend.BackendError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+    finally:
+        if tracer:
+            tracer.write(args.trace)
+
+    if tracer:
+        print(f"Trace saved to '{args.trace}'.")
+    if counters:
+        counters.report(os.path.getsize(args.source))
+        counters.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
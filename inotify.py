@@ -0,0 +1,76 @@
+import ctypes
+import os
+import select
+import struct
+import sys
+
+# Directory watches through inotify(7), opened with ctypes like
+# perf_counters.py, for driver.py --watch. Folders are watched rather than
+# files, so editors that save by writing a new file and renaming it over the
+# old one are seen too.
+
+IN_CLOSE_WRITE = 0x00000008
+IN_MOVED_TO = 0x00000080
+IN_CLOEXEC = 0o2000000
+MASK = IN_CLOSE_WRITE | IN_MOVED_TO
+
+# struct inotify_event: wd, mask, cookie, len, then len bytes of name
+EVENT = struct.Struct("iIII")
+
+
+class Inotify:
+    def __init__(self):
+        if sys.platform != "linux":
+            raise OSError("inotify is only available on Linux")
+        self._libc = ctypes.CDLL(None, use_errno=True)
+        self.fd = self._libc.inotify_init1(IN_CLOEXEC)
+        if self.fd < 0:
+            err = ctypes.get_errno()
+            raise OSError(err, f"inotify_init1: {os.strerror(err)}")
+        self.folders = {}
+
+    def add(self, folder):
+        folder = os.path.abspath(folder)
+        if folder in self.folders.values():
+            return
+        wd = self._libc.inotify_add_watch(self.fd, os.fsencode(folder), MASK)
+        if wd < 0:
+            err = ctypes.get_errno()
+            raise OSError(err, f"inotify_add_watch {folder}: {os.strerror(err)}")
+        self.folders[wd] = folder
+
+    def read(self, timeout=None):
+        """Paths written in the next batch of events; empty after timeout seconds."""
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        if not ready:
+            return set()
+        data = os.read(self.fd, 65536)
+        paths = set()
+        pos = 0
+        while pos < len(data):
+            wd, _mask, _cookie, length = EVENT.unpack_from(data, pos)
+            name = data[pos + EVENT.size : pos + EVENT.size + length].rstrip(b"\0")
+            pos += EVENT.size + length
+            if wd in self.folders and name:
+                paths.add(os.path.join(self.folders[wd], os.fsdecode(name)))
+        return paths
+
+    def wait(self, wanted, quiet):
+        """
+        Block until one of the wanted paths is written, then until no event
+        has arrived for quiet seconds, so a burst of saves is one change.
+        Returns the wanted paths written meanwhile.
+        """
+        changed = set()
+        while not changed:
+            changed = self.read() & wanted
+        while True:
+            more = self.read(quiet)
+            if not more:
+                return changed
+            changed |= more & wanted
+
+    def close(self):
+        if self.fd >= 0:
+            os.close(self.fd)
+            self.fd = -1
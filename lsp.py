@@ -0,0 +1,663 @@
+import bisect
+import json
+import os
+import queue
+import re
+import sys
+import threading
+import time
+from urllib.parse import unquote, urlparse
+
+import minicc
+
+# Language server for the mini C++ front end over stdio (driver.py --lsp).
+#
+# A document is kept as a list of top-level units: whole lines ending in a
+# function body, a declaration or an #include. An edit re-splits only the
+# units it touches. Analysis compiles each function, and each run of
+# declarations between functions, on its own through libminicc, with the
+# declarations and function signatures before it as a prefix; a piece whose
+# text and prefix are unchanged keeps its last result, so editing a function
+# body recompiles only that function. Diagnostics are published once a document
+# has been quiet for the debounce interval; hover and go-to-definition are
+# answered from the symbols and use-def positions of the piece under the
+# cursor.
+
+ROOT_DIR = os.path.dirname(os.path.abspath(__file__))
+AST_DIR = os.path.join(ROOT_DIR, "2. AST")
+
+DEBOUNCE_MS = 150
+SEVERITY = {"error": 1, "warning": 2}
+DIAGNOSTIC = re.compile(
+    r"Line:(\d+):(\d+): \x1b\[1;3\dm(error|warning): \x1b\[0m(.*?)\s*$"
+)
+LEXEME = re.compile(r"/[/*]|\"(?:\\.|[^\"\\])*\"?|'(?:\\.|[^'\\])*'?")
+WORD = re.compile(r"\w+|\S")
+NAME = re.compile(r"\w+")
+CALLED = re.compile(r"(\w+)\s*\(")
+
+METHOD_NOT_FOUND = -32601
+INTERNAL_ERROR = -32603
+
+
+def strip_line(line, in_comment):
+    """The code of a line without comments and literal contents, and whether
+    a block comment is still open at its end."""
+    parts = []
+    pos = 0
+    while pos < len(line):
+        if in_comment:
+            end = line.find("*/", pos)
+            if end < 0:
+                break
+            pos = end + 2
+            in_comment = False
+            continue
+        m = LEXEME.search(line, pos)
+        if m is None:
+            parts.append(line[pos:])
+            break
+        parts.append(line[pos : m.start()])
+        token = m.group()
+        if token == "//":
+            break
+        if token == "/*":
+            in_comment = True
+        else:
+            parts.append(token[0] * 2)
+        pos = m.end()
+    return "".join(parts).strip(), in_comment
+
+
+def open_brace(line, in_comment):
+    """Where the first '{' outside comments and literals is in line, -1 if
+    none, and whether a block comment is still open at its end."""
+    pos = 0
+    while pos < len(line):
+        if in_comment:
+            end = line.find("*/", pos)
+            if end < 0:
+                break
+            pos = end + 2
+            in_comment = False
+            continue
+        m = LEXEME.search(line, pos)
+        brace = line.find("{", pos, m.start() if m else len(line))
+        if brace >= 0:
+            return brace, False
+        if m is None or m.group() == "//":
+            break
+        in_comment = m.group() == "/*"
+        pos = m.end()
+    return -1, in_comment
+
+
+class Unit:
+    """Whole lines of the document, ending in one top-level construct."""
+
+    __slots__ = ("lines", "text", "kind", "_names", "_signature")
+
+    def __init__(self, lines, kind):
+        self.lines = lines
+        self.text = "".join(line + "\n" for line in lines)
+        self.kind = kind  # function, declaration, directive, open or blank
+        self._names = None
+        self._signature = None
+
+    def names(self):
+        """The words of the unit, which include every name it uses."""
+        if self._names is None:
+            self._names = frozenset(NAME.findall(self.text))
+        return self._names
+
+    def signature(self):
+        """A function unit up to its body, which is left empty: what later
+        pieces need of it, on the same lines; and the function's name."""
+        if self._signature is None:
+            self._signature = self._cut_body()
+        return self._signature
+
+    def _cut_body(self):
+        in_comment = False
+        code = []
+        for i, line in enumerate(self.lines):
+            brace, in_comment = open_brace(line, in_comment)
+            if brace >= 0:
+                head = line[:brace]
+                code.append(strip_line(head, False)[0])
+                m = CALLED.search(" ".join(code))
+                text = "".join(l + "\n" for l in self.lines[:i]) + head + "{ }\n"
+                return text, m.group(1) if m else None
+            code.append(strip_line(line, in_comment)[0])
+        return self.text, None
+
+
+def split_units(lines):
+    """
+    Split lines into units. A unit ends after a line that is back at brace
+    depth 0 outside a comment and ends in '}' or ';' or is a '#' directive.
+    Lines after the last such line become an open (or blank) unit; the second
+    result says whether there are none.
+    """
+    units = []
+    start = 0
+    depth = 0
+    in_comment = False
+    code_seen = False
+    for i, line in enumerate(lines):
+        code, in_comment = strip_line(line, in_comment)
+        if not code:
+            continue
+        code_seen = True
+        depth += code.count("{") - code.count("}")
+        if depth > 0 or in_comment:
+            continue
+        if code[0] == "#":
+            kind = "directive"
+        elif code[-1] == "}":
+            kind = "function"
+        elif code[-1] == ";":
+            kind = "declaration"
+        else:
+            continue
+        units.append(Unit(lines[start : i + 1], kind))
+        start = i + 1
+        depth = 0
+        code_seen = False
+    if start == len(lines):
+        return units, True
+    units.append(Unit(lines[start:], "open" if code_seen or in_comment else "blank"))
+    return units, False
+
+
+class Analysis:
+    """
+    What one compile of prefix + text found. Positions are (owner, line,
+    column), 0-based, where owner is -1 for text itself or the index of the
+    prefix piece the position falls in.
+    """
+
+    def __init__(self, compiler, prefix, text):
+        owned = [0]
+        for piece in prefix:
+            owned.append(owned[-1] + piece.count("\n"))
+        self.prefix_starts = owned[:-1]
+        self.own_start = owned[-1]
+
+        data = ("".join(prefix) + text).encode()
+        result = compiler.compile(data)
+        self.line_offsets = [0] + [m.end() for m in re.finditer(b"\n", data)]
+
+        # each diagnostic covers the word it points at
+        self.diagnostics = []
+        for line in result.diagnostics.splitlines():
+            m = DIAGNOSTIC.match(line)
+            if m:
+                n = min(int(m.group(1)), len(self.line_offsets)) - 1
+                column = int(m.group(2)) - 1
+                source = data[self.line_offsets[n] :].split(b"\n", 1)[0].decode()
+                word = WORD.search(source, column)
+                end = word.end() if word and word.start() == column else column + 1
+                owner, rel = self._where(n)
+                self.diagnostics.append(
+                    (owner, rel, column, end, m.group(3), m.group(4))
+                )
+
+        self.symbols = []
+        self.occurrences = {}
+        for index, (kind, name, type_name, scope, _line, value) in enumerate(
+            result.symbols
+        ):
+            where = self._locate(result.symbol_offsets[index])
+            self.symbols.append((kind, name, type_name, scope, value, where))
+            for offset in [result.symbol_offsets[index]] + result.uses[index]:
+                owner, rel, column = self._locate(offset)
+                if owner < 0:
+                    self.occurrences.setdefault(rel, []).append(
+                        (column, column + len(name), index)
+                    )
+
+        self.nodes = []
+        keep = False
+        for token, depth, children, line, type_name in result.nodes:
+            if depth == 0:
+                owner, rel = self._where(line - 1)
+                keep = owner < 0
+            if keep:
+                rel = self._where(line - 1)[1]
+                self.nodes.append((token, depth, children, rel, type_name))
+
+    def _where(self, line):
+        if line >= self.own_start:
+            return -1, line - self.own_start
+        k = bisect.bisect_right(self.prefix_starts, line) - 1
+        return k, line - self.prefix_starts[k]
+
+    def _locate(self, offset):
+        line = bisect.bisect_right(self.line_offsets, offset) - 1
+        owner, rel = self._where(line)
+        return owner, rel, offset - self.line_offsets[line]
+
+
+class Piece:
+    """
+    A function, or the units between two functions, compiled together; or,
+    in the prefix of the pieces after a function, its signature.
+    """
+
+    __slots__ = ("start", "text", "prefix", "compiles", "result", "signature")
+
+    def __init__(self, start, prefix, signature=None):
+        self.start = start
+        self.text = ""
+        self.prefix = prefix
+        self.compiles = False
+        self.result = None
+        self.signature = signature  # the function's name, for a signature
+
+
+class Document:
+    def __init__(self, uri, text, version):
+        self.uri = uri
+        self.version = version
+        self.units, _ = split_units(text.split("\n"))
+        self.unit_starts = None
+        self.pieces = None  # None until analyzed after the last edit
+        self.piece_starts = []
+        self.results = {}  # (prefix texts, text) -> Analysis of the last analysis
+
+    def _starts(self):
+        if self.unit_starts is None:
+            self.unit_starts = []
+            line = 0
+            for unit in self.units:
+                self.unit_starts.append(line)
+                line += len(unit.lines)
+        return self.unit_starts
+
+    def line_count(self):
+        return self._starts()[-1] + len(self.units[-1].lines)
+
+    def apply(self, change):
+        """Apply one TextDocumentContentChangeEvent."""
+        self.pieces = None
+        if "range" not in change:
+            self.units, _ = split_units(change["text"].split("\n"))
+            self.unit_starts = None
+            return
+        starts = self._starts()
+        first, last = change["range"]["start"], change["range"]["end"]
+        i = max(bisect.bisect_right(starts, first["line"]) - 1, 0)
+        j = max(bisect.bisect_right(starts, last["line"]) - 1, 0)
+        lines = [line for unit in self.units[i : j + 1] for line in unit.lines]
+
+        def index(position):
+            n = min(position["line"] - starts[i], len(lines))
+            before = sum(len(line) + 1 for line in lines[:n])
+            if n == len(lines):
+                return before - 1
+            return before + min(position["character"], len(lines[n]))
+
+        text = "\n".join(lines)
+        text = text[: index(first)] + change["text"] + text[index(last) :]
+        units, closed = split_units(text.split("\n"))
+        j += 1
+        # an unfinished unit runs on into the ones after it
+        while not closed and j < len(self.units):
+            more, closed = split_units(units.pop().lines + self.units[j].lines)
+            units += more
+            j += 1
+        self.units[i:j] = units
+        self.unit_starts = None
+
+    def analyze(self, compiler):
+        """Compile the pieces whose text or prefix changed; returns how many."""
+        if self.pieces is not None:
+            return 0
+        pieces = []
+        globals_ = []
+        signatures = {}  # name -> signature of the last function so named
+        current = None
+        current_names = set()
+        line = 0
+
+        # a piece gets the signatures of the functions it names: all of them
+        # would make each function's compile grow with the ones above it
+        def prefix(names):
+            stubs = [signatures[name] for name in names if name in signatures]
+            if not stubs:
+                return tuple(globals_)
+            return tuple(sorted(globals_ + stubs, key=lambda p: p.start))
+
+        for unit in self.units:
+            if unit.kind == "function":
+                if current is not None:
+                    current.prefix = prefix(current_names)
+                    globals_.append(current)
+                    current = None
+                piece = Piece(line, prefix(unit.names()))
+                piece.text = unit.text
+                piece.compiles = True
+                pieces.append(piece)
+                text, name = unit.signature()
+                if name is not None:
+                    stub = Piece(line, (), signature=name)
+                    stub.text = text
+                    signatures[name] = stub
+            else:
+                if current is None:
+                    current = Piece(line, ())
+                    current_names = set()
+                    pieces.append(current)
+                current.text += unit.text
+                current_names |= unit.names()
+                current.compiles |= unit.kind in ("declaration", "open")
+            line += len(unit.lines)
+        if current is not None:
+            current.prefix = prefix(current_names)
+
+        compiled = 0
+        results = {}
+        for piece in pieces:
+            if not piece.compiles:
+                continue
+            key = (tuple(p.text for p in piece.prefix), piece.text)
+            piece.result = results.get(key) or self.results.get(key)
+            if piece.result is None:
+                piece.result = Analysis(compiler, key[0], piece.text)
+                compiled += 1
+            results[key] = piece.result
+        self.results = results
+        self.pieces = pieces
+        self.piece_starts = [p.start for p in pieces]
+        return compiled
+
+    def _position(self, piece, where):
+        owner, rel, column = where
+        return (piece if owner < 0 else piece.prefix[owner]).start + rel, column
+
+    def diagnostics(self):
+        last = self.line_count() - 1
+        seen = set()
+        out = []
+        for piece in self.pieces:
+            if piece.result is None:
+                continue
+            for owner, rel, column, end, severity, message in piece.result.diagnostics:
+                # a compiled prefix piece reports its own problems, and a
+                # signature's are reported by its function
+                if owner >= 0 and (
+                    piece.prefix[owner].result is not None
+                    or piece.prefix[owner].signature is not None
+                ):
+                    continue
+                # the end of input is one line past a document without a final newline
+                line = min(self._position(piece, (owner, rel, column))[0], last)
+                if (line, column, message) in seen:
+                    continue
+                seen.add((line, column, message))
+                out.append(
+                    {
+                        "range": {
+                            "start": {"line": line, "character": column},
+                            "end": {"line": line, "character": end},
+                        },
+                        "severity": SEVERITY[severity],
+                        "source": "minicc",
+                        "message": message,
+                    }
+                )
+        return out
+
+    def symbol_at(self, position):
+        """The piece and symbol of the identifier at position, or None."""
+        i = bisect.bisect_right(self.piece_starts, position["line"]) - 1
+        if i < 0 or self.pieces[i].result is None:
+            return None
+        piece = self.pieces[i]
+        for start, end, index in piece.result.occurrences.get(
+            position["line"] - piece.start, ()
+        ):
+            if start <= position["character"] <= end:
+                return piece, piece.result.symbols[index]
+        return None
+
+    def hover(self, position):
+        found = self.symbol_at(position)
+        if found is None:
+            return None
+        kind, name, type_name, scope, value, _ = found[1]
+        text = f"```cpp\n{type_name} {name}\n```\n{kind}, scope {scope}"
+        if kind == "identifier":
+            text += f", value {value:g}"
+        return {"contents": {"kind": "markdown", "value": text}}
+
+    def definition(self, position):
+        found = self.symbol_at(position)
+        if found is None:
+            return None
+        piece, symbol = found
+        line, column = self._position(piece, symbol[5])
+        return {
+            "uri": self.uri,
+            "range": {
+                "start": {"line": line, "character": column},
+                "end": {"line": line, "character": column + len(symbol[1])},
+            },
+        }
+
+    def ast(self):
+        return [
+            {
+                "token": token,
+                "depth": depth,
+                "children": children,
+                "line": piece.start + rel,
+                "type": type_name,
+            }
+            for piece in self.pieces
+            if piece.result is not None
+            for token, depth, children, rel, type_name in piece.result.nodes
+        ]
+
+    def preorder(self):
+        """The newest tree as a.out prints it under 'Preorder Traversal'."""
+        nodes = []
+        for piece in reversed(self.pieces):
+            if piece.result is not None and piece.result.nodes:
+                nodes = piece.result.nodes
+                break
+        root = max((i for i, node in enumerate(nodes) if node[1] == 0), default=0)
+        out = []
+        pending = []  # children still to come for each open node
+        for token, _depth, children, _line, type_name in nodes[root:]:
+            if children:
+                out.append(" ( " + token + " ")
+                pending.append(children)
+                continue
+            out.append(token + (":" + type_name if type_name else "") + " ")
+            while pending:
+                pending[-1] -= 1
+                if pending[-1]:
+                    break
+                pending.pop()
+                out.append(") ")
+        return "".join(out)
+
+
+def read_messages(stream, inbox):
+    """Reader thread: queue each JSON-RPC message, then None at end of input."""
+    while True:
+        length = None
+        while True:
+            header = stream.readline()
+            if not header:
+                inbox.put(None)
+                return
+            header = header.strip()
+            if not header:
+                break
+            name, _, value = header.partition(b":")
+            if name.strip().lower() == b"content-length":
+                length = int(value)
+        if length is None:
+            continue
+        try:
+            inbox.put(json.loads(stream.read(length)))
+        except ValueError as e:
+            print(f"lsp: dropped a malformed message: {e}", file=sys.stderr)
+
+
+class Server:
+    def __init__(self, compiler, out, debounce_ms=DEBOUNCE_MS):
+        self.compiler = compiler
+        self.out = out
+        self.debounce = debounce_ms / 1000.0
+        self.documents = {}
+        self.include_dirs = set()
+        self.due = {}  # uri -> time its diagnostics are published
+        self.shutdown = False
+
+    def send(self, message):
+        body = json.dumps(message, separators=(",", ":")).encode()
+        self.out.write(b"Content-Length: %d\r\n\r\n" % len(body) + body)
+        self.out.flush()
+
+    def notify(self, method, params):
+        self.send({"jsonrpc": "2.0", "method": method, "params": params})
+
+    def run(self, stream):
+        inbox = queue.Queue()
+        reader = threading.Thread(target=read_messages, args=(stream, inbox))
+        reader.daemon = True
+        reader.start()
+        while True:
+            timeout = None
+            if self.due:
+                timeout = max(0.0, min(self.due.values()) - time.monotonic())
+            try:
+                message = inbox.get(timeout=timeout)
+            except queue.Empty:
+                self.publish_due()
+                continue
+            if message is None or message.get("method") == "exit":
+                return 0 if self.shutdown else 1
+            self.dispatch(message)
+
+    def publish_due(self):
+        now = time.monotonic()
+        for uri, due in list(self.due.items()):
+            if due <= now:
+                del self.due[uri]
+                try:
+                    self.publish(self.documents[uri])
+                except Exception as e:
+                    print(f"lsp: analysis of {uri} failed: {e!r}", file=sys.stderr)
+
+    def publish(self, document):
+        document.analyze(self.compiler)
+        self.notify(
+            "textDocument/publishDiagnostics",
+            {
+                "uri": document.uri,
+                "version": document.version,
+                "diagnostics": document.diagnostics(),
+            },
+        )
+
+    def dispatch(self, message):
+        method = message.get("method")
+        handler = None
+        if method:
+            handler = getattr(self, "on_" + method.replace("/", "_"), None)
+        if "id" not in message:
+            if handler is not None:
+                handler(message.get("params") or {})
+            return
+        if handler is None:
+            error = {"code": METHOD_NOT_FOUND, "message": f"unhandled method {method}"}
+            self.send({"jsonrpc": "2.0", "id": message["id"], "error": error})
+            return
+        try:
+            result = handler(message.get("params") or {})
+        except Exception as e:
+            print(f"lsp: {method} failed: {e!r}", file=sys.stderr)
+            error = {"code": INTERNAL_ERROR, "message": str(e)}
+            self.send({"jsonrpc": "2.0", "id": message["id"], "error": error})
+            return
+        self.send({"jsonrpc": "2.0", "id": message["id"], "result": result})
+
+    def _document(self, params):
+        document = self.documents[params["textDocument"]["uri"]]
+        document.analyze(self.compiler)
+        return document
+
+    def on_initialize(self, params):
+        return {
+            "capabilities": {
+                "textDocumentSync": {"openClose": True, "change": 2},
+                "hoverProvider": True,
+                "definitionProvider": True,
+            },
+            "serverInfo": {"name": "minicc", "version": str(minicc.API_VERSION)},
+        }
+
+    def on_shutdown(self, params):
+        self.shutdown = True
+        return None
+
+    def on_textDocument_didOpen(self, params):
+        item = params["textDocument"]
+        url = urlparse(item["uri"])
+        if url.scheme == "file":
+            # headers are searched for beside the document, as the driver does
+            directory = os.path.dirname(unquote(url.path))
+            if directory not in self.include_dirs:
+                self.include_dirs.add(directory)
+                self.compiler.add_include_dir(directory)
+        document = Document(item["uri"], item["text"], item["version"])
+        self.documents[item["uri"]] = document
+        self.due[item["uri"]] = time.monotonic()
+
+    def on_textDocument_didChange(self, params):
+        document = self.documents[params["textDocument"]["uri"]]
+        document.version = params["textDocument"]["version"]
+        for change in params["contentChanges"]:
+            document.apply(change)
+        self.due[document.uri] = time.monotonic() + self.debounce
+
+    def on_textDocument_didClose(self, params):
+        uri = params["textDocument"]["uri"]
+        self.documents.pop(uri, None)
+        self.due.pop(uri, None)
+        self.notify("textDocument/publishDiagnostics", {"uri": uri, "diagnostics": []})
+
+    def on_textDocument_hover(self, params):
+        return self._document(params).hover(params["position"])
+
+    def on_textDocument_definition(self, params):
+        return self._document(params).definition(params["position"])
+
+    def on_minicc_ast(self, params):
+        """Preorder AST of the document: token, depth, line and type of each node."""
+        return self._document(params).ast()
+
+
+def serve(include_dirs=(), debounce_ms=DEBOUNCE_MS):
+    # the protocol owns the real stdout; anything the native code prints
+    # outside a compile goes to stderr instead
+    out = os.fdopen(os.dup(sys.stdout.fileno()), "wb")
+    sys.stdout.flush()
+    os.dup2(sys.stderr.fileno(), sys.stdout.fileno())
+    compiler = minicc.Compiler(
+        include_dirs=include_dirs,
+        pch_dir=os.path.join(AST_DIR, "pch-cache"),
+        pch_builder=os.path.join(AST_DIR, "a.out"),
+    )
+    try:
+        # the reader thread is still blocked in read() at exit, so it gets a
+        # file of its own rather than sys.stdin, which shutdown finalizes
+        stream = os.fdopen(os.dup(sys.stdin.fileno()), "rb")
+        return Server(compiler, out, debounce_ms).run(stream)
+    finally:
+        compiler.close()
@@ -0,0 +1,179 @@
+import ctypes
+import os
+import sys
+
+# ctypes binding for "2. AST/libminicc.so" (built by "2. AST/lib.sh"): the
+# front end and ICG in-process, with tokens, symbols, AST nodes and
+# three-address code returned as lists instead of scraped from a.out.
+
+LIBRARY = os.path.join(os.path.dirname(os.path.abspath(__file__)), "2. AST", "libminicc.so")
+# the library runs a.out to parse a header missing from the cache; the host
+# process (python3) cannot do that itself
+FRONTEND = os.path.join(os.path.dirname(LIBRARY), "a.out")
+API_VERSION = 3
+
+
+class Token(ctypes.Structure):
+    _fields_ = [
+        ("code", ctypes.c_int),
+        ("text", ctypes.c_char_p),
+        ("offset", ctypes.c_uint),
+        ("line", ctypes.c_uint),
+        ("column", ctypes.c_uint),
+    ]
+
+
+class Symbol(ctypes.Structure):
+    _fields_ = [
+        ("name", ctypes.c_char_p),
+        ("kind", ctypes.c_char_p),
+        ("type", ctypes.c_char_p),
+        ("scope", ctypes.c_int),
+        ("offset", ctypes.c_uint),
+        ("line", ctypes.c_uint),
+        ("value", ctypes.c_double),
+    ]
+
+
+class Node(ctypes.Structure):
+    _fields_ = [
+        ("token", ctypes.c_char_p),
+        ("depth", ctypes.c_int),
+        ("nchildren", ctypes.c_int),
+        ("offset", ctypes.c_uint),
+        ("line", ctypes.c_uint),
+        ("type", ctypes.c_char_p),
+    ]
+
+
+class Tac(ctypes.Structure):
+    _fields_ = [
+        ("op", ctypes.c_char_p),
+        ("arg1", ctypes.c_char_p),
+        ("arg2", ctypes.c_char_p),
+        ("result", ctypes.c_char_p),
+    ]
+
+
+def _load(path):
+    lib = ctypes.CDLL(path)
+    lib.minicc_version.restype = ctypes.c_int
+    lib.minicc_create.restype = ctypes.c_void_p
+    lib.minicc_free.argtypes = [ctypes.c_void_p]
+    for name in ("minicc_add_include_dir", "minicc_set_pch_dir", "minicc_set_pch_builder"):
+        getattr(lib, name).argtypes = [ctypes.c_char_p]
+    lib.minicc_compile.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_size_t]
+    lib.minicc_compile.restype = ctypes.c_int
+    lib.minicc_diagnostics.argtypes = [ctypes.c_void_p]
+    lib.minicc_diagnostics.restype = ctypes.c_char_p
+    for kind, struct in (("token", Token), ("symbol", Symbol), ("node", Node), ("tac", Tac)):
+        count = getattr(lib, f"minicc_{kind}_count")
+        count.argtypes = [ctypes.c_void_p]
+        count.restype = ctypes.c_size_t
+        at = getattr(lib, f"minicc_{kind}_at")
+        at.argtypes = [ctypes.c_void_p, ctypes.c_size_t]
+        at.restype = ctypes.POINTER(struct)
+    lib.minicc_symbol_uses.argtypes = [
+        ctypes.c_void_p,
+        ctypes.c_size_t,
+        ctypes.POINTER(ctypes.c_size_t),
+    ]
+    lib.minicc_symbol_uses.restype = ctypes.POINTER(ctypes.c_uint)
+    lib.minicc_format_tac.argtypes = [ctypes.POINTER(Tac), ctypes.c_char_p, ctypes.c_size_t]
+    lib.minicc_format_tac.restype = ctypes.c_int
+    if lib.minicc_version() != API_VERSION:
+        raise OSError(f"{path}: API version {lib.minicc_version()}, expected {API_VERSION}")
+    return lib
+
+
+def _text(value):
+    return value.decode() if value is not None else None
+
+
+class Result:
+    """What one compile produced, copied out of the library."""
+
+    def __init__(self, lib, cc, status):
+        self.status = status
+        self.diagnostics = _text(lib.minicc_diagnostics(cc))
+        self.tokens = [
+            (t.code, _text(t.text), t.line, t.column)
+            for t in self._items(lib, cc, "token")
+        ]
+        self.symbols = [
+            (_text(s.kind), _text(s.name), _text(s.type), s.scope, s.line, s.value)
+            for s in self._items(lib, cc, "symbol")
+        ]
+        # byte offsets: where each symbol is declared and where it is used
+        self.symbol_offsets = [s.offset for s in self._items(lib, cc, "symbol")]
+        self.uses = []
+        count = ctypes.c_size_t()
+        for i in range(len(self.symbols)):
+            uses = lib.minicc_symbol_uses(cc, i, ctypes.byref(count))
+            self.uses.append(uses[: count.value] if count.value else [])
+        self.nodes = [
+            (_text(n.token), n.depth, n.nchildren, n.line, _text(n.type))
+            for n in self._items(lib, cc, "node")
+        ]
+        self.tac = [
+            tuple(_text(v) for v in (t.op, t.arg1, t.arg2, t.result))
+            for t in self._items(lib, cc, "tac")
+        ]
+        buf = ctypes.create_string_buffer(512)
+        self.tac_lines = []
+        for i in range(lib.minicc_tac_count(cc)):
+            lib.minicc_format_tac(lib.minicc_tac_at(cc, i), buf, len(buf))
+            self.tac_lines.append(buf.value.decode())
+
+    @staticmethod
+    def _items(lib, cc, kind):
+        at = getattr(lib, f"minicc_{kind}_at")
+        return [at(cc, i).contents for i in range(getattr(lib, f"minicc_{kind}_count")(cc))]
+
+
+class Compiler:
+    def __init__(
+        self, path=LIBRARY, include_dirs=(), pch_dir=None, pch_builder=FRONTEND
+    ):
+        self._lib = _load(path)
+        self._cc = self._lib.minicc_create()
+        for d in include_dirs:
+            self.add_include_dir(d)
+        if pch_dir is not None:
+            self._lib.minicc_set_pch_dir(os.path.abspath(pch_dir).encode())
+        if pch_builder is not None:
+            self._lib.minicc_set_pch_builder(os.path.abspath(pch_builder).encode())
+
+    def add_include_dir(self, directory):
+        """Search directory for headers after the ones added before (process-wide)."""
+        self._lib.minicc_add_include_dir(os.path.abspath(directory).encode())
+
+    def compile(self, source):
+        data = source.encode() if isinstance(source, str) else source
+        status = self._lib.minicc_compile(self._cc, data, len(data))
+        return Result(self._lib, self._cc, status)
+
+    def close(self):
+        if self._cc:
+            self._lib.minicc_free(self._cc)
+            self._cc = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print(f"usage: {sys.argv[0]} input.cpp", file=sys.stderr)
+        sys.exit(1)
+    with open(sys.argv[1]) as f:
+        source = f.read()
+    with Compiler(include_dirs=[os.path.dirname(os.path.abspath(sys.argv[1]))]) as cc:
+        result = cc.compile(source)
+    sys.stdout.write(result.diagnostics)
+    for kind, name, type_name, scope, line, value in result.symbols:
+        print(f"{kind}\t{name}\t{type_name}\t{scope}\t{line}\t{value:g}")
+    print("\n".join(result.tac_lines))
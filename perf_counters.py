@@ -0,0 +1,136 @@
+import ctypes
+import errno
+import os
+import platform
+import struct
+import sys
+from contextlib import contextmanager
+
+# Python side of "2. AST/perf.c": the same counter group, opened through
+# ctypes so the driver can measure the stages it runs in-process (ICG and
+# the optimizer) and report them in the front end's format.
+
+PERF_TYPE_HARDWARE = 0
+PERF_FORMAT_GROUP = 1 << 3
+PERF_EVENT_IOC_ENABLE = 0x2400
+PERF_EVENT_IOC_RESET = 0x2403
+PERF_IOC_FLAG_GROUP = 1
+
+# name, PERF_COUNT_HW_* config
+COUNTERS = [
+    ("cycles", 0),
+    ("instructions", 1),
+    ("cache-misses", 3),
+    ("branch-misses", 5),
+]
+
+SYSCALL_NUMBERS = {"x86_64": 298, "aarch64": 241}
+
+
+def _attr(config, disabled):
+    # perf_event_attr up to config1 (PERF_ATTR_SIZE_VER0, 64 bytes)
+    flags = (1 if disabled else 0) | (1 << 5) | (1 << 6)  # exclude_kernel, _hv
+    return struct.pack(
+        "=IIQQQQQIIQ", PERF_TYPE_HARDWARE, 64, config, 0, 0, PERF_FORMAT_GROUP,
+        flags, 0, 0, 0,
+    )
+
+
+class PerfCounters:
+    """
+    Counter group for the calling thread. If perf_event_open is missing or
+    refused, available is False, reason says why and phase() does nothing.
+    """
+
+    def __init__(self):
+        self.available = False
+        self.reason = None
+        self.fds = []
+        self.slots = {}
+        self.totals = {}
+        self.order = []
+
+        number = SYSCALL_NUMBERS.get(platform.machine())
+        if sys.platform != "linux" or number is None:
+            self.reason = "perf_event_open is not supported on this platform"
+            return
+
+        libc = ctypes.CDLL(None, use_errno=True)
+        leader = -1
+        for name, config in COUNTERS:
+            buf = ctypes.create_string_buffer(_attr(config, leader == -1))
+            fd = libc.syscall(
+                number, buf, 0, -1, ctypes.c_int(leader), ctypes.c_ulong(0)
+            )
+            if fd < 0:
+                message = os.strerror(ctypes.get_errno() or errno.ENOENT)
+                if leader == -1:
+                    self.reason = f"{name} unavailable ({message})"
+                    return
+                print(f"counters: {name} unavailable ({message})", file=sys.stderr)
+                continue
+            if leader == -1:
+                leader = fd
+            self.slots[name] = len(self.fds)
+            self.fds.append(fd)
+
+        self.leader = leader
+        libc.ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP)
+        libc.ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP)
+        self.available = True
+
+    def read(self):
+        data = os.read(self.leader, 8 * (1 + len(self.fds)))
+        values = struct.unpack(f"={len(data) // 8}Q", data)[1:]
+        return {name: values[slot] for name, slot in self.slots.items()}
+
+    @contextmanager
+    def phase(self, name):
+        if not self.available:
+            yield
+            return
+        begin = self.read()
+        try:
+            yield
+        finally:
+            end = self.read()
+            if name not in self.totals:
+                self.totals[name] = dict.fromkeys(self.slots, 0)
+                self.order.append(name)
+            for counter in self.slots:
+                self.totals[name][counter] += end[counter] - begin[counter]
+
+    def report(self, srclen, file=sys.stderr):
+        if not self.available:
+            return
+        kb = max(srclen, 1) / 1024.0
+
+        def column(totals, counter, per_kb=False):
+            if counter not in self.slots:
+                return "-"
+            return f"{totals[counter] / kb:.1f}" if per_kb else str(totals[counter])
+
+        print(f"\nHardware Counters, driver ({srclen} bytes of source)\n", file=file)
+        print(
+            f"{'Phase':>12} {'Cycles':>14} {'Instructions':>14} {'IPC':>6} "
+            f"{'CacheMiss/KB':>14} {'BranchMiss/KB':>14}",
+            file=file,
+        )
+        for name in self.order:
+            t = self.totals[name]
+            ipc = "-"
+            if "cycles" in t and "instructions" in t and t["cycles"]:
+                ipc = f"{t['instructions'] / t['cycles']:.2f}"
+            print(
+                f"{name:>12} {column(t, 'cycles'):>14} "
+                f"{column(t, 'instructions'):>14} {ipc:>6} "
+                f"{column(t, 'cache-misses', True):>14} "
+                f"{column(t, 'branch-misses', True):>14}",
+                file=file,
+            )
+
+    def close(self):
+        for fd in self.fds:
+            os.close(fd)
+        self.fds = []
+        self.available = False
@@ -0,0 +1,141 @@
+import mmap
+import struct
+import sys
+
+# Python side of "2. AST/symtab.c": maps a symbol table snapshot written by
+# the front end (symtab.bin) and answers lookups with a binary search over
+# its name index, without running the compiler or parsing its text output.
+
+MAGIC = b"MINISYM\0"
+VERSION = 1
+
+HEADER = struct.Struct("<8sIIII")  # magic, version, count, strings size, reserved
+ENTRY = struct.Struct("<IIIIiIbBxx")  # name, token, line, offset, scope, value, dtype, valid
+INDEX = struct.Struct("<I")
+
+DTYPES = {0: "int", 1: "float", 2: "char", 3: "void"}
+
+
+class Symbol:
+    __slots__ = ("index", "name", "token", "line", "offset", "scope", "dtype", "valid", "value")
+
+    def __init__(self, index, name, token, line, offset, scope, dtype, valid, value):
+        self.index = index  # position in the table, and in xref.bin
+        self.name = name
+        self.token = token
+        self.line = line
+        self.offset = offset
+        self.scope = scope
+        self.dtype = dtype
+        self.valid = valid
+        self.value = value
+
+    @property
+    def type_name(self):
+        return DTYPES.get(self.dtype, "-")
+
+    def __repr__(self):
+        return (
+            f"Symbol({self.name!r}, {self.token}, {self.type_name}, "
+            f"scope={self.scope}, line={self.line}, value={self.value!r})"
+        )
+
+
+class SymbolTable:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, version, count, strings_size, _ = HEADER.unpack_from(self._map, 0)
+        size = HEADER.size + count * (ENTRY.size + INDEX.size) + strings_size
+        if magic != MAGIC or version != VERSION or size != len(self._map):
+            self._map.close()
+            raise ValueError(f"{path}: not a symbol table snapshot")
+        self._count = count
+        self._entries = HEADER.size
+        self._index = self._entries + count * ENTRY.size
+        self._strings = self._index + count * INDEX.size
+
+    def close(self):
+        self._map.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __len__(self):
+        return self._count
+
+    def __iter__(self):
+        """Symbols in table order, as printsymtable lists them."""
+        for i in range(self._count):
+            yield self._symbol(i)
+
+    def lookup(self, name):
+        """Every symbol called name, innermost scope last."""
+        key = name.encode()
+        lo, hi = 0, self._count
+        while lo < hi:
+            mid = (lo + hi) // 2
+            if self._name_at(mid) < key:
+                lo = mid + 1
+            else:
+                hi = mid
+        found = []
+        while lo < self._count and self._name_at(lo) == key:
+            found.append(self._symbol(self._sorted(lo)))
+            lo += 1
+        return found
+
+    def _sorted(self, k):
+        return INDEX.unpack_from(self._map, self._index + k * INDEX.size)[0]
+
+    def _name_at(self, k):
+        name = ENTRY.unpack_from(self._map, self._entries + self._sorted(k) * ENTRY.size)[0]
+        return self._string(name)
+
+    def _string(self, offset):
+        start = self._strings + offset
+        return self._map[start : self._map.find(b"\0", start)]
+
+    def _symbol(self, i):
+        name, token, line, offset, scope, raw, dtype, valid = ENTRY.unpack_from(
+            self._map, self._entries + i * ENTRY.size
+        )
+        bits = struct.pack("<I", raw)
+        token = self._string(token).decode()
+        if token == "array":
+            value = raw  # the number of elements
+        elif dtype == 1:
+            value = struct.unpack("<f", bits)[0]
+        elif dtype == 2:
+            value = chr(bits[0])
+        else:
+            value = struct.unpack("<i", bits)[0]
+        return Symbol(
+            i,
+            self._string(name).decode(),
+            token,
+            line,
+            offset,
+            scope,
+            dtype,
+            bool(valid),
+            value,
+        )
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(f"usage: {argv[0]} symtab.bin [name...]", file=sys.stderr)
+        return 1
+    with SymbolTable(argv[1]) as table:
+        symbols = table if len(argv) == 2 else [s for n in argv[2:] for s in table.lookup(n)]
+        for s in symbols:
+            print(f"{s.token}\t{s.name}\t{s.type_name}\t{s.scope}\t{s.line}\t{s.value}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
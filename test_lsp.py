@@ -0,0 +1,114 @@
+import io
+import queue
+import unittest
+
+import build
+import lsp
+import minicc
+
+# Drives lsp.Server in-process, one message at a time, and reads back what
+# it sent. Run with: python3 -m unittest test_lsp
+
+
+class ServerTest(unittest.TestCase):
+    URI = "file:///tmp/undeclared.cpp"
+
+    def setUp(self):
+        build.ensure(["library"])
+        self.compiler = minicc.Compiler()
+        self.out = io.BytesIO()
+        self.server = lsp.Server(self.compiler, self.out, debounce_ms=0)
+        self.next_id = 0
+
+    def tearDown(self):
+        self.compiler.close()
+
+    def sent(self):
+        inbox = queue.Queue()
+        lsp.read_messages(io.BytesIO(self.out.getvalue()), inbox)
+        self.out.seek(0)
+        self.out.truncate()
+        return list(iter(inbox.get_nowait, None))
+
+    def request(self, method, params):
+        self.next_id += 1
+        self.server.dispatch(
+            {"jsonrpc": "2.0", "id": self.next_id, "method": method, "params": params}
+        )
+        (response,) = self.sent()
+        self.assertNotIn("error", response)
+        return response["result"]
+
+    def published(self):
+        self.server.publish_due()
+        (message,) = self.sent()
+        self.assertEqual(message["method"], "textDocument/publishDiagnostics")
+        return message["params"]["diagnostics"]
+
+    def open(self, text):
+        item = {"uri": self.URI, "text": text, "version": 1}
+        self.server.dispatch(
+            {"method": "textDocument/didOpen", "params": {"textDocument": item}}
+        )
+        return self.published()
+
+    def change(self, version, start, end, text):
+        edit = {
+            "range": {
+                "start": {"line": start[0], "character": start[1]},
+                "end": {"line": end[0], "character": end[1]},
+            },
+            "text": text,
+        }
+        document = {"uri": self.URI, "version": version}
+        self.server.dispatch(
+            {
+                "method": "textDocument/didChange",
+                "params": {"textDocument": document, "contentChanges": [edit]},
+            }
+        )
+        return self.published()
+
+    def test_undeclared_call(self):
+        diagnostics = self.open("int main(){ int x; x = g(3); return x; }\n")
+        messages = [d["message"] for d in diagnostics]
+        self.assertIn("use of undeclared identifier 'g'", messages)
+
+        at = {"textDocument": {"uri": self.URI}, "position": {"line": 0, "character": 19}}
+        hover = self.request("textDocument/hover", at)
+        self.assertIn("x", hover["contents"]["value"])
+        definition = self.request("textDocument/definition", at)
+        self.assertEqual(definition["range"]["start"], {"line": 0, "character": 16})
+
+    def test_earlier_function(self):
+        diagnostics = self.open(
+            "int add(int a){ int b; b = a + 1; return b; }\n"
+            "int main(){ int x; x = add; return x; }\n"
+        )
+        self.assertEqual(diagnostics, [])
+
+        at = {"textDocument": {"uri": self.URI}, "position": {"line": 1, "character": 24}}
+        definition = self.request("textDocument/definition", at)
+        self.assertEqual(definition["range"]["start"], {"line": 0, "character": 4})
+
+    def test_edit_one_function(self):
+        self.open(
+            "int one(){ int a; a = 1; return a; }\n"
+            "\n"
+            "int main(){ int x; x = 2; return x; }\n"
+        )
+        first = self.server.documents[self.URI].pieces[0].result
+
+        diagnostics = self.change(2, (2, 23), (2, 24), "y")
+        self.assertEqual(
+            [(d["range"]["start"], d["message"]) for d in diagnostics],
+            [({"line": 2, "character": 23}, "use of undeclared identifier 'y'")],
+        )
+        # the function before the edit was not compiled again
+        self.assertIs(self.server.documents[self.URI].pieces[0].result, first)
+
+        self.assertEqual(self.change(3, (2, 23), (2, 24), "2"), [])
+
+
+if __name__ == "__main__":
+    unittest.main()
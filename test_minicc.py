@@ -0,0 +1,75 @@
+import os
+import struct
+import tempfile
+import unittest
+
+import build
+import minicc
+
+# Compiles through libminicc.so the way the driver and the language server
+# do. Run with: python3 -m unittest test_minicc
+
+
+class IncludeTest(unittest.TestCase):
+    def setUp(self):
+        build.ensure(["frontend", "library"])
+        self.folder = tempfile.TemporaryDirectory()
+        self.header("float scale;\nint twice(int a){ int b; b = a + a; return b; }\n")
+        self.compiler = minicc.Compiler(
+            include_dirs=[self.folder.name],
+            pch_dir=os.path.join(self.folder.name, "pch-cache"),
+        )
+
+    def header(self, text):
+        with open(os.path.join(self.folder.name, "h.h"), "w") as f:
+            f.write(text)
+
+    def entries(self):
+        return sorted(os.listdir(os.path.join(self.folder.name, "pch-cache")))
+
+    def tearDown(self):
+        self.compiler.close()
+        self.folder.cleanup()
+
+    def test_header_symbols(self):
+        source = '#include "h.h"\nint main(){ int x; x = 2; return x; }\n'
+        for run in ("built", "cached"):
+            result = self.compiler.compile(source)
+            self.assertEqual(result.status, 0, run)
+            self.assertEqual(result.diagnostics, "", run)
+            names = {symbol[1]: symbol[2] for symbol in result.symbols}
+            self.assertEqual(names.get("scale"), "float", run)
+            self.assertEqual(names.get("x"), "int", run)
+
+    def test_edit_replaces_entry(self):
+        source = '#include "h.h"\nint main(){ int x; x = 2; return x; }\n'
+        self.assertEqual(self.compiler.compile(source).status, 0)
+        (before,) = self.entries()
+        self.header("char scale;\n")
+        result = self.compiler.compile(source)
+        self.assertEqual(result.status, 0)
+        names = {symbol[1]: symbol[2] for symbol in result.symbols}
+        self.assertEqual(names.get("scale"), "char")
+        (after,) = self.entries()
+        self.assertNotEqual(before, after)
+
+    def test_bad_root_is_rebuilt(self):
+        source = '#include "h.h"\nint main(){ int x; x = 2; return x; }\n'
+        self.assertEqual(self.compiler.compile(source).status, 0)
+        (entry,) = self.entries()
+        path = os.path.join(self.folder.name, "pch-cache", entry)
+        with open(path, "r+b") as f:
+            data = f.read()
+            # pch_header, then pch_symbol, pch_dep and pch_node records
+            _, _, nsymbols, nnodes, nroots, ndeps, _, _, _ = struct.unpack_from("<8sIIIIIIIQ", data)
+            self.assertGreater(nroots, 0)
+            f.seek(48 + 56 * nsymbols + 16 * ndeps + 124 * nnodes)
+            f.write(struct.pack("<i", nnodes + 1000))
+        result = self.compiler.compile(source)
+        self.assertEqual(result.status, 0)
+        self.assertEqual(result.diagnostics, "")
+        self.assertIn("twice", {symbol[1] for symbol in result.symbols})
+
+
+if __name__ == "__main__":
+    unittest.main()
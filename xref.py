@@ -0,0 +1,71 @@
+import mmap
+import struct
+import sys
+
+from symtab import SymbolTable
+
+# Python side of "2. AST/xref.c": maps the use-def index the front end
+# writes with --xref. Record i belongs to symbol i of the table, so a
+# symbol's declaration and uses are read directly, with no search.
+
+MAGIC = b"MINIXRF\0"
+VERSION = 1
+
+HEADER = struct.Struct("<8sIIII")  # magic, version, symbols, uses, reserved
+SYMBOL = struct.Struct("<IIII")  # def offset, def line, first use, use count
+USE = struct.Struct("<II")  # offset, line
+
+
+class CrossReference:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, version, count, nuses, _ = HEADER.unpack_from(self._map, 0)
+        size = HEADER.size + count * SYMBOL.size + nuses * USE.size
+        if magic != MAGIC or version != VERSION or size != len(self._map):
+            self._map.close()
+            raise ValueError(f"{path}: not a cross-reference index")
+        self._count = count
+        self._uses = HEADER.size + count * SYMBOL.size
+
+    def close(self):
+        self._map.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __len__(self):
+        return self._count
+
+    def definition(self, index):
+        """(offset, line) where symbol index is declared."""
+        return SYMBOL.unpack_from(self._map, HEADER.size + index * SYMBOL.size)[:2]
+
+    def uses(self, index):
+        """(offset, line) of each use of symbol index, in source order."""
+        _, _, first, n = SYMBOL.unpack_from(self._map, HEADER.size + index * SYMBOL.size)
+        start = self._uses + first * USE.size
+        return [USE.unpack_from(self._map, start + k * USE.size) for k in range(n)]
+
+
+def main(argv):
+    if len(argv) < 4:
+        print(f"usage: {argv[0]} symtab.bin xref.bin name...", file=sys.stderr)
+        return 1
+    with SymbolTable(argv[1]) as table, CrossReference(argv[2]) as xref:
+        if len(xref) != len(table):
+            print(f"{argv[2]} does not belong to {argv[1]}", file=sys.stderr)
+            return 1
+        for name in argv[3:]:
+            for s in table.lookup(name):
+                _, line = xref.definition(s.index)
+                lines = ", ".join(str(l) for _, l in xref.uses(s.index))
+                print(f"{s.name}\tscope {s.scope}\tdeclared line {line}\tused lines {lines or '-'}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))